@@ -0,0 +1,623 @@
+// File:  archiveReader.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Reads the files stored in tar archives (optionally gzip compressed)
+//        one after another, without extracting them.  Memory use is fixed,
+//        regardless of the size of the archive.
+
+// Standard C++ headers
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+// Local headers
+#include "archiveReader.h"
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for ArchiveReader class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const size_t ArchiveReader::blockSize = 512;
+const size_t ArchiveReader::bufferSize = 256 * 1024;
+const size_t ArchiveReader::maxHeaderDataSize = 1024 * 1024;
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		ArchiveReader
+//
+// Description:		Constructor for ArchiveReader class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ArchiveReader::ArchiveReader() : input(bufferSize)
+{
+	compressed = false;
+	streamInitialized = false;
+	remaining = 0;
+	padding = 0;
+	failed = false;
+	finished = false;
+	memset(&stream, 0, sizeof(stream));
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		~ArchiveReader
+//
+// Description:		Destructor for ArchiveReader class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ArchiveReader::~ArchiveReader()
+{
+	if (streamInitialized)
+		inflateEnd(&stream);
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		Open
+//
+// Description:		Opens the specified archive.  Compression is detected
+//					from the contents, not from the file name.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool ArchiveReader::Open(const std::string &fileName)
+{
+	file.open(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (!file.is_open() || !file.good())
+		return false;
+
+	unsigned char magic[2] = {0, 0};
+	file.read(reinterpret_cast<char*>(magic), sizeof(magic));
+	file.clear();
+	file.seekg(0);
+	compressed = magic[0] == 0x1f && magic[1] == 0x8b;
+
+	if (compressed)
+	{
+		if (inflateInit2(&stream, 15 + 16) != Z_OK)// Expect gzip header
+			return false;
+		streamInitialized = true;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		NextEntry
+//
+// Description:		Skips the rest of the current entry, and moves to the
+//					next regular file.  Directories, links and other special
+//					entries are skipped.  GNU long names and POSIX extended
+//					headers are supported.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		name	= std::string&, path within the archive
+//		size	= unsigned long long&, in bytes
+//
+// Return Value:
+//		bool, true if an entry was found
+//
+//==========================================================================
+bool ArchiveReader::NextEntry(std::string &name, unsigned long long &size)
+{
+	if (failed || finished || !Skip(remaining + padding))
+		return false;
+	remaining = 0;
+	padding = 0;
+
+	std::string longName, extendedName;
+	unsigned long long extendedSize(0);
+	bool hasExtendedSize(false);
+
+	char header[blockSize];
+	for (;;)
+	{
+		const size_t count(ReadSome(header, blockSize));
+		if (count == 0 && !failed)
+		{
+			// Missing end-of-archive blocks are tolerated
+			finished = true;
+			return false;
+		}
+		else if (count < blockSize && !ReadExactly(header + count, blockSize - count))
+			return false;
+
+		if (IsZeroBlock(header))
+		{
+			finished = true;
+			return false;
+		}
+
+		if (!ChecksumMatches(header) || !ParseNumber(header + 124, 12, size))
+		{
+			failed = true;
+			return false;
+		}
+
+		const unsigned long long entryPadding((blockSize - size % blockSize) % blockSize);
+		const char type(header[156]);
+		if (type == 'L')// GNU long name for the next entry
+		{
+			if (!ReadHeaderData(size, longName) || !Skip(entryPadding))
+				return false;
+			continue;
+		}
+		else if (type == 'x')// POSIX extended header for the next entry
+		{
+			std::string data;
+			if (!ReadHeaderData(size, data) || !Skip(entryPadding))
+				return false;
+			ParseExtendedHeader(data, extendedName, extendedSize, hasExtendedSize);
+			continue;
+		}
+		else if (type != '0' && type != '\0' && type != '7')
+		{
+			if (!Skip(size + entryPadding))
+				return false;
+			longName.clear();
+			extendedName.clear();
+			hasExtendedSize = false;
+			continue;
+		}
+
+		if (!extendedName.empty())
+			name = extendedName;
+		else if (!longName.empty())
+			name = longName;
+		else
+		{
+			name = ParseString(header, 100);
+			const std::string prefix(ParseString(header + 345, 155));
+			if (memcmp(header + 257, "ustar", 5) == 0 && !prefix.empty())
+				name = prefix + "/" + name;
+		}
+
+		if (hasExtendedSize)
+			size = extendedSize;
+
+		while (name.compare(0, 2, "./") == 0)
+			name.erase(0, 2);
+
+		remaining = size;
+		padding = (blockSize - size % blockSize) % blockSize;
+
+		// Old archives mark directories only with a trailing slash
+		if (!name.empty() && *name.rbegin() != '/')
+			return true;
+
+		if (!Skip(remaining + padding))
+			return false;
+		remaining = 0;
+		padding = 0;
+		longName.clear();
+		extendedName.clear();
+		hasExtendedSize = false;
+	}
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		Read
+//
+// Description:		Reads the next part of the current entry's contents.
+//
+// Input Arguments:
+//		size	= const size_t&, maximum number of bytes to read
+//
+// Output Arguments:
+//		buffer	= char*
+//
+// Return Value:
+//		size_t, number of bytes read, which is zero at the end of the entry
+//
+//==========================================================================
+size_t ArchiveReader::Read(char *buffer, const size_t &size)
+{
+	const size_t count(static_cast<size_t>(
+		std::min<unsigned long long>(size, remaining)));
+	if (count == 0 || !ReadExactly(buffer, count))
+		return 0;
+
+	remaining -= count;
+	return count;
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		ReadSome
+//
+// Description:		Reads (and decompresses, if necessary) up to the
+//					specified number of bytes from the archive.  Multiple
+//					concatenated gzip members are supported.
+//
+// Input Arguments:
+//		size	= const size_t&
+//
+// Output Arguments:
+//		buffer	= char*
+//
+// Return Value:
+//		size_t, number of bytes read
+//
+//==========================================================================
+size_t ArchiveReader::ReadSome(char *buffer, const size_t &size)
+{
+	if (!compressed)
+	{
+		file.read(buffer, size);
+		if (file.bad())
+			failed = true;
+		return static_cast<size_t>(file.gcount());
+	}
+
+	stream.next_out = reinterpret_cast<Bytef*>(buffer);
+	stream.avail_out = static_cast<uInt>(size);
+	while (stream.avail_out > 0)
+	{
+		if (stream.avail_in == 0)
+		{
+			file.read(input.data(), input.size());
+			if (file.bad())
+			{
+				failed = true;
+				break;
+			}
+			else if (file.gcount() == 0)
+				break;
+
+			stream.next_in = reinterpret_cast<Bytef*>(input.data());
+			stream.avail_in = static_cast<uInt>(file.gcount());
+		}
+
+		const int result(inflate(&stream, Z_NO_FLUSH));
+		if (result == Z_STREAM_END)
+			inflateReset(&stream);
+		else if (result != Z_OK && result != Z_BUF_ERROR)
+		{
+			failed = true;
+			break;
+		}
+	}
+
+	return size - stream.avail_out;
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		ReadExactly
+//
+// Description:		Reads the specified number of bytes, treating the end of
+//					the archive as a failure.
+//
+// Input Arguments:
+//		size	= const size_t&
+//
+// Output Arguments:
+//		buffer	= char*
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool ArchiveReader::ReadExactly(char *buffer, const size_t &size)
+{
+	size_t count(0), lastCount;
+	while (count < size)
+	{
+		lastCount = ReadSome(buffer + count, size - count);
+		if (lastCount == 0)
+		{
+			failed = true;
+			return false;
+		}
+		count += lastCount;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		Skip
+//
+// Description:		Discards the specified number of bytes.  Uncompressed
+//					archives are skipped by seeking.
+//
+// Input Arguments:
+//		count	= unsigned long long
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool ArchiveReader::Skip(unsigned long long count)
+{
+	if (count == 0)
+		return true;
+
+	if (!compressed)
+	{
+		file.seekg(static_cast<std::streamoff>(count), std::ios::cur);
+		if (file.fail())
+			failed = true;
+		return !failed;
+	}
+
+	scratch.resize(bufferSize);
+	while (count > 0)
+	{
+		const size_t size(static_cast<size_t>(
+			std::min<unsigned long long>(count, scratch.size())));
+		if (!ReadExactly(scratch.data(), size))
+			return false;
+		count -= size;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		ReadHeaderData
+//
+// Description:		Reads the contents of a long name or extended header
+//					entry.
+//
+// Input Arguments:
+//		size	= const unsigned long long&
+//
+// Output Arguments:
+//		data	= std::string&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool ArchiveReader::ReadHeaderData(const unsigned long long &size, std::string &data)
+{
+	if (size > maxHeaderDataSize)
+	{
+		failed = true;
+		return false;
+	}
+
+	data.resize(static_cast<size_t>(size));
+	if (size > 0 && !ReadExactly(&data[0], data.size()))
+		return false;
+
+	const size_t end(data.find('\0'));
+	if (end != std::string::npos)
+		data.resize(end);
+
+	return true;
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		IsZeroBlock
+//
+// Description:		Checks for the all-zero blocks which mark the end of the
+//					archive.
+//
+// Input Arguments:
+//		block	= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool ArchiveReader::IsZeroBlock(const char *block)
+{
+	size_t i;
+	for (i = 0; i < blockSize; i++)
+	{
+		if (block[i] != 0)
+			return false;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		ChecksumMatches
+//
+// Description:		Checks the header's checksum, which is the sum of the
+//					header's bytes with the checksum field taken as spaces.
+//					Both unsigned and (historical) signed sums are accepted.
+//
+// Input Arguments:
+//		block	= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool ArchiveReader::ChecksumMatches(const char *block)
+{
+	unsigned long long expected;
+	if (!ParseNumber(block + 148, 8, expected))
+		return false;
+
+	unsigned long long unsignedSum(0);
+	long long signedSum(0);
+	size_t i;
+	for (i = 0; i < blockSize; i++)
+	{
+		const char c((i >= 148 && i < 156) ? ' ' : block[i]);
+		unsignedSum += static_cast<unsigned char>(c);
+		signedSum += static_cast<signed char>(c);
+	}
+
+	return expected == unsignedSum || static_cast<long long>(expected) == signedSum;
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		ParseNumber
+//
+// Description:		Reads a numeric header field, which is either octal text
+//					or (for large values) base-256 with the high bit of the
+//					first byte set.
+//
+// Input Arguments:
+//		field	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		value	= unsigned long long&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool ArchiveReader::ParseNumber(const char *field, const size_t &length,
+	unsigned long long &value)
+{
+	value = 0;
+	size_t i(0);
+	if (static_cast<unsigned char>(field[0]) & 0x80)
+	{
+		value = static_cast<unsigned char>(field[0]) & 0x7f;
+		for (i = 1; i < length; i++)
+			value = (value << 8) | static_cast<unsigned char>(field[i]);
+		return true;
+	}
+
+	while (i < length && field[i] == ' ')
+		i++;
+
+	bool foundDigit(false);
+	for (; i < length && field[i] >= '0' && field[i] <= '7'; i++)
+	{
+		value = value * 8 + (field[i] - '0');
+		foundDigit = true;
+	}
+
+	return foundDigit && (i == length || field[i] == ' ' || field[i] == '\0');
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		ParseString
+//
+// Description:		Reads a text header field, which is terminated by a NUL
+//					unless it fills the field.
+//
+// Input Arguments:
+//		field	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string ArchiveReader::ParseString(const char *field, const size_t &length)
+{
+	const char *end(static_cast<const char*>(memchr(field, '\0', length)));
+	return std::string(field, end ? end : field + length);
+}
+
+//==========================================================================
+// Class:			ArchiveReader
+// Function:		ParseExtendedHeader
+//
+// Description:		Reads the path and size from POSIX extended header
+//					records, which have the form "<length> <key>=<value>\n".
+//
+// Input Arguments:
+//		data	= const std::string&
+//
+// Output Arguments:
+//		name	= std::string&, unchanged if no path is given
+//		size	= unsigned long long&
+//		hasSize	= bool&, true if a size was given
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ArchiveReader::ParseExtendedHeader(const std::string &data, std::string &name,
+	unsigned long long &size, bool &hasSize)
+{
+	size_t position(0);
+	while (position < data.length())
+	{
+		const unsigned long long length(strtoull(data.c_str() + position, NULL, 10));
+		const size_t space(data.find(' ', position));
+		if (length == 0 || space == std::string::npos || position + length > data.length())
+			return;
+
+		const size_t end(position + static_cast<size_t>(length) - 1);// Drop the newline
+		const size_t equals(data.find('=', space));
+		if (equals != std::string::npos && equals < end)
+		{
+			const std::string key(data.substr(space + 1, equals - space - 1));
+			const std::string value(data.substr(equals + 1, end - equals - 1));
+			if (key == "path")
+				name = value;
+			else if (key == "size")
+			{
+				size = strtoull(value.c_str(), NULL, 10);
+				hasSize = true;
+			}
+		}
+
+		position += static_cast<size_t>(length);
+	}
+}
@@ -0,0 +1,67 @@
+// File:  archiveReader.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Reads the files stored in tar archives (optionally gzip compressed)
+//        one after another, without extracting them.  Memory use is fixed,
+//        regardless of the size of the archive.
+
+#ifndef ARCHIVE_READER_H_
+#define ARCHIVE_READER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <fstream>
+
+// zlib headers
+#include <zlib.h>
+
+class ArchiveReader
+{
+public:
+	ArchiveReader();
+	~ArchiveReader();
+
+	bool Open(const std::string &fileName);
+
+	// Advances to the next regular file in the archive; returns false at the
+	// end of the archive or on failure (see HasFailed())
+	bool NextEntry(std::string &name, unsigned long long &size);
+
+	// Reads the next part of the current entry's contents
+	size_t Read(char *buffer, const size_t &size);
+
+	bool HasFailed(void) const { return failed; };
+
+private:
+	static const size_t blockSize;
+	static const size_t bufferSize;
+	static const size_t maxHeaderDataSize;// For long names and extended headers
+
+	std::ifstream file;
+	bool compressed;
+
+	z_stream stream;
+	bool streamInitialized;
+	std::vector<char> input;// Compressed data
+	std::vector<char> scratch;// For discarding data
+
+	unsigned long long remaining;// Bytes left in the current entry
+	unsigned long long padding;// Bytes following the current entry
+	bool failed;
+	bool finished;
+
+	size_t ReadSome(char *buffer, const size_t &size);
+	bool ReadExactly(char *buffer, const size_t &size);
+	bool Skip(unsigned long long count);
+	bool ReadHeaderData(const unsigned long long &size, std::string &data);
+
+	static bool IsZeroBlock(const char *block);
+	static bool ChecksumMatches(const char *block);
+	static bool ParseNumber(const char *field, const size_t &length, unsigned long long &value);
+	static std::string ParseString(const char *field, const size_t &length);
+	static void ParseExtendedHeader(const std::string &data, std::string &name,
+		unsigned long long &size, bool &hasSize);
+};
+
+#endif// ARCHIVE_READER_H_
@@ -0,0 +1,129 @@
+// File:  boundedQueue.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Thread-safe first-in, first-out queue with limited capacity.  Used
+//        between pipeline stages, so a fast producer blocks instead of
+//        consuming unlimited memory.
+
+#ifndef BOUNDED_QUEUE_H_
+#define BOUNDED_QUEUE_H_
+
+// Standard C++ headers
+#include <deque>
+#include <utility>
+#include <mutex>
+#include <condition_variable>
+
+template <typename T>
+class BoundedQueue
+{
+public:
+	BoundedQueue(const size_t &capacity) : capacity(capacity), load(0), closed(false) {};
+
+	void Push(T item, const size_t &weight = 1);
+	bool Pop(T &item);
+	void Close(void);
+
+private:
+	const size_t capacity;
+	size_t load;
+	bool closed;
+
+	std::deque<std::pair<T, size_t> > items;
+
+	std::mutex mutex;
+	std::condition_variable notEmpty;
+	std::condition_variable notFull;
+};
+
+//==========================================================================
+// Class:			BoundedQueue
+// Function:		Push
+//
+// Description:		Adds an item to the queue, waiting until there is room for
+//					it.  An item is always accepted by an empty queue, even if
+//					its weight exceeds the capacity.
+//
+// Input Arguments:
+//		item	= T
+//		weight	= const size_t&, amount of the queue's capacity used by item
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template <typename T>
+void BoundedQueue<T>::Push(T item, const size_t &weight)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (!items.empty() && load + weight > capacity)
+		notFull.wait(lock);
+
+	load += weight;
+	items.push_back(std::make_pair(std::move(item), weight));
+	notEmpty.notify_one();
+}
+
+//==========================================================================
+// Class:			BoundedQueue
+// Function:		Pop
+//
+// Description:		Removes the oldest item from the queue, waiting for one
+//					to be added if the queue is empty.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		item	= T&
+//
+// Return Value:
+//		bool, false if the queue is empty and has been closed
+//
+//==========================================================================
+template <typename T>
+bool BoundedQueue<T>::Pop(T &item)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (items.empty() && !closed)
+		notEmpty.wait(lock);
+
+	if (items.empty())
+		return false;
+
+	item = std::move(items.front().first);
+	load -= items.front().second;
+	items.pop_front();
+	notFull.notify_all();
+	return true;
+}
+
+//==========================================================================
+// Class:			BoundedQueue
+// Function:		Close
+//
+// Description:		Indicates that no more items will be added.  Waiting
+//					consumers return once the queue has been drained.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template <typename T>
+void BoundedQueue<T>::Close(void)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	closed = true;
+	notEmpty.notify_all();
+}
+
+#endif// BOUNDED_QUEUE_H_
@@ -0,0 +1,892 @@
+// File:  checkpointJournal.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Append-only record of the files and directories completed during a
+//        search, so an interrupted run can be resumed without counting them
+//        again.  Records are collected in memory and written (and flushed
+//        to disk) in batches.
+
+// Standard C++ headers
+#include <fstream>
+#include <cstdlib>
+#include <cctype>
+
+#ifdef WIN32
+// Windows headers
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+// *nix headers
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+// Local headers
+#include "checkpointJournal.h"
+#include "partialResults.h"
+
+// First line of checkpoint journals
+static const std::string journalHeader("LineCounter checkpoint 2");
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for CheckpointJournal class.  The
+//					records are written when either limit is reached, so at
+//					most a few seconds of work is lost if the run is
+//					interrupted.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int CheckpointJournal::syncRecordCount(4096);
+const std::chrono::seconds CheckpointJournal::syncInterval(5);
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		CheckpointJournal
+//
+// Description:		Constructor for CheckpointJournal class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+CheckpointJournal::CheckpointJournal()
+{
+	fd = -1;
+	failed = false;
+	resultHandler = NULL;
+	recordCount = 0;
+	lastSync = std::chrono::steady_clock::now();
+
+	PartialResults::Clear(resumedStatistics);
+	unsigned int i;
+	for (i = 0; i < ContentClassifier::ContentTypeCount; i++)
+	{
+		resumedSkipCount[i] = 0;
+		resumedSkipBytes[i] = 0;
+	}
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		~CheckpointJournal
+//
+// Description:		Destructor for CheckpointJournal class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+CheckpointJournal::~CheckpointJournal()
+{
+	if (fd >= 0)
+		Close();
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		Open
+//
+// Description:		Opens the journal for writing.  When resuming, the
+//					existing records are loaded first, and any incomplete
+//					record at the end is removed before new records are
+//					added.
+//
+// Input Arguments:
+//		fileName				= const std::string&
+//		resume					= const bool&
+//		resumedResultHandler	= FileResultHandler*, receives the results of
+//								  the files loaded from the journal (may be
+//								  NULL)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool CheckpointJournal::Open(const std::string &fileName, const bool &resume,
+	FileResultHandler *resumedResultHandler)
+{
+	unsigned long long validLength(0);
+	if (resume && !Load(fileName, resumedResultHandler, validLength))
+		return false;
+
+#ifdef WIN32
+	fd = _open(fileName.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE);
+	if (fd < 0)
+		return false;
+
+	if (_chsize_s(fd, validLength) != 0 || _lseeki64(fd, 0, SEEK_END) < 0)
+		return false;
+#else
+	fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+	if (fd < 0)
+		return false;
+
+	if (ftruncate(fd, validLength) != 0 || lseek(fd, 0, SEEK_END) < 0)
+		return false;
+#endif
+
+	if (validLength == 0)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		records.append(journalHeader);
+		records.push_back('\n');
+	}
+
+	std::lock_guard<std::mutex> lock(writeMutex);
+	return WriteRecords();
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		Close
+//
+// Description:		Writes any remaining records and closes the journal.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if every record was written, false otherwise
+//
+//==========================================================================
+bool CheckpointJournal::Close(void)
+{
+	std::lock_guard<std::mutex> lock(writeMutex);
+	WriteRecords();
+	if (fd >= 0)
+	{
+#ifdef WIN32
+		if (_close(fd) != 0)
+#else
+		if (close(fd) != 0)
+#endif
+			failed = true;
+		fd = -1;
+	}
+
+	return !failed;
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		Load
+//
+// Description:		Reads the records from an existing journal.  The files
+//					recorded outside of completed directories are kept so
+//					they can be skipped during the search.
+//
+// Input Arguments:
+//		fileName				= const std::string&
+//		resumedResultHandler	= FileResultHandler*
+//
+// Output Arguments:
+//		validLength	= unsigned long long&, length of the complete records
+//					  (including the header), or zero if there is no journal
+//
+// Return Value:
+//		bool, true for success (including if there is no journal), false
+//		otherwise
+//
+//==========================================================================
+bool CheckpointJournal::Load(const std::string &fileName,
+	FileResultHandler *resumedResultHandler, unsigned long long &validLength)
+{
+	validLength = 0;
+	std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return true;
+
+	std::string line;
+	if (!std::getline(file, line) || file.eof())
+		return true;// Killed before the header was written
+
+	if (line != journalHeader)
+		return false;
+	validLength = line.length() + 1;
+
+	while (std::getline(file, line))
+	{
+		// An incomplete record can only be at the end
+		if (file.eof())
+			break;
+
+		if (!LoadRecord(line, resumedResultHandler))
+			return false;
+		validLength += line.length() + 1;
+	}
+
+	RemoveFilesInCompletedDirectories();
+	return true;
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		LoadRecord
+//
+// Description:		Processes one record from an existing journal.
+//
+// Input Arguments:
+//		line					= const std::string&
+//		resumedResultHandler	= FileResultHandler*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false if the record is not valid
+//
+//==========================================================================
+bool CheckpointJournal::LoadRecord(const std::string &line,
+	FileResultHandler *resumedResultHandler)
+{
+	if (line.length() < 3 || line[1] != ' ')
+		return false;
+
+	const char *s(line.c_str() + 2);
+	if (line[0] == 'D')
+	{
+		completedDirectories.insert(std::string(s));
+		return true;
+	}
+	else if (line[0] == 'F')
+	{
+		LineCounter::Statistics statistics;
+		FileEntry entry;
+		unsigned long long *values[] = { &statistics.fileCount, &statistics.blankLines,
+			&statistics.commentLines, &statistics.codeLines, &entry.device, &entry.inode };
+		if (!ParseNumbers(s, values, sizeof(values) / sizeof(values[0])) || *s == '\0')
+			return false;
+
+		entry.path = s;
+		entry.size = 0;
+		PartialResults::Add(statistics, resumedStatistics);
+		if (resumedResultHandler)
+			resumedResultHandler->OnFileResult(entry, statistics);
+
+		completedFiles.insert(entry.path);
+		if (entry.inode != 0)
+			completedFileIds.push_back(std::make_pair(entry.device, entry.inode));
+		return true;
+	}
+	else if (line[0] == 'S')
+	{
+		unsigned long long type, bytes, device, inode;
+		unsigned long long *values[] = { &type, &bytes, &device, &inode };
+		if (!ParseNumbers(s, values, sizeof(values) / sizeof(values[0])) ||
+			*s == '\0' || type >= ContentClassifier::ContentTypeCount)
+			return false;
+
+		resumedSkipCount[type]++;
+		resumedSkipBytes[type] += bytes;
+		completedFiles.insert(std::string(s));
+		if (inode != 0)
+			completedFileIds.push_back(std::make_pair(device, inode));
+		return true;
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		ParseNumbers
+//
+// Description:		Parses numbers separated by spaces, and the space
+//					following the last one.
+//
+// Input Arguments:
+//		s		= const char*&, advanced past the numbers
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		values	= unsigned long long*[]
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool CheckpointJournal::ParseNumbers(const char *&s, unsigned long long *values[],
+	const unsigned int &count)
+{
+	char *end;
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		if (!isdigit(static_cast<unsigned char>(*s)))
+			return false;
+
+		*values[i] = strtoull(s, &end, 10);
+		if (*end != ' ')
+			return false;
+		s = end + 1;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		RemoveFilesInCompletedDirectories
+//
+// Description:		Forgets the completed files within completed directories,
+//					since the search will never reach them.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::RemoveFilesInCompletedDirectories(void)
+{
+	if (completedDirectories.empty())
+		return;
+
+	std::unordered_set<std::string>::iterator it(completedFiles.begin());
+	while (it != completedFiles.end())
+	{
+		std::string directory(GetDirectory(*it));
+		while (!directory.empty() && completedDirectories.find(directory) == completedDirectories.end())
+			directory = GetParent(directory);
+
+		if (directory.empty())
+			++it;
+		else
+			it = completedFiles.erase(it);
+	}
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		AddCompletedFileIds
+//
+// Description:		Adds the devices and inodes of the files loaded from an
+//					earlier run (including those in completed directories)
+//					to the set.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		ids	= FileIdSet&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::AddCompletedFileIds(FileIdSet &ids) const
+{
+	unsigned int i;
+	for (i = 0; i < completedFileIds.size(); i++)
+		ids.Insert(completedFileIds[i].first, completedFileIds[i].second);
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		OnFileResult
+//
+// Description:		Records a counted file.  Called from the parse threads.
+//
+// Input Arguments:
+//		entry		= const FileEntry&
+//		statistics	= const LineCounter::Statistics&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::OnFileResult(const FileEntry &entry,
+	const LineCounter::Statistics &statistics)
+{
+	const std::string fields(std::to_string(statistics.fileCount) + ' '
+		+ std::to_string(statistics.blankLines) + ' '
+		+ std::to_string(statistics.commentLines) + ' '
+		+ std::to_string(statistics.codeLines) + ' '
+		+ std::to_string(entry.device) + ' '
+		+ std::to_string(entry.inode));
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		AppendRecord('F', fields, entry.path);
+		CompleteFile(entry.path);
+	}
+	SyncIfDue();
+
+	if (resultHandler)
+		resultHandler->OnFileResult(entry, statistics);
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		OnFileSkipped
+//
+// Description:		Records a file which was found but not counted because of
+//					its contents.  Called from the parse threads.
+//
+// Input Arguments:
+//		entry	= const FileEntry&
+//		type	= const ContentClassifier::ContentType&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::OnFileSkipped(const FileEntry &entry,
+	const ContentClassifier::ContentType &type)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		AppendRecord('S', std::to_string(static_cast<unsigned int>(type)) + ' '
+			+ std::to_string(entry.size) + ' ' + std::to_string(entry.device) + ' '
+			+ std::to_string(entry.inode), entry.path);
+		CompleteFile(entry.path);
+	}
+	SyncIfDue();
+
+	if (resultHandler)
+		resultHandler->OnFileSkipped(entry, type);
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		OnFileUnfinished
+//
+// Description:		Passes on a file which was not counted before the
+//					deadline.  Nothing is recorded, so the file (and its
+//					directory) will be counted when the run is resumed.
+//
+// Input Arguments:
+//		entry	= const FileEntry&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::OnFileUnfinished(const FileEntry &entry)
+{
+	if (resultHandler)
+		resultHandler->OnFileUnfinished(entry);
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		OnFileCutShort
+//
+// Description:		Passes on a file which was only partly counted before the
+//					deadline.  As for unfinished files, nothing is recorded.
+//
+// Input Arguments:
+//		entry		= const FileEntry&
+//		statistics	= const LineCounter::Statistics&
+//		parsedBytes	= const unsigned long long&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::OnFileCutShort(const FileEntry &entry,
+	const LineCounter::Statistics &statistics, const unsigned long long &parsedBytes)
+{
+	if (resultHandler)
+		resultHandler->OnFileCutShort(entry, statistics, parsedBytes);
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		OnDirectoryEntered
+//
+// Description:		Starts tracking a directory.  Its parent (if tracked)
+//					can't be completed before it is.
+//
+// Input Arguments:
+//		path	= const std::string&, ending with a separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::OnDirectoryEntered(const std::string &path)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!directories.insert(std::make_pair(path, Directory())).second)
+		return;
+
+	std::map<std::string, Directory>::iterator parent(directories.find(GetParent(path)));
+	if (parent != directories.end())
+		parent->second.pendingSubdirectories++;
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		OnDirectorySearched
+//
+// Description:		Marks the search of a directory (including its
+//					subdirectories) as finished, so it is complete once its
+//					files have been counted.
+//
+// Input Arguments:
+//		path	= const std::string&, ending with a separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::OnDirectorySearched(const std::string &path)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		std::map<std::string, Directory>::iterator it(directories.find(path));
+		if (it == directories.end())
+			return;
+
+		it->second.searched = true;
+		CompleteDirectories(it);
+	}
+	SyncIfDue();
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		OnFileFound
+//
+// Description:		Checks whether a file found by the search was completed
+//					by an earlier run, and if not, counts it as pending in
+//					its directory.
+//
+// Input Arguments:
+//		path	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the file should be counted
+//
+//==========================================================================
+bool CheckpointJournal::OnFileFound(const std::string &path)
+{
+	if (completedFiles.find(path) != completedFiles.end())
+		return false;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	std::map<std::string, Directory>::iterator it(directories.find(GetDirectory(path)));
+	if (it != directories.end())
+		it->second.pendingFiles++;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		IsDirectoryComplete
+//
+// Description:		Checks whether a directory was completed by an earlier
+//					run.
+//
+// Input Arguments:
+//		path	= const std::string&, ending with a separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool CheckpointJournal::IsDirectoryComplete(const std::string &path) const
+{
+	return completedDirectories.find(path) != completedDirectories.end();
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		AppendRecord
+//
+// Description:		Adds a record to those waiting to be written.  The mutex
+//					must be locked.
+//
+// Input Arguments:
+//		type	= const char&
+//		fields	= const std::string&, fields before the path (may be empty)
+//		path	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::AppendRecord(const char &type, const std::string &fields,
+	const std::string &path)
+{
+	records.push_back(type);
+	records.push_back(' ');
+	if (!fields.empty())
+	{
+		records.append(fields);
+		records.push_back(' ');
+	}
+	records.append(path);
+	records.push_back('\n');
+	recordCount++;
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		CompleteFile
+//
+// Description:		Removes a recorded file from its directory's pending
+//					files.  The mutex must be locked.
+//
+// Input Arguments:
+//		path	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::CompleteFile(const std::string &path)
+{
+	// Files in archives and files passed directly aren't in tracked directories
+	std::map<std::string, Directory>::iterator it(directories.find(GetDirectory(path)));
+	if (it == directories.end() || it->second.pendingFiles == 0)
+		return;
+
+	it->second.pendingFiles--;
+	CompleteDirectories(it);
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		CompleteDirectories
+//
+// Description:		Records the directory if it is complete, then does the
+//					same for its parent, and so on.  The mutex must be
+//					locked.
+//
+// Input Arguments:
+//		it	= std::map<std::string, Directory>::iterator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::CompleteDirectories(std::map<std::string, Directory>::iterator it)
+{
+	while (it->second.searched && it->second.pendingFiles == 0 &&
+		it->second.pendingSubdirectories == 0)
+	{
+		AppendRecord('D', std::string(), it->first);
+
+		const std::string parent(GetParent(it->first));
+		directories.erase(it);
+
+		it = directories.find(parent);
+		if (it == directories.end())
+			return;
+		it->second.pendingSubdirectories--;
+	}
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		SyncIfDue
+//
+// Description:		Writes the waiting records if there are enough of them or
+//					enough time has passed since they were last written.  If
+//					another thread is already writing, the records are left
+//					for later.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CheckpointJournal::SyncIfDue(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (recordCount < syncRecordCount &&
+			std::chrono::steady_clock::now() - lastSync < syncInterval)
+			return;
+	}
+
+	std::unique_lock<std::mutex> lock(writeMutex, std::try_to_lock);
+	if (lock.owns_lock())
+		WriteRecords();
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		WriteRecords
+//
+// Description:		Appends the waiting records to the journal and flushes
+//					them to disk.  Records can be added by other threads
+//					while this is in progress.  The write mutex must be
+//					locked.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if every record so far was written, false otherwise
+//
+//==========================================================================
+bool CheckpointJournal::WriteRecords(void)
+{
+	std::string batch;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		batch.swap(records);
+		recordCount = 0;
+		lastSync = std::chrono::steady_clock::now();
+	}
+
+	if (batch.empty() || fd < 0 || failed)
+		return !failed;
+
+	size_t written(0);
+	while (written < batch.length())
+	{
+#ifdef WIN32
+		const int count(_write(fd, batch.data() + written,
+			static_cast<unsigned int>(batch.length() - written)));
+#else
+		const ssize_t count(write(fd, batch.data() + written, batch.length() - written));
+		if (count < 0 && errno == EINTR)
+			continue;
+#endif
+		if (count <= 0)
+		{
+			failed = true;
+			return false;
+		}
+		written += count;
+	}
+
+#ifdef WIN32
+	if (_commit(fd) != 0)
+#else
+	if (fsync(fd) != 0)
+#endif
+		failed = true;
+
+	return !failed;
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		GetDirectory
+//
+// Description:		Returns the directory part of a file's path.
+//
+// Input Arguments:
+//		path	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string, ending with a separator (empty if there is none)
+//
+//==========================================================================
+std::string CheckpointJournal::GetDirectory(const std::string &path)
+{
+	const size_t separator(path.find_last_of("/\\"));
+	if (separator == std::string::npos)
+		return std::string();
+	return path.substr(0, separator + 1);
+}
+
+//==========================================================================
+// Class:			CheckpointJournal
+// Function:		GetParent
+//
+// Description:		Returns the path of the directory containing a directory.
+//
+// Input Arguments:
+//		directory	= const std::string&, ending with a separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string, ending with a separator (empty if there is none)
+//
+//==========================================================================
+std::string CheckpointJournal::GetParent(const std::string &directory)
+{
+	if (directory.length() < 2)
+		return std::string();
+	return GetDirectory(directory.substr(0, directory.length() - 1));
+}
@@ -0,0 +1,138 @@
+// File:  checkpointJournal.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Append-only record of the files and directories completed during a
+//        search, so an interrupted run can be resumed without counting them
+//        again.  Records are collected in memory and written (and flushed
+//        to disk) in batches.
+
+#ifndef CHECKPOINT_JOURNAL_H_
+#define CHECKPOINT_JOURNAL_H_
+
+// Standard C++ headers
+#include <string>
+#include <map>
+#include <vector>
+#include <utility>
+#include <unordered_set>
+#include <mutex>
+#include <chrono>
+
+// Local headers
+#include "lineCounter.h"
+#include "fileProcessor.h"
+#include "contentClassifier.h"
+#include "fileIdSet.h"
+
+// The journal is text:  a header line, then one line per record.  Counted
+// files are "F <file count> <blank> <comment> <code> <device> <inode> <path>",
+// skipped files are "S <content type> <bytes> <device> <inode> <path>" and
+// directories whose files have all been recorded are "D <path>".  The device
+// and inode (zero if unknown) let links to completed files be recognized
+// after resuming, when their directories are no longer searched.  A directory is only recorded after all
+// of its files and subdirectories, so a resumed run can skip it entirely.
+// Only the last line can be incomplete (if the process was killed while
+// writing it), and it is discarded when resuming.
+class CheckpointJournal : public FileResultHandler
+{
+public:
+	CheckpointJournal();
+	~CheckpointJournal();
+
+	// Starts a new journal, or (if resume is true) loads the records from an
+	// existing journal and adds to it.  A missing journal is not an error
+	// when resuming; the run starts from the beginning.
+	bool Open(const std::string &fileName, const bool &resume,
+		FileResultHandler *resumedResultHandler = NULL);
+
+	// Writes the remaining records; returns false if any write failed
+	bool Close(void);
+
+	// Results are passed on to this handler after they are recorded
+	void SetFileResultHandler(FileResultHandler *handler) { resultHandler = handler; };
+
+	virtual void OnFileResult(const FileEntry &entry,
+		const LineCounter::Statistics &statistics);
+	virtual void OnFileSkipped(const FileEntry &entry,
+		const ContentClassifier::ContentType &type);
+	virtual void OnFileUnfinished(const FileEntry &entry);
+	virtual void OnFileCutShort(const FileEntry &entry,
+		const LineCounter::Statistics &statistics, const unsigned long long &parsedBytes);
+
+	// Called during the search.  Directory paths end with a separator.
+	// OnFileFound() returns false if the file was completed by an earlier
+	// run, in which case it must not be queued.
+	void OnDirectoryEntered(const std::string &path);
+	void OnDirectorySearched(const std::string &path);
+	bool OnFileFound(const std::string &path);
+	bool IsDirectoryComplete(const std::string &path) const;
+
+	// Results loaded from an earlier run
+	const LineCounter::Statistics& GetResumedStatistics(void) const { return resumedStatistics; };
+	unsigned long long GetResumedSkipCount(const ContentClassifier::ContentType &type) const { return resumedSkipCount[type]; };
+	unsigned long long GetResumedSkipBytes(const ContentClassifier::ContentType &type) const { return resumedSkipBytes[type]; };
+	unsigned long long GetResumedDirectoryCount(void) const { return completedDirectories.size(); };
+
+	// Adds the files completed by an earlier run, so links to them found
+	// during the search are not counted again
+	void AddCompletedFileIds(FileIdSet &ids) const;
+
+private:
+	CheckpointJournal(const CheckpointJournal&);
+	CheckpointJournal& operator=(const CheckpointJournal&);
+
+	static const unsigned int syncRecordCount;
+	static const std::chrono::seconds syncInterval;
+
+	int fd;
+	bool failed;
+	FileResultHandler *resultHandler;
+
+	// Directories being searched or with files still being counted
+	struct Directory
+	{
+		Directory() : pendingFiles(0), pendingSubdirectories(0), searched(false) {};
+
+		unsigned long long pendingFiles;
+		unsigned int pendingSubdirectories;
+		bool searched;
+	};
+
+	std::map<std::string, Directory> directories;
+
+	// Completed by an earlier run (not modified once the search starts)
+	std::unordered_set<std::string> completedFiles;// Only those outside of completed directories
+	std::unordered_set<std::string> completedDirectories;
+	std::vector<std::pair<unsigned long long, unsigned long long> > completedFileIds;// Device and inode
+
+	LineCounter::Statistics resumedStatistics;
+	unsigned long long resumedSkipCount[ContentClassifier::ContentTypeCount];
+	unsigned long long resumedSkipBytes[ContentClassifier::ContentTypeCount];
+
+	// Guards directories and the records waiting to be written
+	std::mutex mutex;
+	std::string records;
+	unsigned int recordCount;
+	std::chrono::steady_clock::time_point lastSync;
+
+	// Held while writing, so batches reach the disk in the order they were
+	// recorded
+	std::mutex writeMutex;
+
+	bool Load(const std::string &fileName, FileResultHandler *resumedResultHandler,
+		unsigned long long &validLength);
+	bool LoadRecord(const std::string &line, FileResultHandler *resumedResultHandler);
+	void RemoveFilesInCompletedDirectories(void);
+
+	void AppendRecord(const char &type, const std::string &fields, const std::string &path);
+	void CompleteFile(const std::string &path);
+	void CompleteDirectories(std::map<std::string, Directory>::iterator it);
+	void SyncIfDue(void);
+	bool WriteRecords(void);
+
+	static bool ParseNumbers(const char *&s, unsigned long long *values[], const unsigned int &count);
+	static std::string GetDirectory(const std::string &path);
+	static std::string GetParent(const std::string &directory);
+};
+
+#endif// CHECKPOINT_JOURNAL_H_
@@ -0,0 +1,418 @@
+// File:  chunkedParser.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Parses large files by splitting them into chunks at line boundaries
+//        and classifying the chunks in parallel.
+
+// Standard C++ headers
+#include <fstream>
+#include <thread>
+#include <cassert>
+
+// Local headers
+#include "chunkedParser.h"
+
+//==========================================================================
+// Class:			ChunkedParser
+// Function:		ChunkedParser
+//
+// Description:		Constructor for ChunkedParser class.
+//
+// Input Arguments:
+//		prototype	= const SourceParser&, configured parser to copy for each chunk
+//		threadCount	= const unsigned int&
+//		budget		= ThreadBudget*, shared by parsers on other threads (NULL
+//					  to always use threadCount threads)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ChunkedParser::ChunkedParser(const SourceParser &prototype,
+	const unsigned int &threadCount, ThreadBudget *budget) : prototype(prototype),
+	threadCount(threadCount > 0 ? threadCount : 1), budget(budget)
+{
+	deadline = NULL;
+}
+
+//==========================================================================
+// Class:			ChunkedParser
+// Function:		ProcessFile
+//
+// Description:		Parses the specified file and adds the results to the
+//					statistics.  Each chunk after the first is classified
+//					speculatively for every state in which the previous chunk
+//					could have left the parser; the chunks are then stitched
+//					together in order using the actual states, so the result
+//					is identical to parsing the file serially.  If the
+//					deadline passes first, only the lines before the first
+//					point at which a chunk was stopped are counted.  The
+//					file is split into one chunk for the calling thread and
+//					one for each thread taken from the budget.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//		fileSize	= const unsigned long long&
+//
+// Output Arguments:
+//		statistics	= LineCounter::Statistics&, line counts are added to
+//					  these (file count is not modified)
+//		parsedBytes	= unsigned long long&, length of the counted start of
+//					  the file
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool ChunkedParser::ProcessFile(const std::string &fileName,
+	const unsigned long long &fileSize, LineCounter::Statistics &statistics,
+	unsigned long long &parsedBytes) const
+{
+	const unsigned int extraThreadCount(budget ?
+		budget->TryAcquire(threadCount - 1) : threadCount - 1);
+	const unsigned int chunkCount(extraThreadCount + 1);
+	std::vector<ChunkResult> results(chunkCount);
+	std::vector<std::thread> threads;
+
+	unsigned int i;
+	for (i = 1; i < chunkCount; i++)
+	{
+		const unsigned long long start(fileSize * i / chunkCount);
+		const unsigned long long end(fileSize * (i + 1) / chunkCount);
+		threads.push_back(std::thread(&ChunkedParser::ProcessChunk, this,
+			std::cref(fileName), start, end, true, std::ref(results[i])));
+	}
+
+	ProcessChunk(fileName, 0, fileSize / chunkCount, false, results[0]);
+
+	for (i = 0; i < threads.size(); i++)
+		threads[i].join();
+
+	if (budget)
+		budget->Release(extraThreadCount);
+
+	unsigned int entryState(0);
+	for (i = 0; i < results.size(); i++)
+	{
+		if (!results[i].ok)
+			return false;
+
+		statistics.blankLines += results[i].statistics[entryState].blankLines;
+		statistics.commentLines += results[i].statistics[entryState].commentLines;
+		statistics.codeLines += results[i].statistics[entryState].codeLines;
+		entryState = results[i].exitState[entryState];
+
+		// Later chunks depend on the state at the end of this one
+		if (!results[i].finished)
+		{
+			parsedBytes = results[i].parsedEnd;
+			return true;
+		}
+	}
+
+	parsedBytes = fileSize;
+	return true;
+}
+
+//==========================================================================
+// Class:			ChunkedParser
+// Function:		GetEntryStateCount
+//
+// Description:		Returns the number of distinct states in which a line can
+//					begin.  Code, comment and whitespace states are equivalent
+//					at the start of a line, so the distinct states are code,
+//					continuing comment, and block comment for each pair of
+//					block comment indicators.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int ChunkedParser::GetEntryStateCount(void) const
+{
+	return prototype.GetBlockCommentIndicatorCount() + 2;
+}
+
+//==========================================================================
+// Class:			ChunkedParser
+// Function:		GetEntryState
+//
+// Description:		Returns the index of the entry state corresponding to
+//					the parser's current state.
+//
+// Input Arguments:
+//		parser	= const SourceParser&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int ChunkedParser::GetEntryState(const SourceParser &parser) const
+{
+	if (parser.GetState() == SourceParser::PositionContinuingComment)
+		return 1;
+	else if (parser.GetState() == SourceParser::PositionBlockComment)
+		return 2 + parser.GetBlockCommentIndex();
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			ChunkedParser
+// Function:		SetEntryState
+//
+// Description:		Places the parser into the specified entry state.
+//
+// Input Arguments:
+//		parser		= SourceParser&
+//		entryState	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ChunkedParser::SetEntryState(SourceParser &parser, const unsigned int &entryState) const
+{
+	if (entryState == 0)
+		parser.SetState(SourceParser::PositionCode);
+	else if (entryState == 1)
+		parser.SetState(SourceParser::PositionContinuingComment);
+	else
+		parser.SetState(SourceParser::PositionBlockComment, entryState - 2);
+}
+
+//==========================================================================
+// Class:			ChunkedParser
+// Function:		ProcessChunk
+//
+// Description:		Classifies the lines starting within the specified byte
+//					range.  When speculating, one parser is run per entry
+//					state; parsers that reach the same state are merged, since
+//					they will classify all remaining lines identically.  Stops
+//					early if the deadline passes.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//		start		= const unsigned long long&, first byte of the chunk
+//		end			= const unsigned long long&, one past the last byte
+//		speculate	= const bool&, false to consider only the code entry state
+//
+// Output Arguments:
+//		result		= ChunkResult&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ChunkedParser::ProcessChunk(const std::string &fileName,
+	const unsigned long long &start, const unsigned long long &end,
+	const bool &speculate, ChunkResult &result) const
+{
+	const unsigned int entryStateCount(speculate ? GetEntryStateCount() : 1);
+	LineCounter::Statistics zero = {};
+	result.statistics.assign(entryStateCount, zero);
+	result.exitState.assign(entryStateCount, 0);
+	result.ok = false;
+	result.finished = true;
+
+	std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (!file.is_open() || !file.good())
+		return;
+
+	// Lines belong to the chunk in which they start, so skip the partial line
+	unsigned long long position(start);
+	std::string line;
+	if (start > 0)
+	{
+		file.seekg(start - 1);
+		if (file.get() != '\n' && std::getline(file, line))
+			position += line.length() + 1;
+	}
+
+	std::vector<SourceParser> parsers(entryStateCount, prototype);
+	std::vector<LineCounter::Statistics> parserStatistics(entryStateCount, zero);
+	std::vector<unsigned int> liveParsers, owner(entryStateCount);
+	std::vector<LineCounter::Statistics> offset(entryStateCount, zero);
+
+	unsigned int i, j, k;
+	for (i = 0; i < entryStateCount; i++)
+	{
+		SetEntryState(parsers[i], i);
+		liveParsers.push_back(i);
+		owner[i] = i;
+	}
+
+	unsigned int linesUntilCheck(LineCounter::linesPerDeadlineCheck);
+	while (position < end && std::getline(file, line))
+	{
+		if (deadline && --linesUntilCheck == 0)
+		{
+			linesUntilCheck = LineCounter::linesPerDeadlineCheck;
+			if (deadline->HasPassed())
+			{
+				result.finished = false;
+				break;
+			}
+		}
+
+		position += line.length() + 1;
+		for (i = 0; i < liveParsers.size(); i++)
+			LineCounter::CountLine(parsers[liveParsers[i]].ParseLine(line),
+				parserStatistics[liveParsers[i]]);
+
+		for (i = 0; i + 1 < liveParsers.size(); i++)
+		{
+			for (j = i + 1; j < liveParsers.size(); j++)
+			{
+				const unsigned int keep(liveParsers[i]), drop(liveParsers[j]);
+				if (GetEntryState(parsers[keep]) != GetEntryState(parsers[drop]))
+					continue;
+
+				// Freeze the counts accumulated by the dropped parser and
+				// follow the kept parser from here on
+				for (k = 0; k < entryStateCount; k++)
+				{
+					if (owner[k] != drop)
+						continue;
+
+					result.statistics[k].blankLines += parserStatistics[drop].blankLines - offset[k].blankLines;
+					result.statistics[k].commentLines += parserStatistics[drop].commentLines - offset[k].commentLines;
+					result.statistics[k].codeLines += parserStatistics[drop].codeLines - offset[k].codeLines;
+					offset[k] = parserStatistics[keep];
+					owner[k] = keep;
+				}
+
+				liveParsers.erase(liveParsers.begin() + j);
+				j--;
+			}
+		}
+	}
+
+	if (file.bad())
+		return;
+
+	for (k = 0; k < entryStateCount; k++)
+	{
+		result.statistics[k].blankLines += parserStatistics[owner[k]].blankLines - offset[k].blankLines;
+		result.statistics[k].commentLines += parserStatistics[owner[k]].commentLines - offset[k].commentLines;
+		result.statistics[k].codeLines += parserStatistics[owner[k]].codeLines - offset[k].codeLines;
+		result.exitState[k] = GetEntryState(parsers[owner[k]]);
+	}
+
+	result.parsedEnd = position;
+	result.ok = true;
+}
+
+//==========================================================================
+// Class:			ThreadBudget
+// Function:		ThreadBudget
+//
+// Description:		Constructor for ThreadBudget class.
+//
+// Input Arguments:
+//		threadCount	= const unsigned int&, maximum number of threads parsing
+//					  at once
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ThreadBudget::ThreadBudget(const unsigned int &threadCount)
+	: available(threadCount > 0 ? threadCount : 1)
+{
+}
+
+//==========================================================================
+// Class:			ThreadBudget
+// Function:		Acquire
+//
+// Description:		Waits for a thread to become available and takes it.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ThreadBudget::Acquire(void)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (available == 0)
+		availableCondition.wait(lock);
+	available--;
+}
+
+//==========================================================================
+// Class:			ThreadBudget
+// Function:		TryAcquire
+//
+// Description:		Takes as many of the requested threads as are available,
+//					without waiting.
+//
+// Input Arguments:
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, number of threads taken
+//
+//==========================================================================
+unsigned int ThreadBudget::TryAcquire(const unsigned int &count)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	const unsigned int acquired(count < available ? count : available);
+	available -= acquired;
+	return acquired;
+}
+
+//==========================================================================
+// Class:			ThreadBudget
+// Function:		Release
+//
+// Description:		Returns threads to the budget.
+//
+// Input Arguments:
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ThreadBudget::Release(const unsigned int &count)
+{
+	if (count == 0)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		available += count;
+	}
+	availableCondition.notify_all();
+}
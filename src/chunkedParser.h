@@ -0,0 +1,81 @@
+// File:  chunkedParser.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Parses large files by splitting them into chunks at line boundaries
+//        and classifying the chunks in parallel.
+
+#ifndef CHUNKED_PARSER_H_
+#define CHUNKED_PARSER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+// Local headers
+#include "sourceParser.h"
+#include "lineCounter.h"
+
+// Limits the number of threads parsing at once, when several threads may
+// each parse a large file using more threads
+class ThreadBudget
+{
+public:
+	ThreadBudget(const unsigned int &threadCount);
+
+	// Blocks until a thread is available
+	void Acquire(void);
+
+	// Returns the number of threads acquired (up to count, possibly zero)
+	unsigned int TryAcquire(const unsigned int &count);
+	void Release(const unsigned int &count);
+
+private:
+	std::mutex mutex;
+	std::condition_variable availableCondition;
+	unsigned int available;
+};
+
+class ChunkedParser
+{
+public:
+	// The calling thread parses one of the chunks; if a budget is given,
+	// the other chunks are parsed by as many threads (up to threadCount - 1)
+	// as it has available when parsing starts
+	ChunkedParser(const SourceParser &prototype, const unsigned int &threadCount,
+		ThreadBudget *budget = NULL);
+
+	// When set, parsing stops once the deadline has passed
+	void SetDeadline(const Deadline *deadline) { this->deadline = deadline; };
+
+	// parsedBytes is the length of the start of the file which was counted
+	// (fileSize unless the deadline passed first)
+	bool ProcessFile(const std::string &fileName, const unsigned long long &fileSize,
+		LineCounter::Statistics &statistics, unsigned long long &parsedBytes) const;
+
+private:
+	const SourceParser prototype;
+	const unsigned int threadCount;
+	ThreadBudget *const budget;
+	const Deadline *deadline;
+
+	// Result of classifying one chunk for each possible entry state
+	struct ChunkResult
+	{
+		std::vector<LineCounter::Statistics> statistics;
+		std::vector<unsigned int> exitState;
+		bool ok;
+		bool finished;// False if stopped by the deadline
+		unsigned long long parsedEnd;// One past the last line parsed
+	};
+
+	unsigned int GetEntryStateCount(void) const;
+	unsigned int GetEntryState(const SourceParser &parser) const;
+	void SetEntryState(SourceParser &parser, const unsigned int &entryState) const;
+
+	void ProcessChunk(const std::string &fileName, const unsigned long long &start,
+		const unsigned long long &end, const bool &speculate, ChunkResult &result) const;
+};
+
+#endif// CHUNKED_PARSER_H_
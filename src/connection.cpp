@@ -0,0 +1,424 @@
+// File:  connection.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Minimal line-oriented TCP connection and listener, used to pass
+//        work and results between coordinator and worker processes.
+
+#ifdef WIN32
+// Windows headers
+#include <ws2tcpip.h>
+#else
+// *nix headers
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+// Standard C++ headers
+#include <cstring>
+#include <sstream>
+
+// Local headers
+#include "connection.h"
+
+#ifdef WIN32
+static const SocketHandle invalidSocket(INVALID_SOCKET);
+
+//==========================================================================
+// Class:			None
+// Function:		InitializeSockets
+//
+// Description:		Initializes Winsock (once per process).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+static void InitializeSockets(void)
+{
+	static bool initialized(false);
+	if (!initialized)
+	{
+		WSADATA data;
+		WSAStartup(MAKEWORD(2, 2), &data);
+		initialized = true;
+	}
+}
+
+#define CloseSocket closesocket
+#else
+static const SocketHandle invalidSocket(-1);
+static void InitializeSockets(void) {}
+#define CloseSocket close
+#endif
+
+//==========================================================================
+// Class:			Connection
+// Function:		Connection
+//
+// Description:		Constructor for Connection class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Connection::Connection() : socket(invalidSocket)
+{
+}
+
+//==========================================================================
+// Class:			Connection
+// Function:		~Connection
+//
+// Description:		Destructor for Connection class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Connection::~Connection()
+{
+	Close();
+}
+
+//==========================================================================
+// Class:			Connection
+// Function:		Connect
+//
+// Description:		Connects to the specified host.
+//
+// Input Arguments:
+//		host	= const std::string&, name or address
+//		port	= const unsigned short&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool Connection::Connect(const std::string &host, const unsigned short &port)
+{
+	InitializeSockets();
+	Close();
+
+	std::ostringstream service;
+	service << port;
+
+	addrinfo hints, *addresses;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	if (getaddrinfo(host.c_str(), service.str().c_str(), &hints, &addresses) != 0)
+		return false;
+
+	addrinfo *address;
+	for (address = addresses; address; address = address->ai_next)
+	{
+		socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+		if (socket == invalidSocket)
+			continue;
+
+		if (connect(socket, address->ai_addr, address->ai_addrlen) == 0)
+			break;
+
+		CloseSocket(socket);
+		socket = invalidSocket;
+	}
+	freeaddrinfo(addresses);
+
+	if (socket == invalidSocket)
+		return false;
+
+	// Messages are short and each one waits for a reply
+	int noDelay(1);
+	setsockopt(socket, IPPROTO_TCP, TCP_NODELAY,
+		reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+	return true;
+}
+
+//==========================================================================
+// Class:			Connection
+// Function:		Close
+//
+// Description:		Closes the connection.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Connection::Close(void)
+{
+	if (socket != invalidSocket)
+	{
+		CloseSocket(socket);
+		socket = invalidSocket;
+	}
+	buffer.clear();
+}
+
+//==========================================================================
+// Class:			Connection
+// Function:		ReadLine
+//
+// Description:		Waits for the next line of text from the other end of
+//					the connection.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		line	= std::string&, without the line ending
+//
+// Return Value:
+//		bool, false if the connection was closed or failed
+//
+//==========================================================================
+bool Connection::ReadLine(std::string &line)
+{
+	size_t end;
+	while ((end = buffer.find('\n')) == std::string::npos)
+	{
+		if (socket == invalidSocket)
+			return false;
+
+		char chunk[4096];
+		const int count(recv(socket, chunk, sizeof(chunk), 0));
+		if (count <= 0)
+		{
+#ifndef WIN32
+			if (count < 0 && errno == EINTR)
+				continue;
+#endif
+			return false;
+		}
+		buffer.append(chunk, count);
+	}
+
+	line.assign(buffer, 0, end);
+	buffer.erase(0, end + 1);
+	if (!line.empty() && *line.rbegin() == '\r')
+		line.erase(line.length() - 1);
+
+	return true;
+}
+
+//==========================================================================
+// Class:			Connection
+// Function:		WriteLine
+//
+// Description:		Sends a line of text to the other end of the connection.
+//
+// Input Arguments:
+//		line	= const std::string&, without the line ending
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool Connection::WriteLine(const std::string &line)
+{
+	if (socket == invalidSocket)
+		return false;
+
+	const std::string message(line + "\n");
+	size_t sent(0);
+	while (sent < message.length())
+	{
+#ifdef MSG_NOSIGNAL
+		const int flags(MSG_NOSIGNAL);// Report a closed connection instead of raising SIGPIPE
+#else
+		const int flags(0);
+#endif
+		const int count(send(socket, message.c_str() + sent,
+			static_cast<int>(message.length() - sent), flags));
+		if (count <= 0)
+		{
+#ifndef WIN32
+			if (count < 0 && errno == EINTR)
+				continue;
+#endif
+			return false;
+		}
+		sent += count;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			Listener
+// Function:		Listener
+//
+// Description:		Constructor for Listener class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Listener::Listener() : socket(invalidSocket), port(0)
+{
+}
+
+//==========================================================================
+// Class:			Listener
+// Function:		~Listener
+//
+// Description:		Destructor for Listener class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Listener::~Listener()
+{
+	if (socket != invalidSocket)
+		CloseSocket(socket);
+}
+
+//==========================================================================
+// Class:			Listener
+// Function:		Listen
+//
+// Description:		Starts listening for connections on the specified
+//					interface.  The protocol has no authentication, so
+//					callers should only listen on the loopback interface
+//					unless asked to do otherwise.
+//
+// Input Arguments:
+//		port	= const unsigned short&, zero to choose any free port
+//		address	= const std::string&, dotted IPv4 address of the interface
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool Listener::Listen(const unsigned short &port, const std::string &address)
+{
+	sockaddr_in socketAddress;
+	memset(&socketAddress, 0, sizeof(socketAddress));
+	socketAddress.sin_family = AF_INET;
+	socketAddress.sin_port = htons(port);
+	if (inet_pton(AF_INET, address.c_str(), &socketAddress.sin_addr) != 1)
+		return false;
+
+	InitializeSockets();
+	socket = ::socket(AF_INET, SOCK_STREAM, 0);
+	if (socket == invalidSocket)
+		return false;
+
+	int reuse(1);
+	setsockopt(socket, SOL_SOCKET, SO_REUSEADDR,
+		reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+	if (bind(socket, reinterpret_cast<sockaddr*>(&socketAddress), sizeof(socketAddress)) != 0 ||
+		listen(socket, 64) != 0)
+		return false;
+
+	socklen_t length(sizeof(socketAddress));
+	if (getsockname(socket, reinterpret_cast<sockaddr*>(&socketAddress), &length) != 0)
+		return false;
+
+	this->port = ntohs(socketAddress.sin_port);
+	return true;
+}
+
+//==========================================================================
+// Class:			Listener
+// Function:		Accept
+//
+// Description:		Waits for a new connection.
+//
+// Input Arguments:
+//		timeout	= const unsigned int& [ms]
+//
+// Output Arguments:
+//		connection	= Connection&
+//
+// Return Value:
+//		bool, true if a connection was accepted
+//
+//==========================================================================
+bool Listener::Accept(Connection &connection, const unsigned int &timeout)
+{
+	if (socket == invalidSocket)
+		return false;
+
+#ifdef WIN32
+	fd_set set;
+	FD_ZERO(&set);
+	FD_SET(socket, &set);
+	timeval wait;
+	wait.tv_sec = timeout / 1000;
+	wait.tv_usec = (timeout % 1000) * 1000;
+	if (select(0, &set, NULL, NULL, &wait) <= 0)
+		return false;
+#else
+	pollfd p;
+	p.fd = socket;
+	p.events = POLLIN;
+	if (poll(&p, 1, timeout) <= 0)
+		return false;
+#endif
+
+	const SocketHandle s(accept(socket, NULL, NULL));
+	if (s == invalidSocket)
+		return false;
+
+	connection.Close();
+	connection.socket = s;
+
+	int noDelay(1);
+	setsockopt(s, IPPROTO_TCP, TCP_NODELAY,
+		reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+	return true;
+}
@@ -0,0 +1,65 @@
+// File:  connection.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Minimal line-oriented TCP connection and listener, used to pass
+//        work and results between coordinator and worker processes.
+
+#ifndef CONNECTION_H_
+#define CONNECTION_H_
+
+// Standard C++ headers
+#include <string>
+
+#ifdef WIN32
+// Windows headers
+#include <winsock2.h>
+typedef SOCKET SocketHandle;
+#else
+typedef int SocketHandle;
+#endif
+
+class Connection
+{
+public:
+	Connection();
+	~Connection();
+
+	bool Connect(const std::string &host, const unsigned short &port);
+	void Close(void);
+
+	bool ReadLine(std::string &line);
+	bool WriteLine(const std::string &line);
+
+private:
+	friend class Listener;
+
+	SocketHandle socket;
+	std::string buffer;// Received but not yet returned
+
+	Connection(const Connection&);
+	Connection& operator=(const Connection&);
+};
+
+class Listener
+{
+public:
+	Listener();
+	~Listener();
+
+	// Zero to choose any free port; address is a dotted IPv4 address
+	// ("0.0.0.0" for all interfaces)
+	bool Listen(const unsigned short &port, const std::string &address = "127.0.0.1");
+	unsigned short GetPort(void) const { return port; };
+
+	// Returns false if no connection arrives within the timeout
+	bool Accept(Connection &connection, const unsigned int &timeout);// [ms]
+
+private:
+	SocketHandle socket;
+	unsigned short port;
+
+	Listener(const Listener&);
+	Listener& operator=(const Listener&);
+};
+
+#endif// CONNECTION_H_
@@ -0,0 +1,447 @@
+// File:  contentClassifier.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Quickly recognizes files which should not be counted even though
+//        their extensions match (binary files, generated code and minified
+//        code) by looking at the first few KB of the file.
+
+// Standard C++ headers
+#include <cstring>
+#include <cctype>
+#include <stdint.h>
+
+// SIMD headers
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CONTENT_CLASSIFIER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define CONTENT_CLASSIFIER_NEON
+#include <arm_neon.h>
+#endif
+
+// Local headers
+#include "contentClassifier.h"
+#include "textDecoder.h"
+
+namespace ContentClassifier
+{
+
+const size_t sampleSize = 4096;
+
+// Markers are only searched for in the comments at the top of the file
+// (before any code), within this many bytes of the start
+static const size_t markerSearchSize = 1024;
+static const char* const generatedMarkers[] = { "do not edit", "@generated",
+	"autogenerated", "auto-generated", "automatically generated",
+	"made by gnu bison" };
+
+// Text (in any encoding) rarely contains control characters other than
+// whitespace; these are the percentages of the sample which mark a file as
+// binary, for samples which are and aren't valid UTF-8.  Invalid UTF-8 alone
+// is not enough, since legacy 8-bit encodings (Latin-1, CP1252) are common.
+static const size_t binaryControlPercent = 10;
+static const size_t binaryControlPercentInvalidUtf8 = 1;
+
+// Comments are recognized without knowing the language, so common line and
+// block comment indicators are accepted ('#' only when followed by
+// whitespace or another '#' or '!', to exclude preprocessor directives)
+static const char* const lineCommentIndicators[] = { "//", "--", ";", "%", "'", "rem " };
+static const char* const blockCommentStarts[] = { "/*", "<!--", "\"\"\"", "(*", "{-" };
+static const char* const blockCommentEnds[] = { "*/", "-->", "\"\"\"", "*)", "-}" };
+
+// Hand-written code rarely averages more than about 80 characters per line
+static const size_t minifiedMinimumSize = 1024;
+static const size_t minifiedLineLength = 200;
+
+//==========================================================================
+// Namespace:		ContentClassifier
+// Function:		Classify
+//
+// Description:		Determines the type of content from the start of a file.
+//					Checks are ordered from cheapest to most expensive.
+//					UTF-16 text (which contains NUL bytes) is recognized by
+//					its byte order mark and always treated as source.  Other
+//					files are binary if they contain NUL bytes or too many
+//					control characters (fewer are needed if the data isn't
+//					valid UTF-8).  Generated files are recognized by markers
+//					in the comments at the top of the file.
+//
+// Input Arguments:
+//		data		= const char*
+//		length		= const size_t&, at most sampleSize bytes are examined
+//		complete	= const bool&, false if the data is only the start of
+//					  the file
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		ContentType
+//
+//==========================================================================
+ContentType Classify(const char *data, const size_t &length, const bool &complete)
+{
+	const size_t sampleLength(length < sampleSize ? length : sampleSize);
+	const bool sampleComplete(complete && sampleLength == length);
+
+	size_t bomLength;
+	if (TextDecoder::DetectEncoding(data, sampleLength, bomLength) != TextDecoder::EncodingUtf8)
+		return ContentSource;
+
+	if (memchr(data, '\0', sampleLength))
+		return ContentBinary;
+
+	const size_t controlCount(CountControlCharacters(data, sampleLength));
+	if (controlCount * 100 > sampleLength * binaryControlPercent ||
+		(controlCount * 100 > sampleLength * binaryControlPercentInvalidUtf8 &&
+		!IsValidUtf8(data, sampleLength, sampleComplete)))
+		return ContentBinary;
+
+	const size_t markerLength(sampleLength < markerSearchSize ? sampleLength : markerSearchSize);
+	const std::string header(GetLeadingComments(data, markerLength));
+
+	// Ignore markers quoted in the comments
+	unsigned int i;
+	size_t position;
+	for (i = 0; i < sizeof(generatedMarkers) / sizeof(generatedMarkers[0]); i++)
+	{
+		position = header.find(generatedMarkers[i]);
+		while (position != std::string::npos)
+		{
+			if (position == 0 || header[position - 1] != '"')
+				return ContentGenerated;
+			position = header.find(generatedMarkers[i], position + 1);
+		}
+	}
+
+	if (sampleLength >= minifiedMinimumSize)
+	{
+		size_t lineCount(1);
+		const char *position(data), *end(data + sampleLength);
+		while ((position = static_cast<const char*>(memchr(position, '\n', end - position))))
+		{
+			lineCount++;
+			position++;
+		}
+
+		if (sampleLength / lineCount > minifiedLineLength)
+			return ContentMinified;
+	}
+
+	return ContentSource;
+}
+
+//==========================================================================
+// Namespace:		ContentClassifier
+// Function:		GetLeadingComments
+//
+// Description:		Returns the text (in lower case) of the comments at the
+//					top of the file, up to the first line containing code.
+//					Blank lines may appear between the comments.
+//
+// Input Arguments:
+//		data	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string GetLeadingComments(const char *data, const size_t &length)
+{
+	std::string text(data, length), comments;
+	std::string::iterator it;
+	for (it = text.begin(); it != text.end(); ++it)
+		*it = static_cast<char>(tolower(static_cast<unsigned char>(*it)));
+
+	const char *blockEnd(NULL);// Non-NULL while inside a block comment
+	size_t lineStart(0);
+	if (text.compare(0, 3, "\xef\xbb\xbf") == 0)
+		lineStart = 3;
+
+	unsigned int i;
+	while (lineStart < text.length())
+	{
+		size_t lineEnd(text.find('\n', lineStart));
+		if (lineEnd == std::string::npos)
+			lineEnd = text.length();
+
+		size_t position(lineStart);
+		while (position < lineEnd)
+		{
+			if (blockEnd)
+			{
+				const size_t end(text.find(blockEnd, position));
+				if (end == std::string::npos || end >= lineEnd)
+				{
+					comments.append(text, position, lineEnd - position);
+					position = lineEnd;
+					break;
+				}
+
+				comments.append(text, position, end - position);
+				position = end + strlen(blockEnd);
+				blockEnd = NULL;
+				continue;
+			}
+
+			position = text.find_first_not_of(" \t\r\f\v", position);
+			if (position == std::string::npos || position >= lineEnd)
+				break;
+
+			for (i = 0; i < sizeof(blockCommentStarts) / sizeof(blockCommentStarts[0]); i++)
+			{
+				if (text.compare(position, strlen(blockCommentStarts[i]), blockCommentStarts[i]) == 0)
+				{
+					position += strlen(blockCommentStarts[i]);
+					blockEnd = blockCommentEnds[i];
+					break;
+				}
+			}
+
+			if (blockEnd)
+				continue;
+
+			bool lineComment(text[position] == '#' && (position + 1 == lineEnd ||
+				strchr(" \t\r#!", text[position + 1])));
+			for (i = 0; !lineComment && i < sizeof(lineCommentIndicators) / sizeof(lineCommentIndicators[0]); i++)
+				lineComment = text.compare(position, strlen(lineCommentIndicators[i]), lineCommentIndicators[i]) == 0;
+
+			if (!lineComment)
+				return comments;// Code
+
+			comments.append(text, position, lineEnd - position);
+			position = lineEnd;
+		}
+
+		comments.push_back('\n');
+		lineStart = lineEnd + 1;
+	}
+
+	return comments;
+}
+
+//==========================================================================
+// Namespace:		ContentClassifier
+// Function:		CountControlCharacters
+//
+// Description:		Counts the control characters other than whitespace
+//					(including DEL).
+//
+// Input Arguments:
+//		data	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//==========================================================================
+size_t CountControlCharacters(const char *data, const size_t &length)
+{
+	size_t count(0), i;
+	for (i = 0; i < length; i++)
+	{
+		const unsigned char c(static_cast<unsigned char>(data[i]));
+		if ((c < 0x20 && (c < '\t' || c > '\r')) || c == 0x7f)
+			count++;
+	}
+
+	return count;
+}
+
+//==========================================================================
+// Namespace:		ContentClassifier
+// Function:		GetName
+//
+// Description:		Returns a description of the content type for reports.
+//
+// Input Arguments:
+//		type	= const ContentType&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string GetName(const ContentType &type)
+{
+	switch (type)
+	{
+	case ContentBinary:
+		return "binary";
+
+	case ContentGenerated:
+		return "generated";
+
+	case ContentMinified:
+		return "minified";
+
+	default:
+		return "source";
+	}
+}
+
+//==========================================================================
+// Namespace:		ContentClassifier
+// Function:		IsValidUtf8
+//
+// Description:		Checks for valid UTF-8 (rejecting overlong forms,
+//					surrogates and values beyond U+10FFFF).  Runs of ASCII
+//					are checked 16 bytes at a time with SSE2 or NEON where
+//					available, and eight bytes at a time otherwise.
+//
+// Input Arguments:
+//		data		= const char*
+//		length		= const size_t&
+//		complete	= const bool&, if false, a sequence cut off by the end
+//					  of the data is accepted
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool IsValidUtf8(const char *data, const size_t &length, const bool &complete)
+{
+	const unsigned char *p(reinterpret_cast<const unsigned char*>(data));
+	const unsigned char *end(p + length);
+	while (p < end)
+	{
+#if defined(CONTENT_CLASSIFIER_SSE2)
+		if (end - p >= 16)
+		{
+			const __m128i block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+			if (_mm_movemask_epi8(block) == 0)
+			{
+				p += 16;
+				continue;
+			}
+		}
+#elif defined(CONTENT_CLASSIFIER_NEON)
+		if (end - p >= 16)
+		{
+			if (vmaxvq_u8(vld1q_u8(p)) < 0x80)
+			{
+				p += 16;
+				continue;
+			}
+		}
+#endif
+		if (end - p >= 8)
+		{
+			uint64_t word;
+			memcpy(&word, p, sizeof(word));
+			if ((word & 0x8080808080808080ULL) == 0)
+			{
+				p += 8;
+				continue;
+			}
+		}
+
+		if (*p < 0x80)
+		{
+			p++;
+			continue;
+		}
+
+		size_t count;
+		unsigned char minimumSecond(0x80), maximumSecond(0xbf);
+		if (*p >= 0xc2 && *p <= 0xdf)
+			count = 1;
+		else if (*p >= 0xe0 && *p <= 0xef)
+		{
+			count = 2;
+			if (*p == 0xe0)
+				minimumSecond = 0xa0;// Overlong
+			else if (*p == 0xed)
+				maximumSecond = 0x9f;// Surrogates
+		}
+		else if (*p >= 0xf0 && *p <= 0xf4)
+		{
+			count = 3;
+			if (*p == 0xf0)
+				minimumSecond = 0x90;// Overlong
+			else if (*p == 0xf4)
+				maximumSecond = 0x8f;// Beyond U+10FFFF
+		}
+		else
+			return false;
+
+		size_t i;
+		for (i = 1; i <= count; i++)
+		{
+			if (p + i == end)
+				return !complete;
+
+			const unsigned char minimum(i == 1 ? minimumSecond : 0x80);
+			const unsigned char maximum(i == 1 ? maximumSecond : 0xbf);
+			if (p[i] < minimum || p[i] > maximum)
+				return false;
+		}
+
+		p += count + 1;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			SkipCounter
+// Function:		SkipCounter
+//
+// Description:		Constructor for SkipCounter class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+SkipCounter::SkipCounter()
+{
+	unsigned int i;
+	for (i = 0; i < ContentTypeCount; i++)
+	{
+		fileCount[i] = 0;
+		bytes[i] = 0;
+	}
+}
+
+//==========================================================================
+// Class:			SkipCounter
+// Function:		Add
+//
+// Description:		Records a file which was not counted.
+//
+// Input Arguments:
+//		type	= const ContentType&
+//		bytes	= const unsigned long long&, size of the file
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SkipCounter::Add(const ContentType &type, const unsigned long long &bytes)
+{
+	fileCount[type].fetch_add(1, std::memory_order_relaxed);
+	this->bytes[type].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+}
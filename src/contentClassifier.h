@@ -0,0 +1,59 @@
+// File:  contentClassifier.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Quickly recognizes files which should not be counted even though
+//        their extensions match (binary files, generated code and minified
+//        code) by looking at the first few KB of the file.
+
+#ifndef CONTENT_CLASSIFIER_H_
+#define CONTENT_CLASSIFIER_H_
+
+// Standard C++ headers
+#include <string>
+#include <atomic>
+
+namespace ContentClassifier
+{
+
+enum ContentType
+{
+	ContentSource,
+	ContentBinary,// Contains NUL bytes or many control characters
+	ContentGenerated,// Marked as generated near the top of the file
+	ContentMinified,// Very long lines
+
+	ContentTypeCount
+};
+
+// Number of bytes at the start of a file which are examined
+extern const size_t sampleSize;
+
+// complete is false if the data is only the start of the file
+ContentType Classify(const char *data, const size_t &length, const bool &complete);
+std::string GetName(const ContentType &type);
+
+// Comments at the top of the file, in lower case, for finding markers
+std::string GetLeadingComments(const char *data, const size_t &length);
+
+bool IsValidUtf8(const char *data, const size_t &length, const bool &complete);
+size_t CountControlCharacters(const char *data, const size_t &length);
+
+// Thread-safe totals of files which were not counted
+class SkipCounter
+{
+public:
+	SkipCounter();
+
+	void Add(const ContentType &type, const unsigned long long &bytes);
+
+	unsigned long long GetFileCount(const ContentType &type) const { return fileCount[type]; };
+	unsigned long long GetBytes(const ContentType &type) const { return bytes[type]; };
+
+private:
+	std::atomic<unsigned long long> fileCount[ContentTypeCount];
+	std::atomic<unsigned long long> bytes[ContentTypeCount];
+};
+
+}
+
+#endif// CONTENT_CLASSIFIER_H_
@@ -0,0 +1,396 @@
+// File:  coordinator.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Splits a search into shards, hands them out to worker processes
+//        (local or on other machines) over TCP and combines their results.
+//
+//        Protocol (one line per message):
+//          worker:       NEXT
+//          coordinator:  SHARD <index> <count> <path|subtree>  or  DONE
+//          worker:       RESULT <index> files <n> blank <n> comment <n> code <n>
+//        Shards assigned to a worker which disconnects before returning
+//        its result are handed to the next worker to ask for one.
+
+#ifdef WIN32
+// Windows headers
+#include <winsock2.h>// Must precede windows.h
+#include <windows.h>
+#else
+// *nix headers
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <spawn.h>
+#include <unistd.h>
+#endif
+
+// Standard C++ headers
+#include <iostream>
+#include <sstream>
+
+// Local headers
+#include "coordinator.h"
+#include "partialResults.h"
+#include "fileProcessor.h"
+
+#ifndef WIN32
+extern char **environ;
+#endif
+
+//==========================================================================
+// Class:			Coordinator
+// Function:		Coordinator
+//
+// Description:		Constructor for Coordinator class.
+//
+// Input Arguments:
+//		shardCount		= const unsigned int&
+//		shardBySubtree	= const bool&, true to assign whole top-level
+//						  directories to shards, false to assign individual
+//						  files by hashing their paths
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Coordinator::Coordinator(const unsigned int &shardCount,
+	const bool &shardBySubtree) : shardCount(shardCount),
+	shardBySubtree(shardBySubtree), shardComplete(shardCount, false)
+{
+	completeShardCount = 0;
+	activeConnectionCount = 0;
+	PartialResults::Clear(total);
+
+	unsigned int i;
+	for (i = 0; i < shardCount; i++)
+		pendingShards.push_back(i);
+}
+
+//==========================================================================
+// Class:			Coordinator
+// Function:		~Coordinator
+//
+// Description:		Destructor for Coordinator class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Coordinator::~Coordinator()
+{
+	{
+		// Tell any workers still waiting for work to give up
+		std::lock_guard<std::mutex> lock(mutex);
+		pendingShards.clear();
+		completeShardCount = shardCount;
+		shardsChanged.notify_all();
+	}
+
+	unsigned int i;
+	for (i = 0; i < connectionThreads.size(); i++)
+		connectionThreads[i].join();
+
+	WaitForLocalWorkers();
+}
+
+//==========================================================================
+// Class:			Coordinator
+// Function:		Listen
+//
+// Description:		Starts listening for workers.
+//
+// Input Arguments:
+//		port	= const unsigned short&, zero to choose any free port
+//		address	= const std::string&, dotted IPv4 address of the interface
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool Coordinator::Listen(const unsigned short &port, const std::string &address)
+{
+	if (address == "0.0.0.0")
+		workerAddress = "127.0.0.1";
+	else
+		workerAddress = address;
+
+	return listener.Listen(port, address);
+}
+
+//==========================================================================
+// Class:			Coordinator
+// Function:		StartLocalWorkers
+//
+// Description:		Starts the specified number of worker processes, which
+//					connect to this coordinator over the interface it is
+//					listening on (or the loopback interface, if all).
+//
+// Input Arguments:
+//		executable		= const std::string&, path to this program
+//		configFileName	= const std::string&
+//		count			= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if all workers were started
+//
+//==========================================================================
+bool Coordinator::StartLocalWorkers(const std::string &executable,
+	const std::string &configFileName, const unsigned int &count)
+{
+	std::ostringstream address;
+	address << workerAddress << ":" << GetPort();
+
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+#ifdef WIN32
+		std::string commandLine("\"" + executable + "\" worker \"" + configFileName
+			+ "\" --connect " + address.str());
+		STARTUPINFOA startupInfo;
+		PROCESS_INFORMATION processInfo;
+		ZeroMemory(&startupInfo, sizeof(startupInfo));
+		startupInfo.cb = sizeof(startupInfo);
+		if (!CreateProcessA(NULL, &commandLine[0], NULL, NULL, FALSE, 0, NULL,
+			NULL, &startupInfo, &processInfo))
+			return false;
+
+		CloseHandle(processInfo.hThread);
+		localWorkers.push_back(processInfo.hProcess);
+#else
+		std::string mode("worker"), connect("--connect"), host(address.str());
+		std::string program(executable), config(configFileName);
+		char *arguments[] = { &program[0], &mode[0], &config[0], &connect[0], &host[0], NULL };
+
+		pid_t pid;
+		if (posix_spawn(&pid, executable.c_str(), NULL, NULL, arguments, environ) != 0)
+			return false;
+
+		localWorkers.push_back(pid);
+#endif
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			Coordinator
+// Function:		Run
+//
+// Description:		Accepts connections from workers until the results for
+//					every shard have been received.  Fails if local workers
+//					were started and all of them have exited without
+//					finishing the job.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		statistics	= LineCounter::Statistics&, combined results
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool Coordinator::Run(LineCounter::Statistics &statistics)
+{
+	const bool haveLocalWorkers(!localWorkers.empty());
+	for (;;)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (completeShardCount == shardCount)
+				break;
+
+			if (haveLocalWorkers && activeConnectionCount == 0 && !LocalWorkersRunning())
+			{
+				std::lock_guard<std::mutex> outputLock(FileProcessor::outputMutex);
+				std::cout << "All workers exited with " << shardCount - completeShardCount
+					<< " shard(s) unfinished" << std::endl;
+				return false;
+			}
+		}
+
+		Connection *connection(new Connection);
+		if (listener.Accept(*connection, 200))
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			activeConnectionCount++;
+			connectionThreads.push_back(std::thread(&Coordinator::ServeWorker, this, connection));
+		}
+		else
+			delete connection;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	statistics = total;
+	return true;
+}
+
+//==========================================================================
+// Class:			Coordinator
+// Function:		ServeWorker
+//
+// Description:		Connection thread function.  Hands out shards to the
+//					worker and collects its results.
+//
+// Input Arguments:
+//		connection	= Connection*, deleted when finished
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Coordinator::ServeWorker(Connection *connection)
+{
+	std::string line;
+	while (connection->ReadLine(line) && line == "NEXT")
+	{
+		unsigned int shard;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+
+			// Wait for a shard, which may come from a worker that fails
+			while (pendingShards.empty() && completeShardCount < shardCount)
+				shardsChanged.wait(lock);
+
+			if (pendingShards.empty())
+				break;
+
+			shard = pendingShards.front();
+			pendingShards.pop_front();
+		}
+
+		std::ostringstream request;
+		request << "SHARD " << shard << " " << shardCount << " "
+			<< (shardBySubtree ? "subtree" : "path");
+
+		LineCounter::Statistics partial;
+		std::istringstream reply;
+		std::string keyword;
+		unsigned int replyShard(shardCount);
+		if (connection->WriteLine(request.str()) && connection->ReadLine(line))
+		{
+			reply.str(line);
+			reply >> keyword >> replyShard;
+			std::string remainder;
+			std::getline(reply, remainder);
+			if (keyword != "RESULT" || replyShard != shard ||
+				!PartialResults::Parse(remainder, partial))
+				replyShard = shardCount;
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (replyShard != shard)
+		{
+			// Give the shard to someone else
+			pendingShards.push_back(shard);
+			shardsChanged.notify_all();
+			break;
+		}
+
+		if (!shardComplete[shard])
+		{
+			shardComplete[shard] = true;
+			completeShardCount++;
+			PartialResults::Add(partial, total);
+		}
+		shardsChanged.notify_all();
+	}
+
+	connection->WriteLine("DONE");
+	delete connection;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	activeConnectionCount--;
+}
+
+//==========================================================================
+// Class:			Coordinator
+// Function:		LocalWorkersRunning
+//
+// Description:		Checks to see if any of the local workers are still
+//					running.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool Coordinator::LocalWorkersRunning(void)
+{
+	unsigned int i;
+	for (i = 0; i < localWorkers.size(); i++)
+	{
+#ifdef WIN32
+		if (WaitForSingleObject(localWorkers[i], 0) == WAIT_TIMEOUT)
+			return true;
+#else
+		if (localWorkers[i] > 0)
+		{
+			int status;
+			if (waitpid(localWorkers[i], &status, WNOHANG) == 0)
+				return true;
+			localWorkers[i] = 0;// Reaped
+		}
+#endif
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Class:			Coordinator
+// Function:		WaitForLocalWorkers
+//
+// Description:		Waits for the local workers to exit.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Coordinator::WaitForLocalWorkers(void)
+{
+	unsigned int i;
+	for (i = 0; i < localWorkers.size(); i++)
+	{
+#ifdef WIN32
+		WaitForSingleObject(localWorkers[i], INFINITE);
+		CloseHandle(localWorkers[i]);
+#else
+		if (localWorkers[i] > 0)
+		{
+			int status;
+			waitpid(localWorkers[i], &status, 0);
+		}
+#endif
+	}
+	localWorkers.clear();
+}
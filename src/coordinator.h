@@ -0,0 +1,68 @@
+// File:  coordinator.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Splits a search into shards, hands them out to worker processes
+//        (local or on other machines) over TCP and combines their results.
+
+#ifndef COORDINATOR_H_
+#define COORDINATOR_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Local headers
+#include "lineCounter.h"
+#include "connection.h"
+
+class Coordinator
+{
+public:
+	Coordinator(const unsigned int &shardCount, const bool &shardBySubtree);
+	~Coordinator();
+
+	// Local workers connect to the same address, or to the loopback interface
+	// when listening on all interfaces
+	bool Listen(const unsigned short &port, const std::string &address = "127.0.0.1");
+	unsigned short GetPort(void) const { return listener.GetPort(); };
+
+	// Starts worker processes on this machine which connect back to us
+	bool StartLocalWorkers(const std::string &executable,
+		const std::string &configFileName, const unsigned int &count);
+
+	// Waits until every shard has been counted
+	bool Run(LineCounter::Statistics &statistics);
+
+private:
+	const unsigned int shardCount;
+	const bool shardBySubtree;
+
+	Listener listener;
+	std::string workerAddress;// For local workers to connect to
+
+	std::mutex mutex;
+	std::condition_variable shardsChanged;
+	std::deque<unsigned int> pendingShards;
+	std::vector<bool> shardComplete;
+	unsigned int completeShardCount;
+	unsigned int activeConnectionCount;
+	LineCounter::Statistics total;
+
+	std::vector<std::thread> connectionThreads;
+
+#ifdef WIN32
+	std::vector<void*> localWorkers;// Process handles
+#else
+	std::vector<int> localWorkers;// Process IDs
+#endif
+
+	void ServeWorker(Connection *connection);
+	bool LocalWorkersRunning(void);
+	void WaitForLocalWorkers(void);
+};
+
+#endif// COORDINATOR_H_
@@ -0,0 +1,86 @@
+// File:  deadline.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Time limit for a run, checked by the search, read and parse stages
+//        so they can stop cleanly when the time is up.
+
+// Local headers
+#include "deadline.h"
+
+//==========================================================================
+// Class:			Deadline
+// Function:		Deadline
+//
+// Description:		Constructor for Deadline class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Deadline::Deadline() : passed(false)
+{
+	isSet = false;
+	milliseconds = 0;
+}
+
+//==========================================================================
+// Class:			Deadline
+// Function:		Set
+//
+// Description:		Sets the deadline relative to the current time.
+//
+// Input Arguments:
+//		milliseconds	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Deadline::Set(const unsigned int &milliseconds)
+{
+	this->milliseconds = milliseconds;
+	time = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+	passed = false;
+	isSet = true;
+}
+
+//==========================================================================
+// Class:			Deadline
+// Function:		HasPassed
+//
+// Description:		Checks to see if the time is up.  Once it has passed, the
+//					clock is no longer read.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool Deadline::HasPassed(void) const
+{
+	if (!isSet)
+		return false;
+
+	if (passed.load(std::memory_order_relaxed))
+		return true;
+
+	if (std::chrono::steady_clock::now() < time)
+		return false;
+
+	passed.store(true, std::memory_order_relaxed);
+	return true;
+}
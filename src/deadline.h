@@ -0,0 +1,34 @@
+// File:  deadline.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Time limit for a run, checked by the search, read and parse stages
+//        so they can stop cleanly when the time is up.
+
+#ifndef DEADLINE_H_
+#define DEADLINE_H_
+
+// Standard C++ headers
+#include <chrono>
+#include <atomic>
+
+class Deadline
+{
+public:
+	Deadline();
+
+	// Starts counting from now
+	void Set(const unsigned int &milliseconds);
+	bool IsSet(void) const { return isSet; };
+	unsigned int GetMilliseconds(void) const { return milliseconds; };
+
+	// Thread-safe; always false if no deadline is set
+	bool HasPassed(void) const;
+
+private:
+	bool isSet;
+	unsigned int milliseconds;
+	std::chrono::steady_clock::time_point time;
+	mutable std::atomic<bool> passed;
+};
+
+#endif// DEADLINE_H_
@@ -0,0 +1,102 @@
+// File:  deviceInfo.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Identifies the kind of storage device holding a file, so reads can
+//        be scheduled to suit it.
+
+#ifdef WIN32
+// Windows headers
+#include <windows.h>
+#elif defined(__linux__)
+// *nix headers
+#include <sys/types.h>
+#include <sys/sysmacros.h>
+#include <sys/vfs.h>
+#endif
+
+// Standard C++ headers
+#include <fstream>
+#include <sstream>
+
+// Local headers
+#include "deviceInfo.h"
+
+namespace DeviceInfo
+{
+
+//==========================================================================
+// Class:			None
+// Function:		GetType
+//
+// Description:		Determines the type of device holding the specified file.
+//					On Linux, network file systems are recognized from the
+//					file system type and rotational disks from the block
+//					device's queue attributes.  Anything unrecognized is
+//					assumed to be solid state.
+//
+// Input Arguments:
+//		path	= const std::string&, any file on the device
+//		device	= const unsigned long long&, device ID (st_dev)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		DeviceType
+//
+//==========================================================================
+DeviceType GetType(const std::string &path, const unsigned long long &device)
+{
+#ifdef WIN32
+	(void)device;
+	if (path.length() > 2 && path[1] == ':')
+	{
+		const std::string root(path.substr(0, 2) + "\\");
+		if (GetDriveTypeA(root.c_str()) == DRIVE_REMOTE)
+			return DeviceNetwork;
+	}
+	else if (path.compare(0, 2, "\\\\") == 0 || path.compare(0, 2, "//") == 0)
+		return DeviceNetwork;
+#elif defined(__linux__)
+	struct statfs fs;
+	if (statfs(path.c_str(), &fs) == 0)
+	{
+		switch ((unsigned long)fs.f_type)
+		{
+		case 0x6969:// NFS
+		case 0x517B:// SMB
+		case 0xFF534D42:// CIFS
+		case 0xFE534D42:// SMB2
+		case 0x00C36400:// Ceph
+		case 0x01021997:// 9P
+		case 0x65735546:// FUSE (sshfs and the like, usually remote)
+			return DeviceNetwork;
+		default:
+			break;
+		}
+	}
+
+	// Devices without a block device (tmpfs, overlay, etc.) have major number zero
+	if (major(device) == 0)
+		return DeviceSolidState;
+
+	// Partitions don't have queue attributes of their own; they are found
+	// on the parent disk, one level up
+	std::ostringstream base;
+	base << "/sys/dev/block/" << major(device) << ":" << minor(device);
+	std::ifstream file((base.str() + "/queue/rotational").c_str());
+	if (!file.is_open())
+		file.open((base.str() + "/../queue/rotational").c_str());
+
+	char rotational('0');
+	if (file >> rotational && rotational == '1')
+		return DeviceRotational;
+#else
+	(void)path;
+	(void)device;
+#endif
+
+	return DeviceSolidState;
+}
+
+}
@@ -0,0 +1,27 @@
+// File:  deviceInfo.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Identifies the kind of storage device holding a file, so reads can
+//        be scheduled to suit it.
+
+#ifndef DEVICE_INFO_H_
+#define DEVICE_INFO_H_
+
+// Standard C++ headers
+#include <string>
+
+namespace DeviceInfo
+{
+
+enum DeviceType
+{
+	DeviceSolidState,
+	DeviceRotational,
+	DeviceNetwork
+};
+
+DeviceType GetType(const std::string &path, const unsigned long long &device);
+
+}
+
+#endif// DEVICE_INFO_H_
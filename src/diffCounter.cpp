@@ -0,0 +1,555 @@
+// File:  diffCounter.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Counts the lines added and removed by a unified diff, by category.
+//        The parser state at each hunk is found by parsing the unchanged
+//        lines before it from the changed version of the file, when it can
+//        be found; the old version's state follows from the same lines,
+//        since they are identical in both versions.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cctype>
+
+// Local headers
+#include "diffCounter.h"
+#include "lineTypeRecorder.h"
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		DiffCounter
+//
+// Description:		Constructor for DiffCounter class.
+//
+// Input Arguments:
+//		diff					= std::istream&, unified diff
+//		root					= const std::string&, directory which the
+//								  paths in the diff are relative to
+//		commentIndicators		= const std::vector<std::string>&
+//		blockCommentIndicators	= const std::vector<std::pair<std::string, std::string> >&
+//		continuationIndicators	= const std::vector<std::string>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+DiffCounter::DiffCounter(std::istream &diff, const std::string &root,
+	const std::vector<std::string> &commentIndicators,
+	const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
+	const std::vector<std::string> &continuationIndicators) : diff(diff), root(root),
+	oldParser(commentIndicators, blockCommentIndicators, continuationIndicators),
+	newParser(commentIndicators, blockCommentIndicators, continuationIndicators)
+{
+	haveOldPath = false;
+	inFile = false;
+	oldRemaining = 0;
+	newRemaining = 0;
+	oldLine = 0;
+	newLine = 0;
+	failed = false;
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		NextFile
+//
+// Description:		Advances to the next file in the diff.  Anything other
+//					than file headers and hunks (such as git's extended
+//					headers) is ignored.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		path	= std::string&, without git's "a/" or "b/" prefix
+//
+// Return Value:
+//		bool, true if a file was found, false at the end of the diff or on failure
+//
+//==========================================================================
+bool DiffCounter::NextFile(std::string &path)
+{
+	if (inFile)
+		ReadFile(NULL);
+
+	std::string line;
+	while (!failed && std::getline(diff, line))
+	{
+		if (haveOldPath && line.compare(0, 4, "+++ ") == 0)
+		{
+			newPath = GetPath(line.substr(4), "b/");
+			haveOldPath = false;
+			inFile = true;
+			path = newPath.empty() ? oldPath : newPath;
+			return true;
+		}
+
+		haveOldPath = line.compare(0, 4, "--- ") == 0;
+		if (haveOldPath)
+			oldPath = GetPath(line.substr(4), "a/");
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		CountFile
+//
+// Description:		Counts the changes to the current file.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		delta	= Delta&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void DiffCounter::CountFile(Delta &delta)
+{
+	delta.added.blankLines = 0;
+	delta.added.commentLines = 0;
+	delta.added.codeLines = 0;
+	delta.added.fileCount = 0;
+	delta.removed = delta.added;
+	delta.exact = true;
+
+	if (inFile)
+		ReadFile(&delta);
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		ReadFile
+//
+// Description:		Reads the hunks for the current file, up to the header
+//					of the next file.
+//
+// Input Arguments:
+//		delta	= Delta*, NULL to skip the file
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void DiffCounter::ReadFile(Delta *delta)
+{
+	inFile = false;
+	if (delta)
+	{
+		oldParser.Reset();
+		newParser.Reset();
+		oldLine = 0;
+		newLine = 0;
+
+		if (!root.empty() && !newPath.empty())
+		{
+			changedFile.clear();
+			changedFile.open((root + "/" + newPath).c_str(), std::ios::in | std::ios::binary);
+		}
+	}
+
+	std::string line;
+	while (std::getline(diff, line))
+	{
+		if (oldRemaining > 0 || newRemaining > 0)
+		{
+			if (!ProcessHunkLine(line, delta))
+				break;
+		}
+		else if (line.compare(0, 3, "@@ ") == 0)
+		{
+			if (!BeginHunk(line, delta))
+				break;
+		}
+		else if (line.compare(0, 4, "--- ") == 0)
+		{
+			oldPath = GetPath(line.substr(4), "a/");
+			haveOldPath = true;
+			break;
+		}
+	}
+
+	// Malformed hunk, or the diff ended part way through one
+	if (oldRemaining > 0 || newRemaining > 0)
+		failed = true;
+
+	if (!delta)
+		return;
+
+	// The changes may also affect lines after the last hunk
+	while (changedFile.is_open() && !StatesMatch() && ReadChangedLine())
+		ParseUnchangedLine(changedLine.data(), changedLine.data() + changedLine.length(), *delta);
+
+	if (!changedFile.is_open() && !StatesMatch())
+		delta->exact = false;
+	changedFile.close();
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		BeginHunk
+//
+// Description:		Reads a hunk header ("@@ -<start>,<count> +<start>,<count> @@")
+//					and brings the parsers to the start of the hunk.
+//
+// Input Arguments:
+//		header	= const std::string&
+//		delta	= Delta*, NULL if the file is being skipped
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false if the header is malformed
+//
+//==========================================================================
+bool DiffCounter::BeginHunk(const std::string &header, Delta *delta)
+{
+	const char *s(header.c_str() + 3);
+	unsigned long long oldStart, oldCount, newStart, newCount;
+	if (!ParseRange(s, '-', oldStart, oldCount) || !ParseRange(s, '+', newStart, newCount) ||
+		(oldStart == 0 && oldCount > 0) || (newStart == 0 && newCount > 0))
+	{
+		failed = true;
+		return false;
+	}
+
+	oldRemaining = oldCount;
+	newRemaining = newCount;
+	if (!delta)
+		return true;
+
+	// For empty ranges, the start is the line before the hunk
+	const unsigned long long oldBefore(oldCount == 0 ? oldStart : oldStart - 1);
+	const unsigned long long newBefore(newCount == 0 ? newStart : newStart - 1);
+
+	if (changedFile.is_open() && !SkipToLine(oldBefore, newBefore, *delta))
+	{
+		changedFile.close();
+		delta->exact = false;
+	}
+
+	if (!changedFile.is_open())
+	{
+		// Only the start of the file is known without the unchanged lines
+		if (oldBefore > 0 || newBefore > 0)
+			delta->exact = false;
+
+		oldParser.Reset();
+		newParser.Reset();
+		oldLine = oldBefore;
+		newLine = newBefore;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		ProcessHunkLine
+//
+// Description:		Counts a line from the body of a hunk.
+//
+// Input Arguments:
+//		line	= const std::string&
+//		delta	= Delta*, NULL if the file is being skipped
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false if the line doesn't fit the hunk
+//
+//==========================================================================
+bool DiffCounter::ProcessHunkLine(const std::string &line, Delta *delta)
+{
+	// "\ No newline at end of file"
+	if (!line.empty() && line[0] == '\\')
+		return true;
+
+	// Some tools remove the trailing space from empty context lines
+	const char marker(line.empty() ? ' ' : line[0]);
+	const char *begin(line.data() + (line.empty() ? 0 : 1));
+	const char *end(line.data() + line.length());
+
+	if (marker == ' ' && oldRemaining > 0 && newRemaining > 0)
+	{
+		oldRemaining--;
+		newRemaining--;
+		if (delta)
+		{
+			CheckChangedLine(begin, end, *delta);
+			ParseUnchangedLine(begin, end, *delta);
+			oldLine++;
+			newLine++;
+		}
+	}
+	else if (marker == '-' && oldRemaining > 0)
+	{
+		oldRemaining--;
+		if (delta)
+		{
+			LineCounter::CountLine(oldParser.ParseLine(begin, end), delta->removed);
+			oldLine++;
+		}
+	}
+	else if (marker == '+' && newRemaining > 0)
+	{
+		newRemaining--;
+		if (delta)
+		{
+			CheckChangedLine(begin, end, *delta);
+			LineCounter::CountLine(newParser.ParseLine(begin, end), delta->added);
+			newLine++;
+		}
+	}
+	else
+	{
+		failed = true;
+		return false;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		SkipToLine
+//
+// Description:		Parses the unchanged lines between the previous hunk and
+//					the next one from the changed file.
+//
+// Input Arguments:
+//		oldTarget	= const unsigned long long&, lines before the next hunk
+//					  in the old version of the file
+//		newTarget	= const unsigned long long&, lines before the next hunk
+//					  in the new version of the file
+//
+// Output Arguments:
+//		delta	= Delta&
+//
+// Return Value:
+//		bool, true for success, false if the file doesn't match the diff
+//
+//==========================================================================
+bool DiffCounter::SkipToLine(const unsigned long long &oldTarget,
+	const unsigned long long &newTarget, Delta &delta)
+{
+	if (oldTarget < oldLine || newTarget < newLine ||
+		oldTarget - oldLine != newTarget - newLine)
+		return false;
+
+	while (newLine < newTarget)
+	{
+		if (!ReadChangedLine())
+			return false;
+
+		ParseUnchangedLine(changedLine.data(), changedLine.data() + changedLine.length(), delta);
+		oldLine++;
+		newLine++;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		ReadChangedLine
+//
+// Description:		Reads the next line of the changed file.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false at the end of the file
+//
+//==========================================================================
+bool DiffCounter::ReadChangedLine(void)
+{
+	return !std::getline(changedFile, changedLine).fail();
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		CheckChangedLine
+//
+// Description:		Reads the next line of the changed file and stops using
+//					the file if it doesn't match the line from the diff (for
+//					example, if the file was edited after the diff was made).
+//					The states found from the file before the mismatch may
+//					be wrong, too.
+//
+// Input Arguments:
+//		begin	= const char*
+//		end		= const char*
+//
+// Output Arguments:
+//		delta	= Delta&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void DiffCounter::CheckChangedLine(const char *begin, const char *end, Delta &delta)
+{
+	if (changedFile.is_open() && (!ReadChangedLine() ||
+		changedLine.compare(0, std::string::npos, begin, end - begin) != 0))
+	{
+		changedFile.close();
+		delta.exact = false;
+	}
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		ParseUnchangedLine
+//
+// Description:		Parses a line which is in both versions of the file.  If
+//					the changes cause it to be classified differently, it is
+//					counted as removed and added.  Once both parsers are in
+//					the same state, they will classify every line the same
+//					way, so only one of them needs to parse it.
+//
+// Input Arguments:
+//		begin	= const char*
+//		end		= const char*
+//
+// Output Arguments:
+//		delta	= Delta&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void DiffCounter::ParseUnchangedLine(const char *begin, const char *end, Delta &delta)
+{
+	if (StatesMatch())
+	{
+		newParser.ParseLine(begin, end);
+		oldParser.SetState(newParser.GetState(), newParser.GetBlockCommentIndex());
+		return;
+	}
+
+	const SourceParser::PositionState oldType(oldParser.ParseLine(begin, end));
+	const SourceParser::PositionState newType(newParser.ParseLine(begin, end));
+	if (LineTypeRecorder::GetLineType(oldType) != LineTypeRecorder::GetLineType(newType))
+	{
+		LineCounter::CountLine(oldType, delta.removed);
+		LineCounter::CountLine(newType, delta.added);
+	}
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		StatesMatch
+//
+// Description:		Compares the states of the two parsers.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool DiffCounter::StatesMatch(void) const
+{
+	if (oldParser.GetState() != newParser.GetState())
+		return false;
+
+	return oldParser.GetState() != SourceParser::PositionBlockComment ||
+		oldParser.GetBlockCommentIndex() == newParser.GetBlockCommentIndex();
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		GetPath
+//
+// Description:		Extracts the path from a "---" or "+++" line.
+//
+// Input Arguments:
+//		header	= const std::string&, text following the "--- " or "+++ "
+//		prefix	= const std::string&, git's prefix for this side of the diff
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string, empty for /dev/null
+//
+//==========================================================================
+std::string DiffCounter::GetPath(const std::string &header, const std::string &prefix)
+{
+	// Some tools follow the path with a tab and a timestamp
+	std::string path(header.substr(0, header.find('\t')));
+	if (!path.empty() && *path.rbegin() == '\r')
+		path.erase(path.length() - 1);
+
+	if (path == "/dev/null")
+		return std::string();
+	else if (path.compare(0, prefix.length(), prefix) == 0)
+		path.erase(0, prefix.length());
+
+	return path;
+}
+
+//==========================================================================
+// Class:			DiffCounter
+// Function:		ParseRange
+//
+// Description:		Reads one range ("-<start>,<count>" or "+<start>,<count>",
+//					where the count defaults to one) from a hunk header.
+//
+// Input Arguments:
+//		s		= const char*&, advanced past the range
+//		marker	= const char&, '-' or '+'
+//
+// Output Arguments:
+//		start	= unsigned long long&
+//		count	= unsigned long long&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool DiffCounter::ParseRange(const char *&s, const char &marker,
+	unsigned long long &start, unsigned long long &count)
+{
+	while (*s == ' ')
+		s++;
+
+	if (*s != marker || !isdigit(static_cast<unsigned char>(s[1])))
+		return false;
+
+	char *end;
+	start = strtoull(s + 1, &end, 10);
+	s = end;
+
+	count = 1;
+	if (*s == ',')
+	{
+		if (!isdigit(static_cast<unsigned char>(s[1])))
+			return false;
+		count = strtoull(s + 1, &end, 10);
+		s = end;
+	}
+
+	return *s == ' ';
+}
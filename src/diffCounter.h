@@ -0,0 +1,95 @@
+// File:  diffCounter.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Counts the lines added and removed by a unified diff, by category.
+//        The parser state at each hunk is found by parsing the unchanged
+//        lines before it from the changed version of the file, when it can
+//        be found; the old version's state follows from the same lines,
+//        since they are identical in both versions.
+
+#ifndef DIFF_COUNTER_H_
+#define DIFF_COUNTER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <utility>
+#include <istream>
+#include <fstream>
+
+// Local headers
+#include "sourceParser.h"
+#include "lineCounter.h"
+
+class DiffCounter
+{
+public:
+	// Changed files are looked for relative to root; if root is empty (or a
+	// file isn't found), the parser state at each hunk is assumed instead
+	DiffCounter(std::istream &diff, const std::string &root,
+		const std::vector<std::string> &commentIndicators,
+		const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
+		const std::vector<std::string> &continuationIndicators);
+
+	// Advances to the next file in the diff (skipping the rest of the current
+	// file unless it was counted); returns false at the end of the diff or on
+	// failure (see HasFailed()).  The path is the old path for deleted files.
+	bool NextFile(std::string &path);
+
+	struct Delta
+	{
+		LineCounter::Statistics added;
+		LineCounter::Statistics removed;
+		bool exact;// False if the parser state at a hunk was assumed
+	};
+
+	// Counts the changes to the current file.  Unchanged lines which are
+	// classified differently because of the changes (for example, lines
+	// following an added block comment start) are counted as removed from
+	// their old category and added to their new category.
+	void CountFile(Delta &delta);
+
+	bool HasFailed(void) const { return failed; };
+
+private:
+	std::istream &diff;
+	const std::string root;
+
+	// Parse the file as it was before and after the changes
+	SourceParser oldParser;
+	SourceParser newParser;
+
+	std::string oldPath;
+	std::string newPath;
+	bool haveOldPath;// Read a "---" line which may start the next file
+	bool inFile;// The current file's hunks have not been read
+
+	// Lines left in the current hunk
+	unsigned long long oldRemaining;
+	unsigned long long newRemaining;
+
+	// Lines accounted for in each version of the current file
+	unsigned long long oldLine;
+	unsigned long long newLine;
+
+	std::ifstream changedFile;// Open while it matches the diff
+	std::string changedLine;
+
+	bool failed;
+
+	void ReadFile(Delta *delta);
+	bool BeginHunk(const std::string &header, Delta *delta);
+	bool ProcessHunkLine(const std::string &line, Delta *delta);
+	bool SkipToLine(const unsigned long long &oldTarget,
+		const unsigned long long &newTarget, Delta &delta);
+	bool ReadChangedLine(void);
+	void CheckChangedLine(const char *begin, const char *end, Delta &delta);
+	void ParseUnchangedLine(const char *begin, const char *end, Delta &delta);
+	bool StatesMatch(void) const;
+
+	static std::string GetPath(const std::string &header, const std::string &prefix);
+	static bool ParseRange(const char *&s, const char &marker,
+		unsigned long long &start, unsigned long long &count);
+};
+
+#endif// DIFF_COUNTER_H_
@@ -0,0 +1,38 @@
+// File:  fileIdSet.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Thread-safe set of (device, inode) pairs, used to visit each
+//        physical file and directory only once regardless of how many
+//        paths (links, overlapping search directories) lead to it.
+
+// Local headers
+#include "fileIdSet.h"
+
+//==========================================================================
+// Class:			FileIdSet
+// Function:		Insert
+//
+// Description:		Adds the specified file to the set.
+//
+// Input Arguments:
+//		device	= const unsigned long long&
+//		inode	= const unsigned long long&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the file had not been seen before
+//
+//==========================================================================
+bool FileIdSet::Insert(const unsigned long long &device, const unsigned long long &inode)
+{
+	FileId id;
+	id.device = device;
+	id.inode = inode;
+
+	const size_t hash(FileIdHash()(id));
+	Shard &shard(shards[hash % shardCount]);
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	return shard.ids.insert(id).second;
+}
@@ -0,0 +1,53 @@
+// File:  fileIdSet.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Thread-safe set of (device, inode) pairs, used to visit each
+//        physical file and directory only once regardless of how many
+//        paths (links, overlapping search directories) lead to it.
+
+#ifndef FILE_ID_SET_H_
+#define FILE_ID_SET_H_
+
+// Standard C++ headers
+#include <unordered_set>
+#include <mutex>
+
+class FileIdSet
+{
+public:
+	// Returns true if the pair was not already in the set
+	bool Insert(const unsigned long long &device, const unsigned long long &inode);
+
+private:
+	struct FileId
+	{
+		unsigned long long device;
+		unsigned long long inode;
+
+		bool operator==(const FileId &id) const { return inode == id.inode && device == id.device; };
+	};
+
+	struct FileIdHash
+	{
+		size_t operator()(const FileId &id) const
+		{
+			// Inodes are often sequential, so mix the bits before the
+			// low bits are used to pick a shard
+			unsigned long long h((id.inode ^ (id.device << 32) ^ (id.device >> 32)) * 0x9E3779B97F4A7C15ULL);
+			return static_cast<size_t>(h ^ (h >> 29));
+		};
+	};
+
+	// Independently locked shards, so traversal threads rarely contend
+	static const unsigned int shardCount = 64;
+
+	struct Shard
+	{
+		std::mutex mutex;
+		std::unordered_set<FileId, FileIdHash> ids;
+	};
+
+	Shard shards[shardCount];
+};
+
+#endif// FILE_ID_SET_H_
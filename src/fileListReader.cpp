@@ -0,0 +1,81 @@
+// File:  fileListReader.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Reads a list of file paths from a stream (a manifest file or
+//        standard input), as produced by "git ls-files", "find" and similar
+//        tools.  Paths are separated by newlines or, when the caller asks
+//        for it (as for "git ls-files -z" and "find -print0"), by NUL
+//        characters.  Each path is returned as soon as it has been read, so
+//        files can be counted while the list is still being written.
+
+// Standard C++ headers
+#include <streambuf>
+
+// Local headers
+#include "fileListReader.h"
+
+//==========================================================================
+// Class:			FileListReader
+// Function:		FileListReader
+//
+// Description:		Constructor for FileListReader class.
+//
+// Input Arguments:
+//		input			= std::istream&
+//		nulDelimited	= const bool&, true if paths are separated by NUL
+//						  characters instead of newlines
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+FileListReader::FileListReader(std::istream &input, const bool &nulDelimited)
+	: input(input), nulDelimited(nulDelimited)
+{
+}
+
+//==========================================================================
+// Class:			FileListReader
+// Function:		Next
+//
+// Description:		Reads the next path.  NUL characters always end a path;
+//					newlines do too, unless the list is NUL delimited (in
+//					which case newlines may be part of the paths).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		path	= std::string&
+//
+// Return Value:
+//		bool, false if there are no more paths
+//
+//==========================================================================
+bool FileListReader::Next(std::string &path)
+{
+	std::streambuf &buffer(*input.rdbuf());
+	for (;;)
+	{
+		path.clear();
+		int c;
+		while ((c = buffer.sbumpc()) != std::char_traits<char>::eof())
+		{
+			if (c == '\0' || (c == '\n' && !nulDelimited))
+				break;
+
+			path.push_back(static_cast<char>(c));
+		}
+
+		if (!nulDelimited && !path.empty() && *path.rbegin() == '\r')
+			path.erase(path.length() - 1);
+
+		if (!path.empty())
+			return true;
+		else if (c == std::char_traits<char>::eof())
+			return false;
+	}
+}
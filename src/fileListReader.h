@@ -0,0 +1,36 @@
+// File:  fileListReader.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Reads a list of file paths from a stream (a manifest file or
+//        standard input), as produced by "git ls-files", "find" and similar
+//        tools.  Paths are separated by newlines or, when the caller asks
+//        for it (as for "git ls-files -z" and "find -print0"), by NUL
+//        characters.  Each path is returned as soon as it has been read, so
+//        files can be counted while the list is still being written.
+
+#ifndef FILE_LIST_READER_H_
+#define FILE_LIST_READER_H_
+
+// Standard C++ headers
+#include <string>
+#include <istream>
+
+class FileListReader
+{
+public:
+	// The format can't be detected reliably from the start of the list
+	// (a newline may be part of the first of a list of NUL delimited
+	// paths), so it must be given
+	FileListReader(std::istream &input, const bool &nulDelimited);
+
+	// Returns false at the end of the list.  Empty entries are skipped, as
+	// are carriage returns at the ends of newline separated paths.  NUL
+	// characters end paths in either format.
+	bool Next(std::string &path);
+
+private:
+	std::istream &input;
+	const bool nulDelimited;// Otherwise newline delimited
+};
+
+#endif// FILE_LIST_READER_H_
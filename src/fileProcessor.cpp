@@ -0,0 +1,371 @@
+// File:  fileProcessor.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Pool of worker threads which take files that have been read from a
+//        queue and parse them.
+
+// Standard C++ headers
+#include <iostream>
+
+// Local headers
+#include "fileProcessor.h"
+#include "fileReader.h"
+#include "chunkedParser.h"
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		Static member initialization
+//
+// Description:		Static member initialization for FileProcessor class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+std::mutex FileProcessor::outputMutex;
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		FileProcessor
+//
+// Description:		Constructor for FileProcessor class.
+//
+// Input Arguments:
+//		queue					= BoundedQueue<FileBuffer>&
+//		commentIndicators		= const std::vector<std::string>&
+//		blockCommentIndicators	= const std::vector<std::pair<std::string, std::string> >&
+//		continuationIndicators	= const std::vector<std::string>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+FileProcessor::FileProcessor(BoundedQueue<FileBuffer> &queue,
+	const std::vector<std::string> &commentIndicators,
+	const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
+	const std::vector<std::string> &continuationIndicators) : queue(queue),
+	commentIndicators(commentIndicators), blockCommentIndicators(blockCommentIndicators),
+	continuationIndicators(continuationIndicators)
+{
+	parallelThreadCount = 1;
+	parallelMinimumFileSize = 0;
+	statistics = NULL;
+	threadBudget = NULL;
+	resultHandler = NULL;
+	skipCounter = NULL;
+	lineTypeWriter = NULL;
+	ioThrottle = NULL;
+	preservePageCache = false;
+	deadline = NULL;
+}
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		~FileProcessor
+//
+// Description:		Destructor for FileProcessor class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+FileProcessor::~FileProcessor()
+{
+	Wait();
+
+	unsigned int i;
+	for (i = 0; i < counters.size(); i++)
+		delete counters[i];
+
+	for (i = 0; i < recorders.size(); i++)
+		delete recorders[i];
+
+	delete statistics;
+	delete threadBudget;
+}
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		SetParallelParsing
+//
+// Description:		Configures splitting of large files into chunks which
+//					are parsed in parallel.  Must be called prior to Start().
+//
+// Input Arguments:
+//		threadCount		= const unsigned int&
+//		minimumFileSize	= const unsigned long long&, in bytes
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileProcessor::SetParallelParsing(const unsigned int &threadCount,
+	const unsigned long long &minimumFileSize)
+{
+	parallelThreadCount = threadCount;
+	parallelMinimumFileSize = minimumFileSize;
+}
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		Start
+//
+// Description:		Starts the worker threads.  Each thread has its own
+//					LineCounter and statistics shard, so no locking is
+//					required while parsing.  Large files are split between
+//					idle threads, so the number of threads parsing at once
+//					(worker threads and the threads parsing chunks together)
+//					never exceeds threadCount.  May only be called once.
+//
+// Input Arguments:
+//		threadCount	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileProcessor::Start(const unsigned int &threadCount)
+{
+	const unsigned int count(threadCount > 0 ? threadCount : 1);
+	statistics = new ShardedStatistics(count);
+	threadBudget = new ThreadBudget(count);
+
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		counters.push_back(new LineCounter(commentIndicators,
+			blockCommentIndicators, continuationIndicators));
+		counters.back()->SetParallelParsing(parallelThreadCount, parallelMinimumFileSize, threadBudget);
+
+		if (lineTypeWriter)
+		{
+			recorders.push_back(new LineTypeRecorder);
+			counters.back()->SetLineTypeRecorder(recorders.back());
+		}
+	}
+
+	for (i = 0; i < count; i++)
+		threads.push_back(std::thread(&FileProcessor::ProcessFiles, this, i));
+}
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		Wait
+//
+// Description:		Waits for the worker threads to finish.  The queue must
+//					be closed, or this will never return.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileProcessor::Wait(void)
+{
+	unsigned int i;
+	for (i = 0; i < threads.size(); i++)
+	{
+		if (threads[i].joinable())
+			threads[i].join();
+	}
+}
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		GetStatistics
+//
+// Description:		Returns the combined statistics from all worker threads.
+//					While the threads are running, this is a snapshot which
+//					includes every file that has been completely parsed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounter::Statistics
+//
+//==========================================================================
+LineCounter::Statistics FileProcessor::GetStatistics(void) const
+{
+	if (!statistics)
+	{
+		LineCounter::Statistics zero = {};
+		return zero;
+	}
+
+	return statistics->Snapshot();
+}
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		ProcessFiles
+//
+// Description:		Worker thread function.  Parses files from the queue
+//					until it is closed and empty, publishing this thread's
+//					totals after each file.  After the deadline, the
+//					remaining files are only reported as unfinished, and the
+//					file being parsed is cut short.
+//
+// Input Arguments:
+//		index	= const unsigned int&, the thread's counter and shard
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileProcessor::ProcessFiles(const unsigned int &index)
+{
+	LineCounter &counter(*counters[index]);
+	counter.SetDeadline(deadline);
+	FileBuffer file;
+	LineCounter::Statistics before(counter.GetStatistics());
+	while (queue.Pop(file))
+	{
+		if (deadline && deadline->HasPassed())
+		{
+			if (resultHandler)
+				resultHandler->OnFileUnfinished(file.entry);
+			continue;
+		}
+
+		const std::string shortFileName(file.entry.path.substr(
+			file.entry.path.find_last_of("/\\") + 1));
+		if (skipCounter && ShouldSkip(file, shortFileName))
+			continue;
+
+		{
+			std::lock_guard<std::mutex> lock(outputMutex);
+			std::cout << "  Parsing file: " << shortFileName << std::endl;
+		}
+
+		bool parsed(true);
+		if (file.buffered)
+		{
+			threadBudget->Acquire();
+			counter.ProcessBuffer(file.contents.data(), file.contents.length());
+			threadBudget->Release(1);
+		}
+		else
+		{
+			if (ioThrottle)
+				ioThrottle->Acquire(file.entry.size);
+
+			const bool dropCache(preservePageCache && !FileReader::IsCached(file.entry.path));
+			threadBudget->Acquire();
+			parsed = counter.ProcessFile(file.entry.path);
+			threadBudget->Release(1);
+			if (!parsed)
+			{
+				std::lock_guard<std::mutex> lock(outputMutex);
+				std::cout << "  Problems encounterd while parsing '"
+					<< shortFileName << "'" << std::endl;
+			}
+
+			if (dropCache)
+				FileReader::DropCache(file.entry.path);
+		}
+
+		if (lineTypeWriter && parsed && !counter.WasStopped())
+			lineTypeWriter->Write(file.entry.path, *recorders[index]);
+
+		const LineCounter::Statistics after(counter.GetStatistics());
+		statistics->Publish(index, after);
+
+		if (resultHandler)
+		{
+			LineCounter::Statistics fileStatistics;
+			fileStatistics.blankLines = after.blankLines - before.blankLines;
+			fileStatistics.commentLines = after.commentLines - before.commentLines;
+			fileStatistics.codeLines = after.codeLines - before.codeLines;
+			fileStatistics.fileCount = after.fileCount - before.fileCount;
+			if (counter.WasStopped())
+				resultHandler->OnFileCutShort(file.entry, fileStatistics, counter.GetParsedBytes());
+			else
+				resultHandler->OnFileResult(file.entry, fileStatistics);
+		}
+		before = after;
+	}
+}
+
+//==========================================================================
+// Class:			FileProcessor
+// Function:		ShouldSkip
+//
+// Description:		Checks the start of the file for content which should not
+//					be counted, and records it if found.  For files which
+//					have not been read into memory, only the start is read.
+//
+// Input Arguments:
+//		file			= const FileBuffer&
+//		shortFileName	= const std::string&, for messages
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the file should not be parsed
+//
+//==========================================================================
+bool FileProcessor::ShouldSkip(const FileBuffer &file, const std::string &shortFileName)
+{
+	ContentClassifier::ContentType type;
+	if (file.buffered)
+		type = ContentClassifier::Classify(file.contents.data(), file.contents.length(), true);
+	else
+	{
+		// Read failures are left for the parser to report
+		if (ioThrottle)
+			ioThrottle->Acquire(ContentClassifier::sampleSize);
+
+		std::string head;
+		if (!FileReader::ReadHead(file.entry.path, ContentClassifier::sampleSize,
+			head, preservePageCache))
+			return false;
+		type = ContentClassifier::Classify(head.data(), head.length(),
+			head.length() < ContentClassifier::sampleSize);
+	}
+
+	if (type == ContentClassifier::ContentSource)
+		return false;
+
+	skipCounter->Add(type, file.entry.size);
+	if (resultHandler)
+		resultHandler->OnFileSkipped(file.entry, type);
+
+	std::lock_guard<std::mutex> lock(outputMutex);
+	std::cout << "  Skipping " << ContentClassifier::GetName(type)
+		<< " file: " << shortFileName << std::endl;
+	return true;
+}
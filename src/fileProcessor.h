@@ -0,0 +1,116 @@
+// File:  fileProcessor.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Pool of worker threads which take files that have been read from a
+//        queue and parse them.
+
+#ifndef FILE_PROCESSOR_H_
+#define FILE_PROCESSOR_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <utility>
+#include <thread>
+#include <mutex>
+
+// Local headers
+#include "lineCounter.h"
+#include "boundedQueue.h"
+#include "fileQueue.h"
+#include "shardedStatistics.h"
+#include "contentClassifier.h"
+#include "lineTypeRecorder.h"
+#include "ioThrottle.h"
+#include "deadline.h"
+
+// Interface for receiving the statistics of individual files.  Called from
+// the worker threads, so implementations must be thread-safe.
+class FileResultHandler
+{
+public:
+	virtual ~FileResultHandler() {};
+	virtual void OnFileResult(const FileEntry &entry,
+		const LineCounter::Statistics &statistics) = 0;
+
+	// Files skipped because of their contents (see SetSkipCounter())
+	virtual void OnFileSkipped(const FileEntry &/*entry*/,
+		const ContentClassifier::ContentType &/*type*/) {};
+
+	// Files found but not counted because the deadline passed first
+	virtual void OnFileUnfinished(const FileEntry &/*entry*/) {};
+
+	// Files cut short by the deadline while they were being parsed.  The
+	// lines in the first parsedBytes bytes are included in the totals (but
+	// the file is not counted).
+	virtual void OnFileCutShort(const FileEntry &entry,
+		const LineCounter::Statistics &/*statistics*/,
+		const unsigned long long &/*parsedBytes*/) { OnFileUnfinished(entry); };
+};
+
+class FileProcessor
+{
+public:
+	FileProcessor(BoundedQueue<FileBuffer> &queue,
+		const std::vector<std::string> &commentIndicators,
+		const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
+		const std::vector<std::string> &continuationIndicators);
+	~FileProcessor();
+
+	void SetParallelParsing(const unsigned int &threadCount,
+		const unsigned long long &minimumFileSize);
+
+	void SetFileResultHandler(FileResultHandler *handler) { resultHandler = handler; };
+
+	// When set, binary, generated and minified files are skipped and counted here
+	void SetSkipCounter(ContentClassifier::SkipCounter *counter) { skipCounter = counter; };
+
+	// When set, the type of each line of each file is written here
+	void SetLineTypeWriter(LineTypeWriter *writer) { lineTypeWriter = writer; };
+
+	// For files which are read here (those too large to have been read
+	// already, and the start of files being checked for skipping)
+	void SetIoThrottle(IoThrottle *throttle) { ioThrottle = throttle; };
+	void SetPreservePageCache(const bool &preserve) { preservePageCache = preserve; };
+
+	// Once the deadline has passed, files taken from the queue are reported
+	// as unfinished instead of being parsed (files already being parsed are
+	// completed)
+	void SetDeadline(const Deadline *deadline) { this->deadline = deadline; };
+
+	void Start(const unsigned int &threadCount);
+	void Wait(void);
+
+	// Safe to call while the worker threads are running
+	LineCounter::Statistics GetStatistics(void) const;
+
+	// For keeping lines written to the console by different threads intact
+	static std::mutex outputMutex;
+
+private:
+	BoundedQueue<FileBuffer> &queue;
+
+	const std::vector<std::string> commentIndicators;
+	const std::vector<std::pair<std::string, std::string> > blockCommentIndicators;
+	const std::vector<std::string> continuationIndicators;
+
+	unsigned int parallelThreadCount;
+	unsigned long long parallelMinimumFileSize;
+
+	std::vector<LineCounter*> counters;
+	std::vector<LineTypeRecorder*> recorders;
+	std::vector<std::thread> threads;
+	ShardedStatistics *statistics;
+	ThreadBudget *threadBudget;// Shared by the worker threads and the threads parsing chunks
+	FileResultHandler *resultHandler;
+	ContentClassifier::SkipCounter *skipCounter;
+	LineTypeWriter *lineTypeWriter;
+	IoThrottle *ioThrottle;
+	bool preservePageCache;
+	const Deadline *deadline;
+
+	void ProcessFiles(const unsigned int &index);
+	bool ShouldSkip(const FileBuffer &file, const std::string &shortFileName);
+};
+
+#endif// FILE_PROCESSOR_H_
@@ -0,0 +1,295 @@
+// File:  fileQueue.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Thread-safe queue of files waiting to be read.  Files are grouped
+//        by the device holding them, and each device is limited to a number
+//        of files being read at once which suits it, so slow devices cannot
+//        tie up all of the readers.  Within those limits, files are handed
+//        out largest first, so long-running files start early and small
+//        files fill in around them at the end of the run.
+
+// Local headers
+#include "fileQueue.h"
+#include "deviceInfo.h"
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		FileQueue
+//
+// Description:		Constructor for FileQueue class.
+//
+// Input Arguments:
+//		capacity	= const size_t&, maximum number of queued files (zero for
+//					  no limit)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+FileQueue::FileQueue(const size_t &capacity) : count(0), capacity(capacity),
+	closed(false), classifyDevices(false), solidStateLimit(0),
+	rotationalLimit(0), networkLimit(0)
+{
+}
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		SetDeviceLimits
+//
+// Description:		Sets the number of files which may be read at once from
+//					each type of device.  Devices are classified as they are
+//					first seen.
+//
+// Input Arguments:
+//		solidState	= const unsigned int&
+//		rotational	= const unsigned int&
+//		network		= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileQueue::SetDeviceLimits(const unsigned int &solidState,
+	const unsigned int &rotational, const unsigned int &network)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	classifyDevices = true;
+	solidStateLimit = solidState;
+	rotationalLimit = rotational;
+	networkLimit = network;
+}
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		SetDeviceLimit
+//
+// Description:		Sets the number of files which may be read at once from
+//					the specified device, overriding its classification.
+//
+// Input Arguments:
+//		device	= const unsigned long long&
+//		limit	= const unsigned int&, zero for no limit
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileQueue::SetDeviceLimit(const unsigned long long &device, const unsigned int &limit)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	devices[device].limit = limit;
+	ready.notify_all();
+}
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		Push
+//
+// Description:		Adds the specified file to the queue, waiting for room if
+//					the queue is full.
+//
+// Input Arguments:
+//		entry	= const FileEntry&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileQueue::Push(const FileEntry &entry)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	if (classifyDevices && devices.find(entry.device) == devices.end())
+	{
+		// Classification requires file system access, so don't hold the lock
+		lock.unlock();
+		unsigned int limit;
+		switch (DeviceInfo::GetType(entry.path, entry.device))
+		{
+		case DeviceInfo::DeviceRotational:
+			limit = rotationalLimit;
+			break;
+
+		case DeviceInfo::DeviceNetwork:
+			limit = networkLimit;
+			break;
+
+		default:
+			limit = solidStateLimit;
+		}
+
+		lock.lock();
+		if (devices.find(entry.device) == devices.end())
+			devices[entry.device].limit = limit;
+	}
+
+	while (capacity > 0 && count >= capacity)
+		notFull.wait(lock);
+
+	devices[entry.device].entries.push(entry);
+	count++;
+	ready.notify_one();
+}
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		Pop
+//
+// Description:		Removes the largest file from those devices which are
+//					below their limits, optionally waiting for one to become
+//					available.
+//
+// Input Arguments:
+//		wait	= const bool&
+//
+// Output Arguments:
+//		entry	= FileEntry&
+//
+// Return Value:
+//		bool, false if the queue is empty and has been closed (or no file is
+//		available and we are not waiting)
+//
+//==========================================================================
+bool FileQueue::Pop(FileEntry &entry, const bool &wait)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	Device *device(NextReadyDevice());
+	while (!device && wait && !(closed && count == 0))
+	{
+		ready.wait(lock);
+		device = NextReadyDevice();
+	}
+
+	if (!device)
+		return false;
+
+	entry = device->entries.top();
+	device->entries.pop();
+	device->active++;
+	count--;
+	notFull.notify_one();
+	return true;
+}
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		Release
+//
+// Description:		Indicates that the specified file (previously returned by
+//					Pop()) is no longer being read, allowing another file from
+//					the same device to be read.
+//
+// Input Arguments:
+//		entry	= const FileEntry&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileQueue::Release(const FileEntry &entry)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::map<unsigned long long, Device>::iterator it(devices.find(entry.device));
+	if (it != devices.end() && it->second.active > 0)
+	{
+		it->second.active--;
+
+		// Waiting readers may be waiting on different devices
+		if (!it->second.entries.empty())
+			ready.notify_all();
+	}
+}
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		Close
+//
+// Description:		Indicates that no more files will be added.  Waiting
+//					consumers return once the queue has been drained.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileQueue::Close(void)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	closed = true;
+	ready.notify_all();
+}
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		IsFinished
+//
+// Description:		Checks to see if the queue has been closed and drained.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool FileQueue::IsFinished(void)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return closed && count == 0;
+}
+
+//==========================================================================
+// Class:			FileQueue
+// Function:		NextReadyDevice
+//
+// Description:		Finds the device with the largest queued file among those
+//					below their limits.  Must be called with the mutex held.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Device*, NULL if no files are available
+//
+//==========================================================================
+FileQueue::Device* FileQueue::NextReadyDevice(void)
+{
+	Device *next(NULL);
+	std::map<unsigned long long, Device>::iterator it;
+	for (it = devices.begin(); it != devices.end(); ++it)
+	{
+		Device &device(it->second);
+		if (device.entries.empty() || (device.limit > 0 && device.active >= device.limit))
+			continue;
+
+		if (!next || next->entries.top() < device.entries.top())
+			next = &device;
+	}
+
+	return next;
+}
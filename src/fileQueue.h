@@ -0,0 +1,86 @@
+// File:  fileQueue.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Thread-safe queue of files waiting to be read.  Files are grouped
+//        by the device holding them, and each device is limited to a number
+//        of files being read at once which suits it, so slow devices cannot
+//        tie up all of the readers.  Within those limits, files are handed
+//        out largest first, so long-running files start early and small
+//        files fill in around them at the end of the run.
+
+#ifndef FILE_QUEUE_H_
+#define FILE_QUEUE_H_
+
+// Standard C++ headers
+#include <string>
+#include <queue>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+
+struct FileEntry
+{
+	std::string path;
+	unsigned long long size;// [bytes]
+	unsigned long long device;// ID of the device holding the file
+	unsigned long long inode;// Zero if unknown
+
+	bool operator<(const FileEntry &entry) const { return size < entry.size; };
+};
+
+// File that has been read and is waiting to be parsed
+struct FileBuffer
+{
+	FileEntry entry;
+
+	// When false, the file was too large to hold in memory and must be
+	// parsed directly from disk
+	bool buffered;
+	std::string contents;
+};
+
+class FileQueue
+{
+public:
+	FileQueue(const size_t &capacity = 0);
+
+	// Limits on files being read at once for each type of device (zero for
+	// no limit), applied to devices as they are first seen
+	void SetDeviceLimits(const unsigned int &solidState,
+		const unsigned int &rotational, const unsigned int &network);
+	void SetDeviceLimit(const unsigned long long &device, const unsigned int &limit);
+
+	void Push(const FileEntry &entry);
+	bool Pop(FileEntry &entry, const bool &wait = true);
+	void Release(const FileEntry &entry);// Call when finished reading a popped file
+	void Close(void);
+	bool IsFinished(void);
+
+private:
+	struct Device
+	{
+		Device() : active(0), limit(0) {};
+
+		std::priority_queue<FileEntry> entries;
+		unsigned int active;// Files popped but not yet released
+		unsigned int limit;// zero for no limit
+	};
+
+	std::map<unsigned long long, Device> devices;
+	size_t count;// Total queued files
+	const size_t capacity;// zero for no limit
+	bool closed;
+
+	bool classifyDevices;
+	unsigned int solidStateLimit;
+	unsigned int rotationalLimit;
+	unsigned int networkLimit;
+
+	std::mutex mutex;
+	std::condition_variable ready;// A file may be ready to pop
+	std::condition_variable notFull;
+
+	Device* NextReadyDevice(void);
+};
+
+#endif// FILE_QUEUE_H_
@@ -0,0 +1,274 @@
+// File:  fileReader.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Reads entire files into memory, hinting to the operating system
+//        that the file will be read sequentially.
+
+#ifdef WIN32
+// Standard C++ headers
+#include <fstream>
+#else
+// *nix headers
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+// Standard C++ headers
+#include <vector>
+#endif
+
+// Local headers
+#include "fileReader.h"
+
+#ifndef WIN32
+//==========================================================================
+// Class:			None
+// Function:		AnyPagesCached
+//
+// Description:		Checks whether any page of the open file is in the page
+//					cache.
+//
+// Input Arguments:
+//		fd	= const int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if any page is cached or if it can't be determined
+//
+//==========================================================================
+static bool AnyPagesCached(const int &fd)
+{
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0)
+		return true;
+
+	const size_t length(static_cast<size_t>(st.st_size));
+	void *map(mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0));
+	if (map == MAP_FAILED)
+		return true;
+
+	const size_t pageSize(static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+	std::vector<char> pages((length + pageSize - 1) / pageSize);
+#ifdef __linux__
+	const int result(mincore(map, length, reinterpret_cast<unsigned char*>(&pages[0])));
+#else
+	const int result(mincore(map, length, &pages[0]));
+#endif
+	munmap(map, length);
+	if (result != 0)
+		return true;
+
+	size_t i;
+	for (i = 0; i < pages.size(); i++)
+	{
+		if (pages[i] & 1)
+			return true;
+	}
+
+	return false;
+}
+#endif
+
+//==========================================================================
+// Namespace:		FileReader
+// Function:		Read
+//
+// Description:		Reads the entire contents of the specified file.  The
+//					size hint is used to size the buffer, but the file is read
+//					until end-of-file in case it has changed size.
+//
+// Input Arguments:
+//		fileName		= const std::string&
+//		sizeHint		= const unsigned long long&, expected file size in bytes
+//		preserveCache	= const bool&
+//
+// Output Arguments:
+//		contents	= std::string&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool FileReader::Read(const std::string &fileName,
+	const unsigned long long &sizeHint, std::string &contents,
+	const bool &preserveCache)
+{
+#ifdef WIN32
+	(void)preserveCache;
+	std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (!file.is_open() || !file.good())
+		return false;
+
+	contents.reserve(sizeHint);
+	contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return !file.bad();
+#else
+	const int fd(open(fileName.c_str(), O_RDONLY | O_CLOEXEC));
+	if (fd < 0)
+		return false;
+
+	// Ask for aggressive read-ahead
+	posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	const bool dropCache(preserveCache && !AnyPagesCached(fd));
+
+	contents.resize(sizeHint + 1);// Extra byte lets us detect end-of-file without growing
+	size_t length(0);
+	ssize_t count;
+	bool ok(true);
+	for (;;)
+	{
+		if (length == contents.size())
+			contents.resize(contents.size() * 2);
+
+		count = read(fd, &contents[length], contents.size() - length);
+		if (count > 0)
+			length += count;
+		else if (count == 0)
+			break;
+		else if (errno != EINTR)
+		{
+			ok = false;
+			break;
+		}
+	}
+
+	if (dropCache)
+		posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+	close(fd);
+	contents.resize(length);
+	return ok;
+#endif
+}
+
+//==========================================================================
+// Namespace:		FileReader
+// Function:		ReadHead
+//
+// Description:		Reads up to the specified number of bytes from the start
+//					of the file.
+//
+// Input Arguments:
+//		fileName		= const std::string&
+//		size			= const size_t&, in bytes
+//		preserveCache	= const bool&
+//
+// Output Arguments:
+//		contents	= std::string&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool FileReader::ReadHead(const std::string &fileName, const size_t &size,
+	std::string &contents, const bool &preserveCache)
+{
+	contents.resize(size);
+#ifdef WIN32
+	(void)preserveCache;
+	std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (!file.is_open() || !file.good())
+		return false;
+
+	file.read(&contents[0], size);
+	if (file.bad())
+		return false;
+	contents.resize(static_cast<size_t>(file.gcount()));
+	return true;
+#else
+	const int fd(open(fileName.c_str(), O_RDONLY | O_CLOEXEC));
+	if (fd < 0)
+		return false;
+
+	const bool dropCache(preserveCache && !AnyPagesCached(fd));
+	size_t length(0);
+	ssize_t count;
+	bool ok(true);
+	while (length < size)
+	{
+		count = read(fd, &contents[length], size - length);
+		if (count > 0)
+			length += count;
+		else if (count == 0)
+			break;
+		else if (errno != EINTR)
+		{
+			ok = false;
+			break;
+		}
+	}
+
+	if (dropCache)
+		posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+	close(fd);
+	contents.resize(length);
+	return ok;
+#endif
+}
+
+//==========================================================================
+// Namespace:		FileReader
+// Function:		IsCached
+//
+// Description:		Checks whether any part of the file is in the page cache.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if any part is cached or if it can't be determined
+//
+//==========================================================================
+bool FileReader::IsCached(const std::string &fileName)
+{
+#ifdef WIN32
+	(void)fileName;
+	return true;
+#else
+	const int fd(open(fileName.c_str(), O_RDONLY | O_CLOEXEC));
+	if (fd < 0)
+		return true;
+
+	const bool cached(AnyPagesCached(fd));
+	close(fd);
+	return cached;
+#endif
+}
+
+//==========================================================================
+// Namespace:		FileReader
+// Function:		DropCache
+//
+// Description:		Asks the operating system to remove the file from the
+//					page cache.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileReader::DropCache(const std::string &fileName)
+{
+#ifdef WIN32
+	(void)fileName;
+#else
+	const int fd(open(fileName.c_str(), O_RDONLY | O_CLOEXEC));
+	if (fd < 0)
+		return;
+
+	posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+	close(fd);
+#endif
+}
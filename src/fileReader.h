@@ -0,0 +1,30 @@
+// File:  fileReader.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Reads entire files into memory, hinting to the operating system
+//        that the file will be read sequentially.
+
+#ifndef FILE_READER_H_
+#define FILE_READER_H_
+
+// Standard C++ headers
+#include <string>
+
+namespace FileReader
+{
+
+// When preserveCache is true, files which were not in the page cache before
+// they were read are removed from it afterwards
+bool Read(const std::string &fileName, const unsigned long long &sizeHint,
+	std::string &contents, const bool &preserveCache = false);
+bool ReadHead(const std::string &fileName, const size_t &size, std::string &contents,
+	const bool &preserveCache = false);
+
+// For files read by other means; IsCached() is true if any part of the file
+// is in the page cache (or if it can't be determined)
+bool IsCached(const std::string &fileName);
+void DropCache(const std::string &fileName);
+
+}
+
+#endif// FILE_READER_H_
@@ -0,0 +1,218 @@
+// File:  fileResults.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Saves the statistics for each file counted, sorted by path, so the
+//        results of separate runs can be compared one file at a time.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cctype>
+
+// Local headers
+#include "fileResults.h"
+
+// First line of file result files
+static const std::string fileHeader("LineCounter file results 1");
+
+//==========================================================================
+// Class:			FileResultWriter
+// Function:		OnFileResult
+//
+// Description:		Keeps the results for one file.  Called from the parse
+//					threads.
+//
+// Input Arguments:
+//		entry		= const FileEntry&
+//		statistics	= const LineCounter::Statistics&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FileResultWriter::OnFileResult(const FileEntry &entry,
+	const LineCounter::Statistics &statistics)
+{
+	Counts counts;
+	counts.blankLines = statistics.blankLines;
+	counts.commentLines = statistics.commentLines;
+	counts.codeLines = statistics.codeLines;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	paths.Add(entry.path);
+	results.push_back(counts);
+}
+
+//==========================================================================
+// Class:			FileResultWriter
+// Function:		Write
+//
+// Description:		Writes the results for all files, sorted by path.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool FileResultWriter::Write(const std::string &fileName)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	// The same file may be found twice (e.g. through a link), but it is
+	// only listed once
+	const std::vector<unsigned int> ids(paths.GetSortedIds());
+
+	file << fileHeader << '\n';
+	unsigned int i;
+	for (i = 0; i < ids.size(); i++)
+	{
+		const Counts &counts(results[ids[i]]);
+		file << counts.blankLines << ' ' << counts.commentLines << ' '
+			<< counts.codeLines << ' ' << paths.GetPath(ids[i]) << '\n';
+	}
+
+	return file.good();
+}
+
+//==========================================================================
+// Class:			FileResultWriter
+// Function:		GetMemoryUsage
+//
+// Description:		Returns the number of bytes allocated for the results.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//==========================================================================
+size_t FileResultWriter::GetMemoryUsage(void)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return paths.GetMemoryUsage() + results.capacity() * sizeof(Counts);
+}
+
+//==========================================================================
+// Class:			FileResultReader
+// Function:		FileResultReader
+//
+// Description:		Constructor for FileResultReader class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+FileResultReader::FileResultReader()
+{
+	failed = false;
+}
+
+//==========================================================================
+// Class:			FileResultReader
+// Function:		Open
+//
+// Description:		Opens a file result file and checks its header.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool FileResultReader::Open(const std::string &fileName)
+{
+	file.open(fileName.c_str(), std::ios::in | std::ios::binary);
+	std::string header;
+	if (!std::getline(file, header))
+		return false;
+
+	if (!header.empty() && *header.rbegin() == '\r')
+		header.erase(header.length() - 1);
+
+	return header == fileHeader;
+}
+
+//==========================================================================
+// Class:			FileResultReader
+// Function:		Next
+//
+// Description:		Reads the results for the next file.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		path		= std::string&
+//		statistics	= LineCounter::Statistics&, fileCount is always one
+//
+// Return Value:
+//		bool, true for success, false at the end of the file or on failure
+//
+//==========================================================================
+bool FileResultReader::Next(std::string &path, LineCounter::Statistics &statistics)
+{
+	if (failed || !std::getline(file, line))
+		return false;
+
+	if (!line.empty() && *line.rbegin() == '\r')
+		line.erase(line.length() - 1);
+
+	unsigned long long *counts[] = { &statistics.blankLines,
+		&statistics.commentLines, &statistics.codeLines };
+	const char *s(line.c_str());
+	char *end;
+	unsigned int i;
+	for (i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+	{
+		if (!isdigit(static_cast<unsigned char>(*s)))
+		{
+			failed = true;
+			return false;
+		}
+
+		*counts[i] = strtoull(s, &end, 10);
+		if (*end != ' ')
+		{
+			failed = true;
+			return false;
+		}
+		s = end + 1;
+	}
+
+	path.assign(s, line.c_str() + line.length());
+	statistics.fileCount = 1;
+
+	// Comparing results relies on the order
+	if (path.empty() || (!lastPath.empty() && path <= lastPath))
+	{
+		failed = true;
+		return false;
+	}
+	lastPath = path;
+
+	return true;
+}
@@ -0,0 +1,71 @@
+// File:  fileResults.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Saves the statistics for each file counted, sorted by path, so the
+//        results of separate runs can be compared one file at a time.
+
+#ifndef FILE_RESULTS_H_
+#define FILE_RESULTS_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <utility>
+#include <fstream>
+#include <mutex>
+
+// Local headers
+#include "lineCounter.h"
+#include "fileProcessor.h"
+#include "pathTable.h"
+
+// Results arrive in any order, so they are kept until the search is
+// complete and then written in order of path (byte by byte).  The file is
+// text:  a header line, then one line per file containing the blank,
+// comment and code line counts and the path, separated by spaces.
+class FileResultWriter : public FileResultHandler
+{
+public:
+	virtual void OnFileResult(const FileEntry &entry,
+		const LineCounter::Statistics &statistics);
+
+	bool Write(const std::string &fileName);
+
+	// Bytes used to keep the results until they are written
+	size_t GetMemoryUsage(void);
+
+private:
+	std::mutex mutex;
+
+	struct Counts
+	{
+		unsigned long long blankLines;
+		unsigned long long commentLines;
+		unsigned long long codeLines;
+	};
+
+	PathTable paths;
+	std::vector<Counts> results;// Indexed by file id
+};
+
+class FileResultReader
+{
+public:
+	FileResultReader();
+
+	bool Open(const std::string &fileName);
+
+	// Reads the next file's results; returns false at the end of the file or
+	// on failure (see HasFailed()), including if the paths are out of order
+	bool Next(std::string &path, LineCounter::Statistics &statistics);
+
+	bool HasFailed(void) const { return failed; };
+
+private:
+	std::ifstream file;
+	std::string line;
+	std::string lastPath;
+	bool failed;
+};
+
+#endif// FILE_RESULTS_H_
@@ -0,0 +1,372 @@
+// File:  incrementalCounter.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Keeps the line counts of a file up to date as it is edited.  Lines
+//        are stored in blocks of up to a few lines, each with the parser
+//        state at its start, so an edit only changes the blocks it touches;
+//        it is parsed starting from the start of the first of those blocks,
+//        and parsing stops as soon as the state at the start of a following
+//        block matches the state saved there before the edit.
+
+// Standard C++ headers
+#include <cassert>
+#include <cstring>
+
+// Local headers
+#include "incrementalCounter.h"
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		IncrementalCounter
+//
+// Description:		Constructor for IncrementalCounter class.
+//
+// Input Arguments:
+//		commentIndicators		= const std::vector<std::string>&
+//		blockCommentIndicators	= const std::vector<std::pair<std::string, std::string> >&
+//		continuationIndicators	= const std::vector<std::string>&
+//		checkpointInterval		= const unsigned int&, maximum number of
+//								  lines between saved parser states
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+IncrementalCounter::IncrementalCounter(const std::vector<std::string> &commentIndicators,
+	const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
+	const std::vector<std::string> &continuationIndicators,
+	const unsigned int &checkpointInterval) : checkpointInterval(checkpointInterval > 0 ? checkpointInterval : 1),
+	parser(commentIndicators, blockCommentIndicators, continuationIndicators)
+{
+	SetText(NULL, 0);
+}
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		SetText
+//
+// Description:		Replaces the contents of the file and counts all of its
+//					lines.  Lines are split the same way as
+//					LineCounter::ProcessBuffer() splits them.
+//
+// Input Arguments:
+//		buffer	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void IncrementalCounter::SetText(const char *buffer, const size_t &length)
+{
+	blocks.clear();
+	lineCount = 0;
+
+	statistics.blankLines = 0;
+	statistics.commentLines = 0;
+	statistics.codeLines = 0;
+	statistics.fileCount = 1;
+
+	std::vector<std::string> newLines;
+	const char *end(buffer + length);
+	const char *lineEnd;
+	while (buffer != end)
+	{
+		lineEnd = static_cast<const char*>(memchr(buffer, '\n', end - buffer));
+		if (!lineEnd)
+			lineEnd = end;
+
+		newLines.push_back(std::string(buffer, lineEnd));
+		buffer = lineEnd == end ? end : lineEnd + 1;
+	}
+
+	ReplaceLines(0, 0, newLines);
+}
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		ReplaceLines
+//
+// Description:		Applies an edit to the file and updates the counts.  The
+//					blocks containing the removed lines (or the insertion
+//					point) are replaced by new blocks holding the rest of
+//					their lines and the new lines, along with the following
+//					block if it is small enough to fit, so blocks don't
+//					become fragmented.  Blocks after those still have their
+//					states from before the edit, which is what the new states
+//					are compared against to find where the edit's effects
+//					end.  Only the blocks which are touched are moved or
+//					copied, apart from shifting the list of blocks.
+//
+// Input Arguments:
+//		firstLine		= const size_t&
+//		removedCount	= const size_t&
+//		newLines		= const std::vector<std::string>&, without newlines
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false if the range is outside of the file
+//
+//==========================================================================
+bool IncrementalCounter::ReplaceLines(const size_t &firstLine, const size_t &removedCount,
+	const std::vector<std::string> &newLines)
+{
+	if (firstLine > lineCount || removedCount > lineCount - firstLine)
+		return false;
+
+	if (blocks.empty())// Until the edit is applied, this is the only empty block
+	{
+		Block block;
+		parser.Reset();
+		block.start = MakeCheckpoint();
+		blocks.push_back(block);
+	}
+
+	size_t offset;
+	const size_t index(FindBlock(firstLine, offset));
+	const Checkpoint start(blocks[index].start);
+
+	// Find the end of the removed lines
+	size_t last(index), lastOffset(offset + removedCount);
+	while (lastOffset > blocks[last].lines.size())
+	{
+		lastOffset -= blocks[last].lines.size();
+		last++;
+	}
+
+	std::vector<std::string> edited(blocks[index].lines.begin(), blocks[index].lines.begin() + offset);
+	edited.insert(edited.end(), newLines.begin(), newLines.end());
+	edited.insert(edited.end(), blocks[last].lines.begin() + lastOffset, blocks[last].lines.end());
+	if (last + 1 < blocks.size() && edited.size() + blocks[last + 1].lines.size() <= checkpointInterval)
+	{
+		last++;
+		edited.insert(edited.end(), blocks[last].lines.begin(), blocks[last].lines.end());
+	}
+
+	size_t i, j;
+	for (i = index; i <= last; i++)
+	{
+		for (j = 0; j < blocks[i].lineTypes.size(); j++)
+			UncountLine(static_cast<SourceParser::PositionState>(blocks[i].lineTypes[j]), statistics);
+	}
+
+	lineCount = lineCount - removedCount + newLines.size();
+
+	// Split the edited lines evenly into as few blocks as possible
+	const size_t editedCount(edited.size());
+	const size_t blockCount((editedCount + checkpointInterval - 1) / checkpointInterval);
+	if (blockCount < last - index + 1)
+		blocks.erase(blocks.begin() + index + blockCount, blocks.begin() + last + 1);
+	else
+		blocks.insert(blocks.begin() + last + 1, blockCount - (last - index + 1), Block());
+
+	size_t first(0);
+	for (i = 0; i < blockCount; i++)
+	{
+		const size_t end(editedCount * (i + 1) / blockCount);
+		Block &block(blocks[index + i]);
+		block.lines.assign(edited.begin() + first, edited.begin() + end);
+		block.lineTypes.assign(end - first, static_cast<unsigned char>(SourceParser::PositionCode));
+		first = end;
+	}
+
+	Parse(index, start, index + blockCount);
+	return true;
+}
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		FindBlock
+//
+// Description:		Finds the block containing the specified line.  The end
+//					of the file is in the last block.
+//
+// Input Arguments:
+//		line	= const size_t&, at most the number of lines in the file
+//
+// Output Arguments:
+//		offset	= size_t&, of the line within the block
+//
+// Return Value:
+//		size_t, index of the block
+//
+//==========================================================================
+size_t IncrementalCounter::FindBlock(const size_t &line, size_t &offset) const
+{
+	assert(!blocks.empty());
+	offset = line;
+	size_t index(0);
+	while (offset >= blocks[index].lines.size() && index + 1 < blocks.size())
+	{
+		offset -= blocks[index].lines.size();
+		index++;
+	}
+
+	return index;
+}
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		Parse
+//
+// Description:		Parses from the start of the specified block until the
+//					state at the start of a block (from compareIndex on)
+//					matches its saved state, or the end of the file is
+//					reached.  Blocks before compareIndex must not be
+//					counted yet.
+//
+// Input Arguments:
+//		index			= size_t, of the first block to parse
+//		start			= const Checkpoint&, parser state at the start of the
+//						  first block
+//		compareIndex	= const size_t&, index of the first block whose
+//						  saved state is from before the edit
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void IncrementalCounter::Parse(size_t index, const Checkpoint &start, const size_t &compareIndex)
+{
+	parser.SetState(start.state, start.blockCommentIndex);
+	parsedLineCount = 0;
+
+	size_t i;
+	SourceParser::PositionState type;
+	for (; index < blocks.size(); index++)
+	{
+		Block &block(blocks[index]);
+		if (index >= compareIndex)
+		{
+			// Every following line would be parsed exactly as it was before
+			if (ParserStateMatches(block.start))
+				return;
+
+			for (i = 0; i < block.lineTypes.size(); i++)
+				UncountLine(static_cast<SourceParser::PositionState>(block.lineTypes[i]), statistics);
+		}
+
+		block.start = MakeCheckpoint();
+		for (i = 0; i < block.lines.size(); i++)
+		{
+			type = parser.ParseLine(block.lines[i]);
+			block.lineTypes[i] = static_cast<unsigned char>(type);
+			LineCounter::CountLine(type, statistics);
+		}
+
+		parsedLineCount += block.lines.size();
+	}
+}
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		ParserStateMatches
+//
+// Description:		Compares the parser's state to a saved state.
+//
+// Input Arguments:
+//		checkpoint	= const Checkpoint&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool IncrementalCounter::ParserStateMatches(const Checkpoint &checkpoint) const
+{
+	if (parser.GetState() != checkpoint.state)
+		return false;
+
+	return checkpoint.state != SourceParser::PositionBlockComment ||
+		parser.GetBlockCommentIndex() == checkpoint.blockCommentIndex;
+}
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		MakeCheckpoint
+//
+// Description:		Saves the parser's state.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Checkpoint
+//
+//==========================================================================
+IncrementalCounter::Checkpoint IncrementalCounter::MakeCheckpoint(void) const
+{
+	Checkpoint checkpoint;
+	checkpoint.state = parser.GetState();
+	checkpoint.blockCommentIndex = parser.GetBlockCommentIndex();
+	return checkpoint;
+}
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		GetLineType
+//
+// Description:		Returns the classification of the specified line.
+//
+// Input Arguments:
+//		line	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		SourceParser::PositionState
+//
+//==========================================================================
+SourceParser::PositionState IncrementalCounter::GetLineType(const size_t &line) const
+{
+	assert(line < lineCount);
+	size_t offset;
+	const size_t index(FindBlock(line, offset));
+	return static_cast<SourceParser::PositionState>(blocks[index].lineTypes[offset]);
+}
+
+//==========================================================================
+// Class:			IncrementalCounter
+// Function:		UncountLine
+//
+// Description:		Reverses LineCounter::CountLine().
+//
+// Input Arguments:
+//		state		= const SourceParser::PositionState&
+//
+// Output Arguments:
+//		statistics	= LineCounter::Statistics&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void IncrementalCounter::UncountLine(const SourceParser::PositionState &state,
+	LineCounter::Statistics &statistics)
+{
+	if (state == SourceParser::PositionBlockComment ||
+		state == SourceParser::PositionComment ||
+		state == SourceParser::PositionContinuingComment)
+		statistics.commentLines--;
+	else if (state == SourceParser::PositionWhitespace)
+		statistics.blankLines--;
+	else
+		statistics.codeLines--;
+}
@@ -0,0 +1,79 @@
+// File:  incrementalCounter.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Keeps the line counts of a file up to date as it is edited.  Lines
+//        are stored in blocks of up to a few lines, each with the parser
+//        state at its start, so an edit only changes the blocks it touches;
+//        it is parsed starting from the start of the first of those blocks,
+//        and parsing stops as soon as the state at the start of a following
+//        block matches the state saved there before the edit.
+
+#ifndef INCREMENTAL_COUNTER_H_
+#define INCREMENTAL_COUNTER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <utility>
+
+// Local headers
+#include "sourceParser.h"
+#include "lineCounter.h"
+
+class IncrementalCounter
+{
+public:
+	IncrementalCounter(const std::vector<std::string> &commentIndicators,
+		const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
+		const std::vector<std::string> &continuationIndicators,
+		const unsigned int &checkpointInterval = 64);
+
+	// Replaces the whole file; lines are split as LineCounter splits them
+	void SetText(const char *buffer, const size_t &length);
+
+	// Replaces removedCount lines starting at firstLine with newLines (either
+	// may be empty).  Returns false if the range is outside of the file.
+	bool ReplaceLines(const size_t &firstLine, const size_t &removedCount,
+		const std::vector<std::string> &newLines);
+
+	LineCounter::Statistics GetStatistics(void) const { return statistics; };
+	size_t GetLineCount(void) const { return lineCount; };
+	SourceParser::PositionState GetLineType(const size_t &line) const;
+
+	// Number of lines parsed by the most recent change
+	size_t GetParsedLineCount(void) const { return parsedLineCount; };
+
+private:
+	const unsigned int checkpointInterval;// Maximum number of lines in a block
+
+	SourceParser parser;
+	LineCounter::Statistics statistics;
+
+	// Parser state at the start of a block
+	struct Checkpoint
+	{
+		SourceParser::PositionState state;
+		size_t blockCommentIndex;
+	};
+
+	struct Block
+	{
+		Checkpoint start;
+		std::vector<std::string> lines;// Never empty
+		std::vector<unsigned char> lineTypes;// PositionState returned for each line
+	};
+
+	std::vector<Block> blocks;
+	size_t lineCount;
+
+	size_t parsedLineCount;
+
+	size_t FindBlock(const size_t &line, size_t &offset) const;
+	void Parse(size_t index, const Checkpoint &start, const size_t &compareIndex);
+	bool ParserStateMatches(const Checkpoint &checkpoint) const;
+	Checkpoint MakeCheckpoint(void) const;
+
+	static void UncountLine(const SourceParser::PositionState &state, LineCounter::Statistics &statistics);
+};
+
+#endif// INCREMENTAL_COUNTER_H_
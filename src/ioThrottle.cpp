@@ -0,0 +1,150 @@
+// File:  ioThrottle.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Limits the rate at which files are read, so a search can run
+//        alongside other work without taking all of the disk bandwidth.
+
+#ifdef WIN32
+// Windows headers
+#include <windows.h>
+#elif defined(__linux__)
+// *nix headers
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+// Standard C++ headers
+#include <algorithm>
+#include <thread>
+
+// Local headers
+#include "ioThrottle.h"
+
+//==========================================================================
+// Class:			IoThrottle
+// Function:		IoThrottle
+//
+// Description:		Constructor for IoThrottle class.  The buckets start
+//					full.
+//
+// Input Arguments:
+//		bytesPerSecond		= const unsigned long long&
+//		operationsPerSecond	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+IoThrottle::IoThrottle(const unsigned long long &bytesPerSecond,
+	const unsigned int &operationsPerSecond)
+{
+	byteBucket.rate = static_cast<double>(bytesPerSecond);
+	byteBucket.tokens = byteBucket.rate;
+	operationBucket.rate = operationsPerSecond;
+	operationBucket.tokens = operationBucket.rate;
+	lastRefill = std::chrono::steady_clock::now();
+}
+
+//==========================================================================
+// Class:			IoThrottle
+// Function:		Acquire
+//
+// Description:		Takes the tokens for one read of the specified size,
+//					waiting if they have not yet been refilled.
+//
+// Input Arguments:
+//		bytes	= const unsigned long long&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void IoThrottle::Acquire(const unsigned long long &bytes)
+{
+	if (!IsEnabled())
+		return;
+
+	double wait;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		const std::chrono::steady_clock::time_point now(std::chrono::steady_clock::now());
+		const double elapsed(std::chrono::duration<double>(now - lastRefill).count());
+		lastRefill = now;
+
+		wait = std::max(Take(byteBucket, static_cast<double>(bytes), elapsed),
+			Take(operationBucket, 1.0, elapsed));
+	}
+
+	if (wait > 0.0)
+		std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+}
+
+//==========================================================================
+// Class:			IoThrottle
+// Function:		Take
+//
+// Description:		Refills the bucket for the elapsed time (up to one
+//					second's worth) and takes the specified number of tokens.
+//
+// Input Arguments:
+//		bucket	= Bucket&
+//		amount	= const double&
+//		elapsed	= const double&, time since the last refill [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double, time until the bucket is out of debt [sec]
+//
+//==========================================================================
+double IoThrottle::Take(Bucket &bucket, const double &amount, const double &elapsed)
+{
+	if (bucket.rate <= 0.0)
+		return 0.0;
+
+	bucket.tokens = std::min(bucket.rate, bucket.tokens + elapsed * bucket.rate);
+	bucket.tokens -= amount;
+	if (bucket.tokens >= 0.0)
+		return 0.0;
+	return -bucket.tokens / bucket.rate;
+}
+
+//==========================================================================
+// Class:			IoThrottle
+// Function:		SetIdlePriority
+//
+// Description:		Lowers the I/O priority of the process.  On Linux, this
+//					uses the idle scheduling class; on Windows, background
+//					processing mode (which also lowers the memory priority).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool IoThrottle::SetIdlePriority(void)
+{
+#ifdef WIN32
+	return SetPriorityClass(GetCurrentProcess(), PROCESS_MODE_BACKGROUND_BEGIN) != 0;
+#elif defined(__linux__) && defined(SYS_ioprio_set)
+	// From linux/ioprio.h, which isn't available everywhere
+	const int whoProcess(1);// IOPRIO_WHO_PROCESS
+	const int idleClass(3);// IOPRIO_CLASS_IDLE
+	const int classShift(13);// IOPRIO_CLASS_SHIFT
+	return syscall(SYS_ioprio_set, whoProcess, 0, idleClass << classShift) == 0;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,49 @@
+// File:  ioThrottle.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Limits the rate at which files are read, so a search can run
+//        alongside other work without taking all of the disk bandwidth.
+
+#ifndef IO_THROTTLE_H_
+#define IO_THROTTLE_H_
+
+// Standard C++ headers
+#include <mutex>
+#include <chrono>
+
+// Token buckets for bytes and for read operations, each holding up to one
+// second's worth of tokens.  A read may take more tokens than are available;
+// the caller then waits until the deficit has been refilled, and later
+// callers wait longer, so the average rate never exceeds the limits.
+class IoThrottle
+{
+public:
+	// Zero for no limit
+	IoThrottle(const unsigned long long &bytesPerSecond,
+		const unsigned int &operationsPerSecond);
+
+	bool IsEnabled(void) const { return byteBucket.rate > 0.0 || operationBucket.rate > 0.0; };
+
+	// Blocks until a read of the specified size is allowed (thread-safe)
+	void Acquire(const unsigned long long &bytes);
+
+	// Gives this process's reads idle priority (only served when the disk
+	// would otherwise be idle); applies to threads started afterwards
+	static bool SetIdlePriority(void);
+
+private:
+	struct Bucket
+	{
+		double rate;// [tokens/sec]
+		double tokens;// Negative when in debt
+	};
+
+	std::mutex mutex;
+	std::chrono::steady_clock::time_point lastRefill;
+	Bucket byteBucket;
+	Bucket operationBucket;
+
+	static double Take(Bucket &bucket, const double &amount, const double &elapsed);
+};
+
+#endif// IO_THROTTLE_H_
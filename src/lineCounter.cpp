@@ -3,16 +3,46 @@
 // Auth:  K. Loux
 // Desc:  Parses the specified files to generate line count statistics.
 
+#ifdef WIN32
+// Windows headers
+#include <windows.h>
+#else
+// *nix headers
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // Standard C++ headers
 #include <fstream>
 #include <iostream>
 #include <cassert>
+#include <cstring>
 
 // Local headers
 #include "lineCounter.h"
+#include "chunkedParser.h"
 
 using namespace std;
 
+//==========================================================================
+// Class:			LineCounter
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for LineCounter class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int LineCounter::linesPerDeadlineCheck(4096);
+
 //==========================================================================
 // Class:			LineCounter
 // Function:		LineCounter
@@ -40,6 +70,48 @@ LineCounter::LineCounter(const std::vector<std::string> &commentIndicators,
 	statistics.codeLines = 0;
 	statistics.commentLines = 0;
 	statistics.fileCount = 0;
+
+	parallelThreadCount = 1;
+	parallelMinimumFileSize = 0;
+	threadBudget = NULL;
+
+	streamEncodingKnown = false;
+	streamDecoding = false;
+
+	recorder = NULL;
+
+	deadline = NULL;
+	stopped = false;
+	parsedBytes = 0;
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		SetParallelParsing
+//
+// Description:		Configures splitting of large files into chunks which
+//					are parsed in parallel.
+//
+// Input Arguments:
+//		threadCount		= const unsigned int&, values less than 2 disable
+//						  parallel parsing
+//		minimumFileSize	= const unsigned long long&, in bytes
+//		budget			= ThreadBudget*, shared with other threads (NULL for
+//						  no limit)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::SetParallelParsing(const unsigned int &threadCount,
+	const unsigned long long &minimumFileSize, ThreadBudget *budget)
+{
+	parallelThreadCount = threadCount;
+	parallelMinimumFileSize = minimumFileSize;
+	threadBudget = budget;
 }
 
 //==========================================================================
@@ -47,6 +119,10 @@ LineCounter::LineCounter(const std::vector<std::string> &commentIndicators,
 // Function:		ProcessFile
 //
 // Description:		Parses the specified file and updates our internal statistics.
+//					UTF-16 files (identified by their byte order marks) are
+//					converted to UTF-8 as they are read.  If the deadline
+//					passes first, the lines parsed so far are counted, but
+//					not the file.
 //
 // Input Arguments:
 //		fileName	= std::string
@@ -60,6 +136,9 @@ LineCounter::LineCounter(const std::vector<std::string> &commentIndicators,
 //==========================================================================
 bool LineCounter::ProcessFile(std::string fileName)
 {
+	stopped = false;
+	parsedBytes = 0;
+
 	ifstream file(fileName.c_str(), ios::in);
 	if (!file.is_open() || !file.good())
 	{
@@ -67,24 +146,57 @@ bool LineCounter::ProcessFile(std::string fileName)
 		return false;
 	}
 
+	char head[3];
+	file.read(head, sizeof(head));
+	size_t bomLength;
+	if (TextDecoder::DetectEncoding(head, static_cast<size_t>(file.gcount()), bomLength)
+		!= TextDecoder::EncodingUtf8)
+	{
+		file.close();
+		return ProcessEncodedFile(fileName);
+	}
+	file.clear();
+	file.seekg(0);
+
 	statistics.fileCount++;
+	if (recorder)
+		recorder->Clear();
+
+	unsigned long long fileSize;
+	if (parallelThreadCount > 1 && !recorder && GetFileSize(fileName, fileSize) &&
+		fileSize >= parallelMinimumFileSize)
+	{
+		file.close();
+		ChunkedParser chunkedParser(parser, parallelThreadCount, threadBudget);
+		chunkedParser.SetDeadline(deadline);
+		if (!chunkedParser.ProcessFile(fileName, fileSize, statistics, parsedBytes))
+			return false;
+
+		if (parsedBytes < fileSize)
+		{
+			stopped = true;
+			statistics.fileCount--;
+		}
+		return true;
+	}
+
 	parser.Reset();
 
 	string currentLine;
-	SourceParser::PositionState state;
+	unsigned int linesUntilCheck(linesPerDeadlineCheck);
 	while (getline(file, currentLine))
 	{
-		state = parser.ParseLine(currentLine);
-		if (state == SourceParser::PositionBlockComment ||
-			state == SourceParser::PositionComment ||
-			state == SourceParser::PositionContinuingComment)
-			statistics.commentLines++;
-		else if (state == SourceParser::PositionWhitespace)
-			statistics.blankLines++;
-		else
+		CountParsedLine(parser.ParseLine(currentLine));
+		if (deadline && --linesUntilCheck == 0)
 		{
-			assert(state == SourceParser::PositionCode);
-			statistics.codeLines++;
+			linesUntilCheck = linesPerDeadlineCheck;
+			if (deadline->HasPassed())
+			{
+				stopped = true;
+				statistics.fileCount--;
+				parsedBytes = static_cast<unsigned long long>(file.tellg());
+				break;
+			}
 		}
 	}
 
@@ -92,3 +204,400 @@ bool LineCounter::ProcessFile(std::string fileName)
 
 	return true;
 }
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		ProcessBuffer
+//
+// Description:		Parses the contents of a file which has already been read
+//					into memory and updates our internal statistics.  Lines
+//					are split the same way as std::getline() splits them.
+//					UTF-16 contents are converted to UTF-8 first.
+//
+// Input Arguments:
+//		buffer	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::ProcessBuffer(const char *buffer, const size_t &length)
+{
+	stopped = false;
+	statistics.fileCount++;
+	parser.Reset();
+	if (recorder)
+		recorder->Clear();
+
+	size_t bomLength;
+	const TextDecoder::Encoding encoding(TextDecoder::DetectEncoding(buffer, length, bomLength));
+	if (encoding == TextDecoder::EncodingUtf8)
+	{
+		ParseBuffer(buffer, length);
+		return;
+	}
+
+	decoder.Reset(encoding);
+	decoded.clear();
+	decoder.Decode(buffer + bomLength, length - bomLength, decoded);
+	decoder.Finish(decoded);
+	ParseBuffer(decoded.data(), decoded.length());
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		ParseBuffer
+//
+// Description:		Parses the lines of UTF-8 text in the specified buffer.
+//
+// Input Arguments:
+//		buffer	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::ParseBuffer(const char *buffer, const size_t &length)
+{
+	const char *end(buffer + length);
+	const char *lineEnd;
+	while (buffer != end)
+	{
+		lineEnd = static_cast<const char*>(memchr(buffer, '\n', end - buffer));
+		if (!lineEnd)
+			lineEnd = end;
+
+		CountParsedLine(parser.ParseLine(buffer, lineEnd));
+		buffer = lineEnd == end ? end : lineEnd + 1;
+	}
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		BeginStream
+//
+// Description:		Prepares to parse a file passed in pieces to
+//					ProcessChunk().
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::BeginStream(void)
+{
+	stopped = false;
+	statistics.fileCount++;
+	parser.Reset();
+	pendingLine.clear();
+	if (recorder)
+		recorder->Clear();
+
+	streamEncodingKnown = false;
+	streamDecoding = false;
+	streamHead.clear();
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		ProcessChunk
+//
+// Description:		Parses the next piece of a file.  The encoding is
+//					determined once the first few bytes have arrived.
+//
+// Input Arguments:
+//		buffer	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::ProcessChunk(const char *buffer, const size_t &length)
+{
+	if (!streamEncodingKnown)
+	{
+		streamHead.append(buffer, length);
+		if (streamHead.length() >= 3)
+			StartStreamDecoding();
+		return;
+	}
+
+	if (!streamDecoding)
+	{
+		ParseChunk(buffer, length);
+		return;
+	}
+
+	decoded.clear();
+	decoder.Decode(buffer, length, decoded);
+	ParseChunk(decoded.data(), decoded.length());
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		ParseChunk
+//
+// Description:		Parses the next piece of UTF-8 text.  Complete lines are
+//					parsed in place; a line which is cut off at the end of
+//					the chunk is held until the rest of it arrives.
+//
+// Input Arguments:
+//		buffer	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::ParseChunk(const char *buffer, const size_t &length)
+{
+	const char *end(buffer + length);
+	const char *lineEnd;
+	while (buffer != end)
+	{
+		lineEnd = static_cast<const char*>(memchr(buffer, '\n', end - buffer));
+		if (!lineEnd)
+		{
+			pendingLine.append(buffer, end);
+			return;
+		}
+
+		if (pendingLine.empty())
+			CountParsedLine(parser.ParseLine(buffer, lineEnd));
+		else
+		{
+			pendingLine.append(buffer, lineEnd);
+			CountParsedLine(parser.ParseLine(pendingLine));
+			pendingLine.clear();
+		}
+
+		buffer = lineEnd + 1;
+	}
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		EndStream
+//
+// Description:		Parses the last line of a streamed file, if it did not
+//					end with a newline.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::EndStream(void)
+{
+	if (!streamEncodingKnown)
+		StartStreamDecoding();
+
+	if (streamDecoding)
+	{
+		decoded.clear();
+		decoder.Finish(decoded);
+		ParseChunk(decoded.data(), decoded.length());
+	}
+
+	if (!pendingLine.empty())
+	{
+		CountParsedLine(parser.ParseLine(pendingLine));
+		pendingLine.clear();
+	}
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		StopStream
+//
+// Description:		Ends a streamed file which was cut short by the deadline.
+//					The lines parsed so far remain counted, but the file does
+//					not, and the partial line held for the next chunk is
+//					dropped.
+//
+// Input Arguments:
+//		parsedBytes	= const unsigned long long&, passed to ProcessChunk() so
+//					  far
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::StopStream(const unsigned long long &parsedBytes)
+{
+	stopped = true;
+	statistics.fileCount--;
+	this->parsedBytes = parsedBytes;
+	pendingLine.clear();
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		StartStreamDecoding
+//
+// Description:		Determines the encoding of a stream from the bytes held
+//					so far, and parses them.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::StartStreamDecoding(void)
+{
+	size_t bomLength;
+	const TextDecoder::Encoding encoding(TextDecoder::DetectEncoding(
+		streamHead.data(), streamHead.length(), bomLength));
+
+	streamEncodingKnown = true;
+	streamDecoding = encoding != TextDecoder::EncodingUtf8;
+	if (streamDecoding)
+		decoder.Reset(encoding);
+
+	std::string head;
+	head.swap(streamHead);
+	ProcessChunk(head.data() + bomLength, head.length() - bomLength);
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		ProcessEncodedFile
+//
+// Description:		Parses a UTF-16 file, converting it in pieces so memory
+//					use doesn't depend on the size of the file.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LineCounter::ProcessEncodedFile(const std::string &fileName)
+{
+	ifstream file(fileName.c_str(), ios::in | ios::binary);
+	if (!file.is_open() || !file.good())
+	{
+		cout << "  Error reading file!  Skipping..." << endl;
+		return false;
+	}
+
+	std::vector<char> buffer(64 * 1024);
+	BeginStream();
+	while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+	{
+		ProcessChunk(buffer.data(), static_cast<size_t>(file.gcount()));
+		parsedBytes += static_cast<unsigned long long>(file.gcount());
+		if (deadline && deadline->HasPassed())
+		{
+			// The partial line held for the next chunk is left uncounted
+			stopped = true;
+			statistics.fileCount--;
+			return true;
+		}
+	}
+	EndStream();
+
+	return !file.bad();
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		CountLine
+//
+// Description:		Adds a line in the specified state to the statistics.
+//
+// Input Arguments:
+//		state		= const SourceParser::PositionState&
+//
+// Output Arguments:
+//		statistics	= Statistics&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounter::CountLine(const SourceParser::PositionState &state, Statistics &statistics)
+{
+	if (state == SourceParser::PositionBlockComment ||
+		state == SourceParser::PositionComment ||
+		state == SourceParser::PositionContinuingComment)
+		statistics.commentLines++;
+	else if (state == SourceParser::PositionWhitespace)
+		statistics.blankLines++;
+	else
+	{
+		assert(state == SourceParser::PositionCode);
+		statistics.codeLines++;
+	}
+}
+
+//==========================================================================
+// Class:			LineCounter
+// Function:		GetFileSize
+//
+// Description:		Determines the size of the specified file.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		size		= unsigned long long&, in bytes
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LineCounter::GetFileSize(const std::string &fileName, unsigned long long &size)
+{
+#ifdef WIN32
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (!GetFileAttributesExA(fileName.c_str(), GetFileExInfoStandard, &data))
+		return false;
+
+	size = ((unsigned long long)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+#else
+	struct stat st;
+	if (stat(fileName.c_str(), &st) == -1)
+		return false;
+
+	size = st.st_size;
+#endif
+	return true;
+}
@@ -13,6 +13,11 @@
 
 // Local headers
 #include "sourceParser.h"
+#include "textDecoder.h"
+#include "lineTypeRecorder.h"
+#include "deadline.h"
+
+class ThreadBudget;
 
 class LineCounter
 {
@@ -22,20 +27,82 @@ public:
 		const std::vector<std::string> &continuationIndicators);
 
 	bool ProcessFile(std::string fileName);
+	void ProcessBuffer(const char *buffer, const size_t &length);
+
+	// For files which arrive in pieces; lines may span chunks.  A stream cut
+	// short by the deadline is ended with StopStream() instead of
+	// EndStream(); see SetDeadline().
+	void BeginStream(void);
+	void ProcessChunk(const char *buffer, const size_t &length);
+	void EndStream(void);
+	void StopStream(const unsigned long long &parsedBytes);
+
+	// Files at least minimumFileSize bytes long are split into chunks and
+	// parsed using up to the specified number of threads (only as many as
+	// the budget has available, if one is given; see ChunkedParser)
+	void SetParallelParsing(const unsigned int &threadCount,
+		const unsigned long long &minimumFileSize, ThreadBudget *budget = NULL);
+
+	// When set, the recorder is cleared at the start of each file and holds
+	// the type of each line of the last file (files are never split into
+	// chunks, since chunks are only counted, not classified line by line)
+	void SetLineTypeRecorder(LineTypeRecorder *recorder) { this->recorder = recorder; };
+
+	// When set, ProcessFile() stops parsing once the deadline has passed.
+	// WasStopped() is then true, and the lines in the first GetParsedBytes()
+	// bytes of the file are counted, but not the file itself.
+	void SetDeadline(const Deadline *deadline) { this->deadline = deadline; };
+	bool WasStopped(void) const { return stopped; };
+	unsigned long long GetParsedBytes(void) const { return parsedBytes; };
 
 	struct Statistics
 	{
-		unsigned int blankLines;
-		unsigned int commentLines;
-		unsigned int codeLines;
-		unsigned int fileCount;
+		unsigned long long blankLines;
+		unsigned long long commentLines;
+		unsigned long long codeLines;
+		unsigned long long fileCount;
 	};
 
 	Statistics GetStatistics(void) const { return statistics; };
 
+	static void CountLine(const SourceParser::PositionState &state, Statistics &statistics);
+	static const unsigned int linesPerDeadlineCheck;
+	static bool GetFileSize(const std::string &fileName, unsigned long long &size);
+
 private:
 	SourceParser parser;
 	Statistics statistics;
+
+	std::string pendingLine;// Start of a line which continues in the next chunk
+
+	// For UTF-16 files, which are converted to UTF-8 before parsing
+	TextDecoder decoder;
+	std::string decoded;
+	bool streamEncodingKnown;
+	bool streamDecoding;
+	std::string streamHead;// Start of a stream, until its encoding is known
+
+	LineTypeRecorder *recorder;
+
+	const Deadline *deadline;
+	bool stopped;
+	unsigned long long parsedBytes;// Of the last file, if stopped
+
+	inline void CountParsedLine(const SourceParser::PositionState &state)
+	{
+		CountLine(state, statistics);
+		if (recorder)
+			recorder->Add(state);
+	};
+
+	void ParseBuffer(const char *buffer, const size_t &length);
+	void ParseChunk(const char *buffer, const size_t &length);
+	void StartStreamDecoding(void);
+	bool ProcessEncodedFile(const std::string &fileName);
+
+	unsigned int parallelThreadCount;
+	unsigned long long parallelMinimumFileSize;
+	ThreadBudget *threadBudget;
 };
 
 #endif// LINE_COUNTER_H_
@@ -9,13 +9,17 @@
 
 // Standard C++ headers
 #include <iostream>
-
-// wxWidgets headers
-#include <wx/dir.h>
+#include <sstream>
+#include <fstream>
 
 // Local headers
 #include "lineCounterApplication.h"
+#include "pipeline.h"
+#include "partialResults.h"
+#include "coordinator.h"
+#include "worker.h"
 #include "traverser.h"
+#include "diffCounter.h"
 
 using namespace std;
 
@@ -60,7 +64,35 @@ int main (int argc, char *argv[])
 //==========================================================================
 LineCounterApplication::LineCounterApplication()
 {
-	traverser = NULL;
+	statistics.blankLines = 0;
+	statistics.commentLines = 0;
+	statistics.codeLines = 0;
+	statistics.fileCount = 0;
+	prunedDirectoryCount = 0;
+
+	unsigned int i;
+	for (i = 0; i < ContentClassifier::ContentTypeCount; i++)
+	{
+		skippedFileCount[i] = 0;
+		skippedBytes[i] = 0;
+	}
+
+	shardIndex = 0;
+	shardCount = 1;
+	shardBySubtree = false;
+	sampleError = 0.0;
+	lineTypeWriter = NULL;
+	fileResultWriter = NULL;
+	checkpointJournal = NULL;
+	remainderEstimator = NULL;
+	searchStopped = false;
+	fileList = NULL;
+	fileListNulDelimited = false;
+
+	// Not all modes read the configuration
+	info.recurseIntoSubDirectories = false;
+	info.useGitIgnore = false;
+	info.skipNonSource = false;
 }
 
 //==========================================================================
@@ -81,14 +113,14 @@ LineCounterApplication::LineCounterApplication()
 //==========================================================================
 LineCounterApplication::~LineCounterApplication()
 {
-	delete traverser;
 }
 
 //==========================================================================
 // Class:			LineCounterApplication
 // Function:		Run
 //
-// Description:		Main application function.
+// Description:		Main application function.  Chooses the mode based on
+//					the first argument.
 //
 // Input Arguments:
 //		argc	= int
@@ -103,23 +135,815 @@ LineCounterApplication::~LineCounterApplication()
 //==========================================================================
 int LineCounterApplication::Run(int argc, char *argv[])
 {
-	if (argc != 2)
+	if (argc < 2)
 	{
 		PrintUsageInformation(argv[0]);
 		return 1;
 	}
 
-	if (!UpdateConfiguration(argv[1]))
+	const std::string mode(argv[1]);
+	if (mode == "coordinate")
+		return RunCoordinator(argc, argv);
+	else if (mode == "worker")
+		return RunWorker(argc, argv);
+	else if (mode == "merge")
+		return RunMerge(argc, argv);
+	else if (mode == "changes")
+		return RunChanges(argc, argv);
+	else if (mode == "diff")
+		return RunDiff(argc, argv);
+
+	return RunCount(argc, argv);
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		RunCount
+//
+// Description:		Counts the lines in the files described by the
+//					configuration file (or one shard of them), and either
+//					prints the statistics or saves them for merging with
+//					other partial results.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, 0 for success, 1 otherwise
+//
+//==========================================================================
+int LineCounterApplication::RunCount(int argc, char *argv[])
+{
+	std::string partialFileName, lineTypeFileName, resultsFileName, checkpointFileName;
+	std::string fileListName;
+	LineTypeWriter::Format lineTypeFormat(LineTypeWriter::FormatNdjson);
+	bool resume(false);
+	int i;
+	for (i = 2; i < argc; i++)
+	{
+		const std::string argument(argv[i]);
+		if (argument == "--shard" && i + 1 < argc)
+		{
+			const std::string shard(argv[++i]);
+			const size_t slash(shard.find('/'));
+			if (slash == std::string::npos ||
+				!ParseUnsigned(shard.substr(0, slash), shardIndex) ||
+				!ParseUnsigned(shard.substr(slash + 1), shardCount) ||
+				shardIndex >= shardCount)
+			{
+				cout << "Invalid shard '" << shard << "'" << endl;
+				return 1;
+			}
+		}
+		else if (argument == "--shard-by" && i + 1 < argc)
+		{
+			if (!ParseShardMode(argv[++i], shardBySubtree))
+				return 1;
+		}
+		else if (argument == "--partial" && i + 1 < argc)
+			partialFileName = argv[++i];
+		else if (argument == "--sample" && i + 1 < argc)
+		{
+			if (!ParsePercentage(argv[++i], sampleError))
+			{
+				cout << "Invalid sample error '" << argv[i]
+					<< "' (must be a percentage greater than zero)" << endl;
+				return 1;
+			}
+		}
+		else if (argument == "--results" && i + 1 < argc)
+			resultsFileName = argv[++i];
+		else if (argument == "--checkpoint" && i + 1 < argc)
+			checkpointFileName = argv[++i];
+		else if (argument == "--resume")
+			resume = true;
+		else if ((argument == "--files-from" || argument == "--files-from0") && i + 1 < argc)
+		{
+			fileListNulDelimited = argument == "--files-from0";
+			fileListName = argv[++i];
+		}
+		else if (argument == "--deadline" && i + 1 < argc)
+		{
+			// Starts now, so the time to read the configuration is included
+			unsigned int milliseconds;
+			if (!ParseUnsigned(argv[++i], milliseconds) || milliseconds == 0)
+			{
+				cout << "Invalid deadline '" << argv[i]
+					<< "' (must be a number of milliseconds greater than zero)" << endl;
+				return 1;
+			}
+			deadline.Set(milliseconds);
+		}
+		else if (argument == "--line-types" && i + 1 < argc)
+			lineTypeFileName = argv[++i];
+		else if (argument == "--line-types-format" && i + 1 < argc)
+		{
+			if (!ParseLineTypeFormat(argv[++i], lineTypeFormat))
+				return 1;
+		}
+		else
+		{
+			PrintUsageInformation(argv[0]);
+			return 1;
+		}
+	}
+
+	if (sampleError > 0.0 && !partialFileName.empty())
+	{
+		cout << "Estimated results cannot be saved as partial results" << endl;
+		return 1;
+	}
+	else if (sampleError > 0.0 && !resultsFileName.empty())
+	{
+		cout << "Per-file results cannot be saved when sampling" << endl;
+		return 1;
+	}
+	else if (sampleError > 0.0 && !checkpointFileName.empty())
+	{
+		cout << "Checkpoints cannot be saved when sampling" << endl;
+		return 1;
+	}
+	else if (resume && checkpointFileName.empty())
+	{
+		cout << "Must specify --checkpoint to resume" << endl;
+		return 1;
+	}
+	else if (resume && !lineTypeFileName.empty())
+	{
+		cout << "Line types cannot be written when resuming" << endl;
+		return 1;
+	}
+	else if (deadline.IsSet() && sampleError > 0.0)
+	{
+		cout << "A deadline cannot be used when sampling" << endl;
 		return 1;
+	}
+	else if (deadline.IsSet() && !partialFileName.empty())
+	{
+		cout << "Partial results cannot be saved with a deadline" << endl;
+		return 1;
+	}
+	else if (!fileListName.empty() && sampleError > 0.0)
+	{
+		cout << "A file list cannot be used when sampling" << endl;
+		return 1;
+	}
+	else if (!fileListName.empty() && shardCount > 1)
+	{
+		cout << "A file list cannot be sharded" << endl;
+		return 1;
+	}
+
+	// Directories aren't needed when the files are listed
+	if (!UpdateConfiguration(argv[1], fileListName.empty()))
+		return 1;
+
+	std::ifstream fileListFile;
+	if (fileListName == "-")
+		fileList = &cin;
+	else if (!fileListName.empty())
+	{
+		fileListFile.open(fileListName.c_str(), std::ios::binary);
+		if (!fileListFile.is_open())
+		{
+			cout << "Failed to open file list '" << fileListName << "'" << endl;
+			return 1;
+		}
+		fileList = &fileListFile;
+	}
+
+	LineTypeWriter writer;
+	if (!lineTypeFileName.empty())
+	{
+		if (!writer.Open(lineTypeFileName, lineTypeFormat))
+		{
+			cout << "Failed to open '" << lineTypeFileName << "' for writing line types" << endl;
+			return 1;
+		}
+		lineTypeWriter = &writer;
+	}
+
+	FileResultWriter resultWriter;
+	if (!resultsFileName.empty())
+		fileResultWriter = &resultWriter;
+
+	// Sees the results ahead of the writer, to estimate the lines in the
+	// files which aren't counted before the deadline
+	RemainderEstimator estimator;
+	if (deadline.IsSet())
+	{
+		estimator.SetFileResultHandler(fileResultWriter);
+		remainderEstimator = &estimator;
+	}
+
+	// Files counted by an earlier run are included in the per-file results
+	// (and the estimate)
+	CheckpointJournal journal;
+	if (!checkpointFileName.empty())
+	{
+		if (!journal.Open(checkpointFileName, resume, remainderEstimator ?
+			static_cast<FileResultHandler*>(remainderEstimator) : fileResultWriter))
+		{
+			cout << "Failed to open checkpoint journal '" << checkpointFileName << "'" << endl;
+			return 1;
+		}
+		checkpointJournal = &journal;
+
+		if (resume)
+			cout << "Resuming:  " << journal.GetResumedStatistics().fileCount
+				<< " files and " << journal.GetResumedDirectoryCount()
+				<< " directories were completed by an earlier run" << endl;
+	}
 
-	traverser = new Traverser(info.extensionList, info.commentList,
-		info.blockCommentList, info.continuationList);
-	ParseFiles();
+	if (sampleError > 0.0)
+		SampleFiles();
+	else
+		ParseFiles();
 	PrintCodeStatistics();
+	remainderEstimator = NULL;
+	fileList = NULL;
+
+	checkpointJournal = NULL;
+	if (!checkpointFileName.empty() && !journal.Close())
+	{
+		cout << "Failed to write checkpoint journal '" << checkpointFileName << "'" << endl;
+		return 1;
+	}
+
+	fileResultWriter = NULL;
+	if (!resultsFileName.empty())
+	{
+		if (!resultWriter.Write(resultsFileName))
+		{
+			cout << "Failed to write per-file results to '" << resultsFileName << "'" << endl;
+			return 1;
+		}
+
+		if (statistics.fileCount > 0)
+			cout << "Memory used for per-file results: " << resultWriter.GetMemoryUsage()
+				<< " bytes (" << resultWriter.GetMemoryUsage() / statistics.fileCount << " per file)" << endl;
+	}
+
+	lineTypeWriter = NULL;
+	if (!lineTypeFileName.empty() && !writer.Close())
+	{
+		cout << "Failed to write line types to '" << lineTypeFileName << "'" << endl;
+		return 1;
+	}
+
+	if (!partialFileName.empty() && !PartialResults::Write(partialFileName, statistics))
+	{
+		cout << "Failed to write partial results to '" << partialFileName << "'" << endl;
+		return 1;
+	}
 
 	return 0;
 }
 
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		RunCoordinator
+//
+// Description:		Splits the search into shards and hands them out to
+//					worker processes, which may be started here or connect
+//					from other machines.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, 0 for success, 1 otherwise
+//
+//==========================================================================
+int LineCounterApplication::RunCoordinator(int argc, char *argv[])
+{
+	if (argc < 3)
+	{
+		PrintUsageInformation(argv[0]);
+		return 1;
+	}
+
+	unsigned int workerCount(0), port(0), shards(0);
+	std::string bindAddress;
+	int i;
+	for (i = 3; i < argc; i++)
+	{
+		const std::string argument(argv[i]);
+		bool ok(i + 1 < argc);
+		if (ok && argument == "--workers")
+			ok = ParseUnsigned(argv[++i], workerCount);
+		else if (ok && argument == "--port")
+			ok = ParseUnsigned(argv[++i], port) && port < 65536;
+		else if (ok && argument == "--bind")
+			bindAddress = argv[++i];
+		else if (ok && argument == "--shards")
+			ok = ParseUnsigned(argv[++i], shards) && shards > 0;
+		else if (ok && argument == "--shard-by")
+			ok = ParseShardMode(argv[++i], shardBySubtree);
+		else
+			ok = false;
+
+		if (!ok)
+		{
+			PrintUsageInformation(argv[0]);
+			return 1;
+		}
+	}
+
+	if (shards == 0)
+	{
+		if (workerCount == 0)
+		{
+			cout << "Must specify --shards when not starting local workers" << endl;
+			return 1;
+		}
+		shards = workerCount;
+	}
+
+	// Workers are not authenticated, so only accept connections from other
+	// machines when asked to
+	if (bindAddress.empty())
+	{
+		if (workerCount == 0)
+		{
+			cout << "Must specify --bind <address> for workers on other machines" << endl;
+			return 1;
+		}
+		bindAddress = "127.0.0.1";
+	}
+
+	Coordinator coordinator(shards, shardBySubtree);
+	if (!coordinator.Listen(static_cast<unsigned short>(port), bindAddress))
+	{
+		cout << "Failed to listen on " << bindAddress << " port " << port << endl;
+		return 1;
+	}
+
+	cout << "Waiting for workers on port " << coordinator.GetPort()
+		<< " (" << shards << " shards)" << endl;
+	if (!coordinator.StartLocalWorkers(argv[0], argv[2], workerCount))
+	{
+		cout << "Failed to start local workers" << endl;
+		return 1;
+	}
+
+	if (!coordinator.Run(statistics))
+		return 1;
+
+	PrintCodeStatistics();
+	return 0;
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		RunWorker
+//
+// Description:		Counts shards of the search on behalf of a coordinator.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, 0 for success, 1 otherwise
+//
+//==========================================================================
+int LineCounterApplication::RunWorker(int argc, char *argv[])
+{
+	std::string address;
+	if (argc == 5 && std::string(argv[3]) == "--connect")
+		address = argv[4];
+
+	const size_t colon(address.rfind(':'));
+	unsigned int port(0);
+	if (colon == std::string::npos || !ParseUnsigned(address.substr(colon + 1), port) ||
+		port == 0 || port >= 65536)
+	{
+		PrintUsageInformation(argv[0]);
+		return 1;
+	}
+
+	if (!UpdateConfiguration(argv[2]))
+		return 1;
+
+	Worker worker(info);
+	if (!worker.Run(address.substr(0, colon), static_cast<unsigned short>(port)))
+	{
+		cout << "Lost connection to coordinator at " << address << endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		RunMerge
+//
+// Description:		Combines partial results files (created with --partial)
+//					and prints the statistics.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, 0 for success, 1 otherwise
+//
+//==========================================================================
+int LineCounterApplication::RunMerge(int argc, char *argv[])
+{
+	if (argc < 3)
+	{
+		PrintUsageInformation(argv[0]);
+		return 1;
+	}
+
+	int i;
+	for (i = 2; i < argc; i++)
+	{
+		LineCounter::Statistics partial;
+		if (!PartialResults::Read(argv[i], partial))
+		{
+			cout << "Failed to read partial results from '" << argv[i] << "'" << endl;
+			return 1;
+		}
+		PartialResults::Add(partial, statistics);
+	}
+
+	PrintCodeStatistics();
+	return 0;
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		RunChanges
+//
+// Description:		Counts the lines added and removed by a unified diff (read
+//					from a file or from stdin) in files with the configured
+//					extensions, and prints the changes for each file and the
+//					totals.  Unchanged lines are read from the changed files
+//					under the root directory, if they are there.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, 0 for success, 1 otherwise
+//
+//==========================================================================
+int LineCounterApplication::RunChanges(int argc, char *argv[])
+{
+	if (argc < 3)
+	{
+		PrintUsageInformation(argv[0]);
+		return 1;
+	}
+
+	std::string diffFileName("-"), root(".");
+	int i;
+	for (i = 3; i < argc; i++)
+	{
+		const std::string argument(argv[i]);
+		if (argument == "--root" && i + 1 < argc)
+			root = argv[++i];
+		else if (i == 3 && argument.compare(0, 2, "--") != 0)
+			diffFileName = argument;
+		else
+		{
+			PrintUsageInformation(argv[0]);
+			return 1;
+		}
+	}
+
+	if (!UpdateConfiguration(argv[2]))
+		return 1;
+
+	std::ifstream diffFile;
+	if (diffFileName != "-")
+	{
+		diffFile.open(diffFileName.c_str(), std::ios::in | std::ios::binary);
+		if (!diffFile.is_open())
+		{
+			cout << "Failed to open '" << diffFileName << "'" << endl;
+			return 1;
+		}
+	}
+
+	std::vector<std::string> extensions(info.extensionList);
+	unsigned int j;
+	for (i = 0; i < static_cast<int>(extensions.size()); i++)
+	{
+		for (j = 0; j < extensions[i].length(); j++)
+			extensions[i][j] = tolower((unsigned char)extensions[i][j]);
+	}
+
+	DiffCounter counter(diffFileName == "-" ? cin : diffFile, root,
+		info.commentList, info.blockCommentList, info.continuationList);
+
+	LineCounter::Statistics added(statistics), removed(statistics);
+	unsigned int estimatedCount(0);
+	std::string path;
+	cout << endl;
+	while (counter.NextFile(path))
+	{
+		const size_t nameStart(path.find_last_of('/') + 1);
+		if (!Traverser::ExtensionMatches(path.c_str() + nameStart,
+			path.length() - nameStart, extensions))
+			continue;
+
+		DiffCounter::Delta delta;
+		counter.CountFile(delta);
+		cout << path << ":  code +" << delta.added.codeLines << " -" << delta.removed.codeLines
+			<< ", comment +" << delta.added.commentLines << " -" << delta.removed.commentLines
+			<< ", blank +" << delta.added.blankLines << " -" << delta.removed.blankLines;
+		if (!delta.exact)
+		{
+			cout << " (estimated)";
+			estimatedCount++;
+		}
+		cout << endl;
+
+		PartialResults::Add(delta.added, added);
+		PartialResults::Add(delta.removed, removed);
+		added.fileCount++;
+	}
+
+	if (counter.HasFailed())
+	{
+		cout << "Failed to read the diff (malformed hunk)" << endl;
+		return 1;
+	}
+
+	cout << endl;
+	cout << "Number of files changed: " << added.fileCount << endl;
+	cout << "Code lines: +" << added.codeLines << " -" << removed.codeLines << " (net "
+		<< showpos << static_cast<long long>(added.codeLines - removed.codeLines) << noshowpos << ")" << endl;
+	cout << "Comment lines: +" << added.commentLines << " -" << removed.commentLines << " (net "
+		<< showpos << static_cast<long long>(added.commentLines - removed.commentLines) << noshowpos << ")" << endl;
+	cout << "Blank lines: +" << added.blankLines << " -" << removed.blankLines << " (net "
+		<< showpos << static_cast<long long>(added.blankLines - removed.blankLines) << noshowpos << ")" << endl;
+	if (estimatedCount > 0)
+		cout << "Files with estimated changes (changed file not found or"
+			<< " different from the diff): " << estimatedCount << endl;
+	cout << endl;
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		RunDiff
+//
+// Description:		Compares two per-file result files and prints the
+//					changes in total, by extension, and for the directories
+//					and files which changed the most.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, 0 for success, 1 otherwise
+//
+//==========================================================================
+int LineCounterApplication::RunDiff(int argc, char *argv[])
+{
+	if (argc < 4)
+	{
+		PrintUsageInformation(argv[0]);
+		return 1;
+	}
+
+	unsigned int topCount(20);
+	int i;
+	for (i = 4; i < argc; i++)
+	{
+		const std::string argument(argv[i]);
+		if (argument == "--top" && i + 1 < argc)
+		{
+			if (!ParseUnsigned(argv[++i], topCount))
+			{
+				cout << "Invalid count '" << argv[i] << "'" << endl;
+				return 1;
+			}
+		}
+		else
+		{
+			PrintUsageInformation(argv[0]);
+			return 1;
+		}
+	}
+
+	FileResultReader before, after;
+	for (i = 2; i < 4; i++)
+	{
+		if (!(i == 2 ? before : after).Open(argv[i]))
+		{
+			cout << "Failed to read per-file results from '" << argv[i] << "'" << endl;
+			return 1;
+		}
+	}
+
+	ResultDiff diff(topCount);
+	if (!diff.Compare(before, after))
+	{
+		cout << "Failed to read per-file results from '"
+			<< (before.HasFailed() ? argv[2] : argv[3]) << "' (malformed or not sorted)" << endl;
+		return 1;
+	}
+
+	cout << endl;
+	cout << "Files added: " << diff.GetAddedFileCount()
+		<< ", removed: " << diff.GetRemovedFileCount()
+		<< ", changed: " << diff.GetChangedFileCount() << endl;
+	cout << "Total:  " << FormatChange(diff.GetTotal()) << endl;
+
+	unsigned int j;
+	cout << endl << "Changes by extension:" << endl;
+	for (j = 0; j < diff.GetExtensions().size(); j++)
+		cout << "  " << diff.GetExtensions()[j].name << ":  " << FormatChange(diff.GetExtensions()[j]) << endl;
+
+	cout << endl << "Largest changes by directory:" << endl;
+	for (j = 0; j < diff.GetDirectories().size(); j++)
+		cout << "  " << diff.GetDirectories()[j].name << ":  " << FormatChange(diff.GetDirectories()[j]) << endl;
+
+	cout << endl << "Largest changes by file:" << endl;
+	for (j = 0; j < diff.GetFiles().size(); j++)
+	{
+		const ResultDiff::Change &change(diff.GetFiles()[j]);
+		cout << "  " << change.name;
+		if (change.status == ResultDiff::StatusAdded)
+			cout << " (added)";
+		else if (change.status == ResultDiff::StatusRemoved)
+			cout << " (removed)";
+		cout << ":  " << FormatChange(change) << endl;
+	}
+	cout << endl;
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		ParseUnsigned
+//
+// Description:		Converts the string to an unsigned integer.
+//
+// Input Arguments:
+//		s	= const std::string&
+//
+// Output Arguments:
+//		value	= unsigned int&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LineCounterApplication::ParseUnsigned(const std::string &s, unsigned int &value)
+{
+	if (s.empty() || s.find_first_not_of("0123456789") != std::string::npos)
+		return false;
+
+	std::istringstream ss(s);
+	return !(ss >> value).fail();
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		ParseShardMode
+//
+// Description:		Interprets the argument to --shard-by.
+//
+// Input Arguments:
+//		s	= const std::string&, "path" or "subtree"
+//
+// Output Arguments:
+//		bySubtree	= bool&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LineCounterApplication::ParseShardMode(const std::string &s, bool &bySubtree)
+{
+	if (s == "path")
+		bySubtree = false;
+	else if (s == "subtree")
+		bySubtree = true;
+	else
+	{
+		cout << "Invalid shard mode '" << s << "' (must be path or subtree)" << endl;
+		return false;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		ParseLineTypeFormat
+//
+// Description:		Interprets the argument to --line-types-format.
+//
+// Input Arguments:
+//		s	= const std::string&, "ndjson" or "binary"
+//
+// Output Arguments:
+//		format	= LineTypeWriter::Format&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LineCounterApplication::ParseLineTypeFormat(const std::string &s, LineTypeWriter::Format &format)
+{
+	if (s == "ndjson")
+		format = LineTypeWriter::FormatNdjson;
+	else if (s == "binary")
+		format = LineTypeWriter::FormatBinary;
+	else
+	{
+		cout << "Invalid line type format '" << s << "' (must be ndjson or binary)" << endl;
+		return false;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		ParsePercentage
+//
+// Description:		Converts a percentage (greater than zero and less than
+//					100) to a fraction.
+//
+// Input Arguments:
+//		s	= const std::string&
+//
+// Output Arguments:
+//		value	= double&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LineCounterApplication::ParsePercentage(const std::string &s, double &value)
+{
+	std::istringstream ss(s);
+	double percentage;
+	if ((ss >> percentage).fail() || !ss.eof() || percentage <= 0.0 || percentage >= 100.0)
+		return false;
+
+	value = percentage / 100.0;
+	return true;
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		FormatChange
+//
+// Description:		Formats the changes in each category, with signs.
+//
+// Input Arguments:
+//		change	= const ResultDiff::Change&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string LineCounterApplication::FormatChange(const ResultDiff::Change &change)
+{
+	std::ostringstream ss;
+	ss << showpos << "code " << change.codeLines << ", comment "
+		<< change.commentLines << ", blank " << change.blankLines;
+	return ss.str();
+}
+
 //==========================================================================
 // Class:			LineCounterApplication
 // Function:		PrintUsageInformation
@@ -138,7 +962,19 @@ int LineCounterApplication::Run(int argc, char *argv[])
 //==========================================================================
 void LineCounterApplication::PrintUsageInformation(std::string name)
 {
-	cout << "Usage:  " << name << " <config file name>" << endl;
+	cout << "Usage:  " << name << " <config file name> [--shard <index>/<count>]"
+		<< " [--shard-by path|subtree] [--partial <output file>]"
+		<< " [--sample <max error %>] [--line-types <output file>]"
+		<< " [--line-types-format ndjson|binary] [--results <output file>]"
+		<< " [--checkpoint <journal file> [--resume]] [--deadline <ms>]"
+		<< " [--files-from|--files-from0 <list file>|-]" << endl;
+	cout << "        " << name << " coordinate <config file name> [--workers <count>]"
+		<< " [--port <port>] [--bind <address>] [--shards <count>] [--shard-by path|subtree]" << endl;
+	cout << "        " << name << " worker <config file name> --connect <host>:<port>" << endl;
+	cout << "        " << name << " merge <partial results file> [...]" << endl;
+	cout << "        " << name << " changes <config file name> [<diff file>|-]"
+		<< " [--root <directory>]" << endl;
+	cout << "        " << name << " diff <results file> <results file> [--top <count>]" << endl;
 }
 
 //==========================================================================
@@ -148,7 +984,9 @@ void LineCounterApplication::PrintUsageInformation(std::string name)
 // Description:		Reads the configuration and updates the member variables.
 //
 // Input Arguments:
-//		name	= std::string, binary name
+//		name				= std::string, binary name
+//		directoriesRequired	= const bool&, false to accept configurations
+//							  with no directories
 //
 // Output Arguments:
 //		None
@@ -157,9 +995,11 @@ void LineCounterApplication::PrintUsageInformation(std::string name)
 //		None
 //
 //==========================================================================
-bool LineCounterApplication::UpdateConfiguration(std::string fileName)
+bool LineCounterApplication::UpdateConfiguration(std::string fileName,
+	const bool &directoriesRequired)
 {
 	LineCounterConfigFile config;
+	config.SetDirectoriesRequired(directoriesRequired);
 	if (!config.ReadConfiguration(fileName))
 	{
 		cout << "Problem reading configuration from:  '" << fileName << "'" << endl;
@@ -167,12 +1007,8 @@ bool LineCounterApplication::UpdateConfiguration(std::string fileName)
 	}
 
 	info = config.GetInformation();
-	traversalFlags = wxDIR_FILES;
 	if (info.recurseIntoSubDirectories)
-	{
-		traversalFlags |= wxDIR_DIRS;
 		cout << "Sub-directories will automatically be added to the search" << endl;
-	}
 
 	return true;
 }
@@ -181,7 +1017,10 @@ bool LineCounterApplication::UpdateConfiguration(std::string fileName)
 // Class:			LineCounterApplication
 // Function:		ParseFiles
 //
-// Description:		Calls the traverser to perform the search.
+// Description:		Runs the pipeline which performs the search (or reads
+//					the file list) and reads and parses the files it finds.
+//					When resuming from a checkpoint, the results of the
+//					earlier run are added.
 //
 // Input Arguments:
 //		None
@@ -196,21 +1035,88 @@ bool LineCounterApplication::UpdateConfiguration(std::string fileName)
 void LineCounterApplication::ParseFiles(void)
 {
 	cout << "Beginning search!" << endl;
+
+	Pipeline pipeline(info);
+	pipeline.SetShard(shardIndex, shardCount, shardBySubtree);
+	pipeline.SetLineTypeWriter(lineTypeWriter);
+	if (remainderEstimator)
+	{
+		pipeline.SetFileResultHandler(remainderEstimator);
+		pipeline.SetDeadline(&deadline);
+	}
+	else
+		pipeline.SetFileResultHandler(fileResultWriter);
+	pipeline.SetCheckpointJournal(checkpointJournal);
+	if (fileList)
+		statistics = pipeline.Run(*fileList, fileListNulDelimited);
+	else
+		statistics = pipeline.Run();
+	prunedDirectoryCount = pipeline.GetPrunedDirectoryCount();
+	searchStopped = pipeline.WasSearchStopped();
+
 	unsigned int i;
-	for (i = 0; i < info.directoryList.size(); i++)
+	for (i = 0; i < ContentClassifier::ContentTypeCount; i++)
 	{
-		// Make sure the directory exists (this is really redundant, since the
-		// same check happens in the config file class)
-		if (!wxDir::Exists(wxString(info.directoryList[i].c_str(), wxConvUTF8)))
-		{
-			cout << "Directory '" << info.directoryList[i]
-				<< "' does not exist!  Skipping..." << endl;
-			continue;
-		}
+		const ContentClassifier::ContentType type(static_cast<ContentClassifier::ContentType>(i));
+		skippedFileCount[i] = pipeline.GetSkipCounter().GetFileCount(type);
+		skippedBytes[i] = pipeline.GetSkipCounter().GetBytes(type);
+	}
+
+	if (!checkpointJournal)
+		return;
+
+	// Include the files completed by an earlier run
+	PartialResults::Add(checkpointJournal->GetResumedStatistics(), statistics);
+	for (i = 0; i < ContentClassifier::ContentTypeCount; i++)
+	{
+		const ContentClassifier::ContentType type(static_cast<ContentClassifier::ContentType>(i));
+		skippedFileCount[i] += checkpointJournal->GetResumedSkipCount(type);
+		skippedBytes[i] += checkpointJournal->GetResumedSkipBytes(type);
+	}
+}
+
+//==========================================================================
+// Class:			LineCounterApplication
+// Function:		SampleFiles
+//
+// Description:		Performs the search, then estimates the statistics by
+//					parsing samples of the files found.  Files which are not
+//					sampled are never read.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounterApplication::SampleFiles(void)
+{
+	cout << "Beginning search!" << endl;
 
-		wxDir directory(wxString(info.directoryList[i].c_str(), wxConvUTF8));
-		directory.Traverse(*traverser, wxEmptyString, traversalFlags);
+	std::vector<FileEntry> files;
+	{
+		Pipeline pipeline(info);
+		pipeline.SetShard(shardIndex, shardCount, shardBySubtree);
+		files = pipeline.Scan();
+		prunedDirectoryCount = pipeline.GetPrunedDirectoryCount();
+	}
+
+	Sampler sampler(files, sampleError);
+	std::vector<FileEntry> sample;
+	while (sampler.NextSample(sample))
+	{
+		Pipeline pipeline(info);
+		pipeline.SetFileResultHandler(&sampler);
+		pipeline.SetLineTypeWriter(lineTypeWriter);
+		pipeline.Run(sample);
 	}
+
+	estimate = sampler.GetEstimate();
+	statistics = estimate.statistics;
 }
 
 //==========================================================================
@@ -232,12 +1138,17 @@ void LineCounterApplication::ParseFiles(void)
 void LineCounterApplication::PrintCodeStatistics(void) const
 {
 	// Calculate  and print the statistics
-	LineCounter::Statistics statistics = traverser->GetStatistics();
-	unsigned long totalLines = statistics.blankLines +
+	unsigned long long totalLines = statistics.blankLines +
 		+ statistics.commentLines + statistics.codeLines;
 
 	cout << endl;
 	cout << "Number of files searched: " << statistics.fileCount << endl;
+	if (sampleError > 0.0)
+	{
+		cout << "Files parsed: " << estimate.sampledFileCount << " ("
+			<< estimate.sampledBytes << " of " << estimate.totalBytes << " bytes)" << endl;
+		cout << "Line counts are estimates with 95% confidence intervals" << endl;
+	}
 	cout << "Total number of lines: " << totalLines << endl;
 
 	if (totalLines < 1) totalLines = 1;// To avoid divide by zero
@@ -249,11 +1160,68 @@ void LineCounterApplication::PrintCodeStatistics(void) const
 	double percentCode = (double)statistics.codeLines
 		/ (double)totalLines * 100.0;
 
-	cout << "Blank lines: " << statistics.blankLines
-		<< " (" << percentBlank << "%)" << endl;
-	cout << "Comment lines: " << statistics.commentLines
-		<< " (" << percentComment << "%)" << endl;
-	cout << "Code lines: " << statistics.codeLines
-		<< " (" << percentCode << "%)" << endl;
+	cout << "Blank lines: " << statistics.blankLines;
+	if (sampleError > 0.0)
+		cout << " +/- " << estimate.margin.blankLines;
+	cout << " (" << percentBlank << "%)" << endl;
+
+	cout << "Comment lines: " << statistics.commentLines;
+	if (sampleError > 0.0)
+		cout << " +/- " << estimate.margin.commentLines;
+	cout << " (" << percentComment << "%)" << endl;
+
+	cout << "Code lines: " << statistics.codeLines;
+	if (sampleError > 0.0)
+		cout << " +/- " << estimate.margin.codeLines;
+	cout << " (" << percentCode << "%)" << endl;
+
+	if (!info.excludeList.empty() || info.useGitIgnore)
+		cout << "Directories pruned: " << prunedDirectoryCount << endl;
+
+	if (info.skipNonSource && sampleError == 0.0)
+	{
+		unsigned int i;
+		for (i = ContentClassifier::ContentSource + 1; i < ContentClassifier::ContentTypeCount; i++)
+		{
+			cout << "Skipped " << ContentClassifier::GetName(
+				static_cast<ContentClassifier::ContentType>(i)) << " files: "
+				<< skippedFileCount[i] << " (" << skippedBytes[i] << " bytes)" << endl;
+		}
+	}
+
+	RemainderEstimator::Estimate remainder;
+	if (remainderEstimator)
+	{
+		const bool estimated(remainderEstimator->GetEstimate(remainder));
+		if (remainder.statistics.fileCount > 0 || searchStopped)
+		{
+			cout << endl;
+			cout << "Deadline of " << deadline.GetMilliseconds()
+				<< " ms reached:  the counts above are exact for the files (and parts of"
+				" files) completed" << endl;
+			cout << "Unfinished files: " << remainder.statistics.fileCount
+				<< " (" << remainder.bytes << " bytes)" << endl;
+			if (estimated)
+			{
+				const LineCounter::Statistics &pending(remainder.statistics);
+				cout << "Estimated lines in unfinished files: "
+					<< pending.blankLines + pending.commentLines + pending.codeLines
+					<< " (blank " << pending.blankLines << ", comment " << pending.commentLines
+					<< ", code " << pending.codeLines << ")" << endl;
+				cout << "Estimated total number of lines: "
+					<< statistics.blankLines + statistics.commentLines + statistics.codeLines
+					+ pending.blankLines + pending.commentLines + pending.codeLines
+					<< " (blank " << statistics.blankLines + pending.blankLines
+					<< ", comment " << statistics.commentLines + pending.commentLines
+					<< ", code " << statistics.codeLines + pending.codeLines << ")" << endl;
+			}
+			else if (remainder.statistics.fileCount > 0)
+				cout << "No files were completed, so lines in unfinished files cannot be estimated" << endl;
+
+			if (searchStopped)
+				cout << "The search was stopped early:  files not yet found are not"
+					" included in the counts or the estimates" << endl;
+		}
+	}
 	cout << endl;
 }
\ No newline at end of file
@@ -10,11 +10,20 @@
 #ifndef LINE_COUNTER_APPLICATION_H_
 #define LINE_COUNTER_APPLICATION_H_
 
+// Standard C++ headers
+#include <istream>
+
 // Local headers
 #include "lineCounterConfigFile.h"
-
-// Local forward declarations
-class Traverser;
+#include "lineCounter.h"
+#include "sampler.h"
+#include "contentClassifier.h"
+#include "lineTypeRecorder.h"
+#include "fileResults.h"
+#include "resultDiff.h"
+#include "checkpointJournal.h"
+#include "deadline.h"
+#include "remainderEstimator.h"
 
 class LineCounterApplication
 {
@@ -25,13 +34,49 @@ public:
 
 private:
 	void PrintUsageInformation(std::string name);
-	bool UpdateConfiguration(std::string fileName);
+	bool UpdateConfiguration(std::string fileName, const bool &directoriesRequired = true);
 	void ParseFiles(void);
+	void SampleFiles(void);
 	void PrintCodeStatistics(void) const;
 
-	Traverser *traverser;
+	// Modes
+	int RunCount(int argc, char *argv[]);
+	int RunCoordinator(int argc, char *argv[]);
+	int RunWorker(int argc, char *argv[]);
+	int RunMerge(int argc, char *argv[]);
+	int RunChanges(int argc, char *argv[]);
+	int RunDiff(int argc, char *argv[]);
+
+	static bool ParseUnsigned(const std::string &s, unsigned int &value);
+	static bool ParseShardMode(const std::string &s, bool &bySubtree);
+	static bool ParsePercentage(const std::string &s, double &value);
+	static bool ParseLineTypeFormat(const std::string &s, LineTypeWriter::Format &format);
+	static std::string FormatChange(const ResultDiff::Change &change);
+
 	LineCounterInformation info;
-	int traversalFlags;
+
+	unsigned int shardIndex;
+	unsigned int shardCount;
+	bool shardBySubtree;
+
+	double sampleError;// Fraction of total lines; zero to count every file
+	Sampler::Estimate estimate;
+
+	LineTypeWriter *lineTypeWriter;// NULL unless line types are requested
+	FileResultWriter *fileResultWriter;// NULL unless per-file results are requested
+	CheckpointJournal *checkpointJournal;// NULL unless checkpoints are requested
+
+	Deadline deadline;
+	RemainderEstimator *remainderEstimator;// NULL unless a deadline is set
+	bool searchStopped;// True if the search didn't finish before the deadline
+
+	std::istream *fileList;// NULL unless the files are listed instead of searched for
+	bool fileListNulDelimited;
+
+	LineCounter::Statistics statistics;
+	unsigned int prunedDirectoryCount;
+	unsigned long long skippedFileCount[ContentClassifier::ContentTypeCount];
+	unsigned long long skippedBytes[ContentClassifier::ContentTypeCount];
 };
 
 #endif// LINE_COUNTER_APPLICATION_H_
\ No newline at end of file
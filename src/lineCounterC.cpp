@@ -0,0 +1,513 @@
+// File:  lineCounterC.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  C interface to the line counting library, for plugins and for
+//        languages which can call C functions.  Exceptions are caught here,
+//        since they can't be allowed to reach C callers.
+
+// Local headers
+#include "lineCounterC.h"
+#include "lineCounterLibrary.h"
+
+struct LineCounterProfile
+{
+	LineCounterProfile(const LineCounterLibrary::Profile &profile) : profile(profile) {};
+	const LineCounterLibrary::Profile profile;
+};
+
+struct LineCounterStream
+{
+	LineCounterStream(const LineCounterLibrary::Profile &profile) : stream(profile) {};
+	LineCounterLibrary::Stream stream;
+};
+
+struct LineCounterDocument
+{
+	LineCounterDocument(const LineCounterLibrary::Profile &profile) : document(profile) {};
+	LineCounterLibrary::Document document;
+};
+
+//==========================================================================
+// Class:			None
+// Function:		CopyCounts
+//
+// Description:		Converts counts to their C form.
+//
+// Input Arguments:
+//		counts	= const LineCounterLibrary::Counts&
+//
+// Output Arguments:
+//		cCounts	= LineCounterCounts*
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+static void CopyCounts(const LineCounterLibrary::Counts &counts, LineCounterCounts *cCounts)
+{
+	cCounts->blankLines = counts.blankLines;
+	cCounts->commentLines = counts.commentLines;
+	cCounts->codeLines = counts.codeLines;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterGetApiVersion
+//
+// Description:		Returns the version of the library's interface.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int LineCounterGetApiVersion(void)
+{
+	return LineCounterLibrary::apiVersion;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterCreateProfile
+//
+// Description:		Creates a profile with the specified comment syntax.
+//
+// Input Arguments:
+//		commentIndicators			= const char* const*
+//		commentIndicatorCount		= size_t
+//		blockCommentStarts			= const char* const*
+//		blockCommentEnds			= const char* const*
+//		blockCommentIndicatorCount	= size_t
+//		continuationIndicators		= const char* const*
+//		continuationIndicatorCount	= size_t
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounterProfile*, NULL on failure
+//
+//==========================================================================
+LineCounterProfile* LineCounterCreateProfile(
+	const char *const *commentIndicators, size_t commentIndicatorCount,
+	const char *const *blockCommentStarts, const char *const *blockCommentEnds,
+	size_t blockCommentIndicatorCount,
+	const char *const *continuationIndicators, size_t continuationIndicatorCount)
+{
+	try
+	{
+		std::vector<std::string> comments;
+		std::vector<std::pair<std::string, std::string> > blockComments;
+		std::vector<std::string> continuations;
+
+		size_t i;
+		for (i = 0; i < commentIndicatorCount; i++)
+		{
+			if (!commentIndicators[i])
+				return NULL;
+			comments.push_back(commentIndicators[i]);
+		}
+
+		for (i = 0; i < blockCommentIndicatorCount; i++)
+		{
+			if (!blockCommentStarts[i] || !blockCommentEnds[i])
+				return NULL;
+			blockComments.push_back(std::make_pair(std::string(blockCommentStarts[i]),
+				std::string(blockCommentEnds[i])));
+		}
+
+		for (i = 0; i < continuationIndicatorCount; i++)
+		{
+			if (!continuationIndicators[i])
+				return NULL;
+			continuations.push_back(continuationIndicators[i]);
+		}
+
+		return new LineCounterProfile(LineCounterLibrary::Profile(
+			comments, blockComments, continuations));
+	}
+	catch (...)
+	{
+		return NULL;
+	}
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterCreateLanguageProfile
+//
+// Description:		Creates one of the built-in profiles.
+//
+// Input Arguments:
+//		name	= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounterProfile*, NULL if the name is not recognized
+//
+//==========================================================================
+LineCounterProfile* LineCounterCreateLanguageProfile(const char *name)
+{
+	if (!name)
+		return NULL;
+
+	try
+	{
+		LineCounterLibrary::Profile profile;
+		if (!LineCounterLibrary::Profile::ForLanguage(name, profile))
+			return NULL;
+
+		return new LineCounterProfile(profile);
+	}
+	catch (...)
+	{
+		return NULL;
+	}
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterDestroyProfile
+//
+// Description:		Frees a profile.  NULL is ignored.
+//
+// Input Arguments:
+//		profile	= LineCounterProfile*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounterDestroyProfile(LineCounterProfile *profile)
+{
+	delete profile;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterCountBuffer
+//
+// Description:		Counts the lines in a complete file.
+//
+// Input Arguments:
+//		profile	= const LineCounterProfile*
+//		data	= const char*, may be NULL if length is zero
+//		length	= size_t
+//
+// Output Arguments:
+//		counts	= LineCounterCounts*
+//
+// Return Value:
+//		int, zero for success, non-zero otherwise
+//
+//==========================================================================
+int LineCounterCountBuffer(const LineCounterProfile *profile,
+	const char *data, size_t length, LineCounterCounts *counts)
+{
+	if (!profile || !counts || (!data && length > 0))
+		return 1;
+
+	try
+	{
+		CopyCounts(LineCounterLibrary::CountBuffer(profile->profile, data, length), counts);
+	}
+	catch (...)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterCreateStream
+//
+// Description:		Creates a stream for counting the lines of text which
+//					arrives in pieces.
+//
+// Input Arguments:
+//		profile	= const LineCounterProfile*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounterStream*, NULL on failure
+//
+//==========================================================================
+LineCounterStream* LineCounterCreateStream(const LineCounterProfile *profile)
+{
+	if (!profile)
+		return NULL;
+
+	try
+	{
+		return new LineCounterStream(profile->profile);
+	}
+	catch (...)
+	{
+		return NULL;
+	}
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterWriteStream
+//
+// Description:		Parses the next piece of the file.
+//
+// Input Arguments:
+//		stream	= LineCounterStream*
+//		data	= const char*, may be NULL if length is zero
+//		length	= size_t
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, zero for success, non-zero otherwise
+//
+//==========================================================================
+int LineCounterWriteStream(LineCounterStream *stream, const char *data, size_t length)
+{
+	if (!stream || (!data && length > 0))
+		return 1;
+
+	try
+	{
+		stream->stream.Write(data, length);
+	}
+	catch (...)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterFinishStream
+//
+// Description:		Completes the current file and prepares for the next.
+//
+// Input Arguments:
+//		stream	= LineCounterStream*
+//
+// Output Arguments:
+//		counts	= LineCounterCounts*
+//
+// Return Value:
+//		int, zero for success, non-zero otherwise
+//
+//==========================================================================
+int LineCounterFinishStream(LineCounterStream *stream, LineCounterCounts *counts)
+{
+	if (!stream || !counts)
+		return 1;
+
+	try
+	{
+		CopyCounts(stream->stream.Finish(), counts);
+	}
+	catch (...)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterDestroyStream
+//
+// Description:		Frees a stream.  NULL is ignored.
+//
+// Input Arguments:
+//		stream	= LineCounterStream*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounterDestroyStream(LineCounterStream *stream)
+{
+	delete stream;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterCreateDocument
+//
+// Description:		Creates an empty document.
+//
+// Input Arguments:
+//		profile	= const LineCounterProfile*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounterDocument*, NULL on failure
+//
+//==========================================================================
+LineCounterDocument* LineCounterCreateDocument(const LineCounterProfile *profile)
+{
+	if (!profile)
+		return NULL;
+
+	try
+	{
+		return new LineCounterDocument(profile->profile);
+	}
+	catch (...)
+	{
+		return NULL;
+	}
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterSetDocumentText
+//
+// Description:		Replaces the contents of a document.
+//
+// Input Arguments:
+//		document	= LineCounterDocument*
+//		data		= const char*, may be NULL if length is zero
+//		length		= size_t
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, zero for success, non-zero otherwise
+//
+//==========================================================================
+int LineCounterSetDocumentText(LineCounterDocument *document, const char *data, size_t length)
+{
+	if (!document || (!data && length > 0))
+		return 1;
+
+	try
+	{
+		document->document.SetText(data, length);
+	}
+	catch (...)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterReplaceDocumentLines
+//
+// Description:		Applies an edit to a document.
+//
+// Input Arguments:
+//		document		= LineCounterDocument*
+//		firstLine		= size_t
+//		removedCount	= size_t
+//		newLines		= const char* const*, may be NULL if newLineCount is zero
+//		newLineLengths	= const size_t*, may be NULL if newLineCount is zero
+//		newLineCount	= size_t
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, zero for success, non-zero otherwise
+//
+//==========================================================================
+int LineCounterReplaceDocumentLines(LineCounterDocument *document,
+	size_t firstLine, size_t removedCount,
+	const char *const *newLines, const size_t *newLineLengths, size_t newLineCount)
+{
+	if (!document || (newLineCount > 0 && (!newLines || !newLineLengths)))
+		return 1;
+
+	try
+	{
+		std::vector<std::string> lines(newLineCount);
+		size_t i;
+		for (i = 0; i < newLineCount; i++)
+		{
+			if (!newLines[i] && newLineLengths[i] > 0)
+				return 1;
+			lines[i].assign(newLines[i], newLineLengths[i]);
+		}
+
+		if (!document->document.ReplaceLines(firstLine, removedCount, lines))
+			return 1;
+	}
+	catch (...)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterGetDocumentCounts
+//
+// Description:		Returns the counts for the current contents of a document.
+//
+// Input Arguments:
+//		document	= const LineCounterDocument*
+//
+// Output Arguments:
+//		counts		= LineCounterCounts*
+//
+// Return Value:
+//		int, zero for success, non-zero otherwise
+//
+//==========================================================================
+int LineCounterGetDocumentCounts(const LineCounterDocument *document, LineCounterCounts *counts)
+{
+	if (!document || !counts)
+		return 1;
+
+	CopyCounts(document->document.GetCounts(), counts);
+	return 0;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		LineCounterDestroyDocument
+//
+// Description:		Frees a document.  NULL is ignored.
+//
+// Input Arguments:
+//		document	= LineCounterDocument*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounterDestroyDocument(LineCounterDocument *document)
+{
+	delete document;
+}
@@ -0,0 +1,78 @@
+/* File:  lineCounterC.h
+ * Date:  10/19/2026
+ * Auth:  K. Loux
+ * Desc:  C interface to the line counting library, for plugins and for
+ *        languages which can call C functions.  Functions which return int
+ *        return zero on success and non-zero if an argument is invalid or
+ *        memory could not be allocated.  Profiles may be shared between
+ *        threads; each stream must only be used by one thread at a time.
+ */
+
+#ifndef LINE_COUNTER_C_H_
+#define LINE_COUNTER_C_H_
+
+/* Standard C headers */
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Incremented when the interface changes in a way that isn't backward compatible */
+#define LINE_COUNTER_API_VERSION 1
+
+typedef struct LineCounterProfile LineCounterProfile;
+typedef struct LineCounterStream LineCounterStream;
+typedef struct LineCounterDocument LineCounterDocument;
+
+typedef struct
+{
+	unsigned long long blankLines;
+	unsigned long long commentLines;
+	unsigned long long codeLines;
+} LineCounterCounts;
+
+/* Returns the version of the library, to compare against LINE_COUNTER_API_VERSION */
+unsigned int LineCounterGetApiVersion(void);
+
+/* Any of the arrays may be NULL if the corresponding count is zero.  The
+ * strings are copied.  Returns NULL on failure. */
+LineCounterProfile* LineCounterCreateProfile(
+	const char *const *commentIndicators, size_t commentIndicatorCount,
+	const char *const *blockCommentStarts, const char *const *blockCommentEnds,
+	size_t blockCommentIndicatorCount,
+	const char *const *continuationIndicators, size_t continuationIndicatorCount);
+
+/* Built-in profiles:  "c", "cpp", "java", "python" and "vb".  Returns NULL
+ * if the name is not recognized. */
+LineCounterProfile* LineCounterCreateLanguageProfile(const char *name);
+void LineCounterDestroyProfile(LineCounterProfile *profile);
+
+/* Counts the lines in a complete file */
+int LineCounterCountBuffer(const LineCounterProfile *profile,
+	const char *data, size_t length, LineCounterCounts *counts);
+
+/* For text which arrives in pieces.  The stream keeps its own copy of the
+ * profile, so the profile may be destroyed while the stream is in use.
+ * After LineCounterFinishStream, the stream is ready for the next file. */
+LineCounterStream* LineCounterCreateStream(const LineCounterProfile *profile);
+int LineCounterWriteStream(LineCounterStream *stream, const char *data, size_t length);
+int LineCounterFinishStream(LineCounterStream *stream, LineCounterCounts *counts);
+void LineCounterDestroyStream(LineCounterStream *stream);
+
+/* For files which are being edited; each edit is parsed in time
+ * proportional to its size.  Lines are numbered from zero.  Each new line
+ * is given by a pointer and a length and must not contain newlines. */
+LineCounterDocument* LineCounterCreateDocument(const LineCounterProfile *profile);
+int LineCounterSetDocumentText(LineCounterDocument *document, const char *data, size_t length);
+int LineCounterReplaceDocumentLines(LineCounterDocument *document,
+	size_t firstLine, size_t removedCount,
+	const char *const *newLines, const size_t *newLineLengths, size_t newLineCount);
+int LineCounterGetDocumentCounts(const LineCounterDocument *document, LineCounterCounts *counts);
+void LineCounterDestroyDocument(LineCounterDocument *document);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif/* LINE_COUNTER_C_H_ */
@@ -12,10 +12,17 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <stdlib.h>
 #endif
 
+// Standard C++ headers
+#include <thread>
+#include <cctype>
+
 // Local headers
 #include "lineCounterConfigFile.h"
+#include "pathFilter.h"
+#include "fileReader.h"
 
 //==========================================================================
 // Class:			LineCounterConfigFile
@@ -42,6 +49,24 @@ void LineCounterConfigFile::BuildConfigItems(void)
 	AddConfigItem("BLOCK_COMMENT_END", blockCommentEndList);
 	AddConfigItem("COMMENT_CONTINUATION", info.continuationList);
 	AddConfigItem("RECURSIVE_SEARCH", info.recurseIntoSubDirectories);
+	AddConfigItem("EXCLUDE", info.excludeList);
+	AddConfigItem("GITIGNORE", info.useGitIgnore);
+	AddConfigItem("SKIP_NON_SOURCE", info.skipNonSource);
+	AddConfigItem("THREAD_COUNT", info.threadCount);
+	AddConfigItem("READ_THREAD_COUNT", info.readThreadCount);
+	AddConfigItem("TRAVERSAL_THREAD_COUNT", info.traversalThreadCount);
+	AddConfigItem("READ_AHEAD_SIZE", info.readAheadSize);
+	AddConfigItem("IO_URING", info.useIoUring);
+	AddConfigItem("IO_URING_DEPTH", info.ioUringDepth);
+	AddConfigItem("PARALLEL_PARSE_MIN_SIZE", info.parallelParseMinimumSize);
+	AddConfigItem("OVERLAP_PRESCAN", info.overlapPrescan);
+	AddConfigItem("DEVICE_DEPTH_SOLID_STATE", info.solidStateDeviceDepth);
+	AddConfigItem("DEVICE_DEPTH_ROTATIONAL", info.rotationalDeviceDepth);
+	AddConfigItem("DEVICE_DEPTH_NETWORK", info.networkDeviceDepth);
+	AddConfigItem("IO_BANDWIDTH_LIMIT", info.ioBandwidthLimit);
+	AddConfigItem("IO_OPERATION_LIMIT", info.ioOperationLimit);
+	AddConfigItem("IDLE_IO_PRIORITY", info.idleIoPriority);
+	AddConfigItem("PRESERVE_PAGE_CACHE", info.preservePageCache);
 }
 
 //==========================================================================
@@ -64,15 +89,38 @@ void LineCounterConfigFile::AssignDefaults(void)
 {
 	// Just clear out the member vectors, in case we're re-reading
 	info.directoryList.clear();
+	info.archiveList.clear();
 	info.extensionList.clear();
 	info.commentList.clear();
 	info.blockCommentList.clear();
 	info.continuationList.clear();
+	info.excludeList.clear();
 
 	blockCommentStartList.clear();
 	blockCommentEndList.clear();
 
 	info.recurseIntoSubDirectories = false;
+	info.useGitIgnore = false;
+	info.skipNonSource = false;
+
+	info.threadCount = 0;
+	info.readThreadCount = 2;
+	info.traversalThreadCount = 1;
+	info.readAheadSize = 64;
+	info.parallelParseMinimumSize = 64;
+	info.overlapPrescan = false;
+
+	info.solidStateDeviceDepth = 64;
+	info.rotationalDeviceDepth = 1;
+	info.networkDeviceDepth = 4;
+
+	info.useIoUring = true;
+	info.ioUringDepth = 32;
+
+	info.ioBandwidthLimit = 0;
+	info.ioOperationLimit = 0;
+	info.idleIoPriority = false;
+	info.preservePageCache = false;
 }
 
 //==========================================================================
@@ -109,7 +157,8 @@ bool LineCounterConfigFile::ConfigIsOK(void)
 		configOK = false;
 	}
 
-	if (info.directoryList.size() == 0)
+	SeparateArchives();
+	if (directoriesRequired && info.directoryList.size() == 0 && info.archiveList.size() == 0)
 	{
 		outStream << "Error:  Must specify at least one "
 			<< GetKey(info.directoryList) << std::endl;
@@ -149,10 +198,26 @@ bool LineCounterConfigFile::ConfigIsOK(void)
 	}
 
 	RemoveDuplicates(info.directoryList);
+	RemoveDuplicates(info.archiveList);
 	RemoveDuplicates(info.extensionList);
 	RemoveDuplicates(info.blockCommentList);
 	RemoveDuplicates(info.commentList);
 	RemoveDuplicates(info.continuationList);
+	RemoveDuplicates(info.excludeList);
+	CollapseOverlappingDirectories();
+
+	if (info.threadCount == 0)
+	{
+		info.threadCount = std::thread::hardware_concurrency();
+		if (info.threadCount == 0)
+			info.threadCount = 1;
+	}
+
+	if (info.readThreadCount == 0)
+		info.readThreadCount = 1;
+
+	if (info.traversalThreadCount == 0)
+		info.traversalThreadCount = 1;
 
 	configOK = EnsureTokenUniqueness() && configOK;
 
@@ -228,6 +293,218 @@ bool LineCounterConfigFile::DirectoryExists(const std::string &directory) const
 #endif
 }
 
+//==========================================================================
+// Class:			LineCounterConfigFile
+// Function:		SeparateArchives
+//
+// Description:		Moves entries in the directory list which refer to files
+//					to the list of archives.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounterConfigFile::SeparateArchives(void)
+{
+	std::vector<std::string> directories;
+	unsigned int i;
+	for (i = 0; i < info.directoryList.size(); i++)
+	{
+		if (IsRegularFile(info.directoryList[i]))
+			info.archiveList.push_back(info.directoryList[i]);
+		else
+			directories.push_back(info.directoryList[i]);
+	}
+
+	info.directoryList.swap(directories);
+}
+
+//==========================================================================
+// Class:			LineCounterConfigFile
+// Function:		IsRegularFile
+//
+// Description:		Checks to see if the path refers to an existing file
+//					(not a directory).
+//
+// Input Arguments:
+//		path	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool LineCounterConfigFile::IsRegularFile(const std::string &path)
+{
+#ifdef WIN32
+	DWORD ftyp = GetFileAttributesA(path.c_str());
+	return ftyp != INVALID_FILE_ATTRIBUTES && (ftyp & FILE_ATTRIBUTE_DIRECTORY) == 0;
+#else
+	struct stat st;
+	return stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+#endif
+}
+
+//==========================================================================
+// Class:			LineCounterConfigFile
+// Function:		CollapseOverlappingDirectories
+//
+// Description:		Removes directories which refer to the same place as
+//					another directory in the list (after resolving links) or,
+//					for recursive searches, which are inside another
+//					directory in the list and would be reached by searching
+//					it.  Otherwise the files would be counted more than once.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineCounterConfigFile::CollapseOverlappingDirectories(void)
+{
+	std::vector<std::string> canonical(info.directoryList.size());
+	unsigned int i, j;
+	for (i = 0; i < info.directoryList.size(); i++)
+		canonical[i] = CanonicalPath(info.directoryList[i]);
+
+	std::vector<std::string> keep;
+	for (j = 0; j < info.directoryList.size(); j++)
+	{
+		for (i = 0; i < info.directoryList.size(); i++)
+		{
+			if (i == j || canonical[j].compare(0, canonical[i].length(), canonical[i]) != 0)
+				continue;
+
+			const bool same(canonical[j].length() == canonical[i].length());
+			if ((same && i < j) || (!same && info.recurseIntoSubDirectories &&
+				IsReachedFrom(canonical[i], canonical[j])))
+				break;
+		}
+
+		if (i < info.directoryList.size())
+			outStream << "Warning:  Removing '" << info.directoryList[j]
+				<< "', which is already searched as part of '"
+				<< info.directoryList[i] << "'" << std::endl;
+		else
+			keep.push_back(info.directoryList[j]);
+	}
+
+	info.directoryList.swap(keep);
+}
+
+//==========================================================================
+// Class:			LineCounterConfigFile
+// Function:		IsReachedFrom
+//
+// Description:		Checks to see if a recursive search of one directory
+//					reaches another directory inside it, which it does
+//					unless a directory on the way is hidden, matches an
+//					exclude pattern or is listed in a .gitignore file.
+//
+// Input Arguments:
+//		parent	= const std::string&, canonical path to the searched
+//				  directory
+//		nested	= const std::string&, canonical path to a directory inside
+//				  parent
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if nested is searched as part of parent
+//
+//==========================================================================
+bool LineCounterConfigFile::IsReachedFrom(const std::string &parent,
+	const std::string &nested) const
+{
+	PathFilter excludes;
+	unsigned int i;
+	for (i = 0; i < info.excludeList.size(); i++)
+		excludes.AddPattern(info.excludeList[i]);
+
+	// Each directory on the way, relative to parent (as the traverser checks them)
+	const std::string relative(nested.substr(parent.length()));
+	size_t start(0), end;
+	while ((end = relative.find('/', start)) != std::string::npos)
+	{
+		if (info.useGitIgnore)
+		{
+			std::string contents;
+			if (FileReader::Read(parent + relative.substr(0, start) + ".gitignore", 0, contents))
+				excludes.AddPatterns(contents, relative.substr(0, start));
+		}
+
+		if (relative[start] == '.' ||
+			excludes.IsExcluded(relative.c_str(), relative.c_str() + end, true))
+			return false;
+		start = end + 1;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			LineCounterConfigFile
+// Function:		CanonicalPath
+//
+// Description:		Returns the absolute path to the directory, with links
+//					resolved where the platform allows, ending with '/'.
+//
+// Input Arguments:
+//		directory	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string LineCounterConfigFile::CanonicalPath(const std::string &directory)
+{
+	std::string path(directory);
+#ifdef WIN32
+	char buffer[MAX_PATH];
+	const DWORD length(GetFullPathNameA(directory.c_str(), MAX_PATH, buffer, NULL));
+	if (length > 0 && length < MAX_PATH)
+		path.assign(buffer, length);
+
+	size_t i;
+	for (i = 0; i < path.length(); i++)
+	{
+		if (path[i] == '\\')
+			path[i] = '/';
+		else
+			path[i] = tolower((unsigned char)path[i]);
+	}
+#else
+	char *resolved(realpath(directory.c_str(), NULL));
+	if (resolved)
+	{
+		path = resolved;
+		free(resolved);
+	}
+#endif
+
+	if (path.empty() || *path.rbegin() != '/')
+		path.append("/");
+
+	return path;
+}
+
 //==========================================================================
 // Class:			LineCounterConfigFile
 // Function:		EnsureTokenUniqueness
@@ -16,24 +16,55 @@
 struct LineCounterInformation
 {
 	std::vector<std::string> directoryList;
+	std::vector<std::string> archiveList;// tar or tar.gz files listed as directories
 	std::vector<std::string> extensionList;
 	std::vector<std::string> commentList;
 	std::vector<std::pair<std::string, std::string> > blockCommentList;
 	std::vector<std::string> continuationList;
 
 	bool recurseIntoSubDirectories;
+	std::vector<std::string> excludeList;// Glob patterns, with .gitignore syntax
+	bool useGitIgnore;
+	bool skipNonSource;// Binary, generated and minified files
+
+	unsigned int threadCount;// Parse stage
+	unsigned int readThreadCount;
+	unsigned int traversalThreadCount;
+	unsigned int readAheadSize;// [MB]
+	unsigned int parallelParseMinimumSize;// [MB]
+	bool overlapPrescan;
+
+	// Maximum number of files read at once from each type of device
+	unsigned int solidStateDeviceDepth;
+	unsigned int rotationalDeviceDepth;
+	unsigned int networkDeviceDepth;
+
+	bool useIoUring;
+	unsigned int ioUringDepth;
+
+	// For running alongside other work (zero for no limit)
+	unsigned int ioBandwidthLimit;// [MB/sec]
+	unsigned int ioOperationLimit;// [files/sec]
+	bool idleIoPriority;
+	bool preservePageCache;// Remove files from the page cache unless they were already there
 };
 
 class LineCounterConfigFile : public ConfigFile
 {
 public:
+	LineCounterConfigFile() : directoriesRequired(true) {};
 	virtual ~LineCounterConfigFile() {};
 
+	// When false, configurations without directories are accepted (for when
+	// the files to count are listed some other way)
+	void SetDirectoriesRequired(const bool &required) { directoriesRequired = required; };
+
 	LineCounterInformation GetInformation(void) const { return info; };
 
 private:
 	LineCounterInformation info;
 	std::vector<std::string> blockCommentStartList, blockCommentEndList;
+	bool directoriesRequired;
 
 	virtual void BuildConfigItems(void);
 	virtual void AssignDefaults(void);
@@ -41,6 +72,11 @@ private:
 	virtual bool ConfigIsOK(void);
 	bool AllDirectoriesExist(void) const;
 	bool DirectoryExists(const std::string &directory) const;
+	void SeparateArchives(void);
+	static bool IsRegularFile(const std::string &path);
+	void CollapseOverlappingDirectories(void);
+	bool IsReachedFrom(const std::string &parent, const std::string &nested) const;
+	static std::string CanonicalPath(const std::string &directory);
 
 	template <typename T>
 	void RemoveDuplicates(std::vector<T> &v) const;
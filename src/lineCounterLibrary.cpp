@@ -0,0 +1,376 @@
+// File:  lineCounterLibrary.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Interface for programs which link against the line counting library
+//        to count the lines of text in memory (unsaved editor buffers, patch
+//        blobs, etc.) without writing files or reading a configuration file.
+//        See lineCounterC.h for the C interface.
+
+// Standard C++ headers
+#include <cstddef>
+
+// Local headers
+#include "lineCounterLibrary.h"
+#include "lineCounter.h"
+#include "incrementalCounter.h"
+
+namespace LineCounterLibrary
+{
+
+// Comment syntax of the built-in profiles (NULL where the language has none)
+struct LanguageDefinition
+{
+	const char *name;
+	const char *comment;
+	const char *blockCommentStart;
+	const char *blockCommentEnd;
+	const char *continuation;
+};
+
+static const LanguageDefinition languages[] = {
+	{ "c", "//", "/*", "*/", "\\" },
+	{ "cpp", "//", "/*", "*/", "\\" },
+	{ "java", "//", "/*", "*/", NULL },
+	{ "python", "#", NULL, NULL, NULL },
+	{ "vb", "'", NULL, NULL, NULL } };
+
+//==========================================================================
+// Class:			Profile
+// Function:		Profile
+//
+// Description:		Constructor for Profile class.
+//
+// Input Arguments:
+//		commentIndicators		= const std::vector<std::string>&
+//		blockCommentIndicators	= const std::vector<std::pair<std::string, std::string> >&
+//		continuationIndicators	= const std::vector<std::string>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Profile::Profile(const std::vector<std::string> &commentIndicators,
+	const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
+	const std::vector<std::string> &continuationIndicators)
+	: commentIndicators(commentIndicators), blockCommentIndicators(blockCommentIndicators),
+	continuationIndicators(continuationIndicators)
+{
+}
+
+//==========================================================================
+// Class:			Profile
+// Function:		ForLanguage
+//
+// Description:		Looks up one of the built-in profiles.
+//
+// Input Arguments:
+//		name	= const std::string&
+//
+// Output Arguments:
+//		profile	= Profile&
+//
+// Return Value:
+//		bool, true if the name was recognized, false otherwise
+//
+//==========================================================================
+bool Profile::ForLanguage(const std::string &name, Profile &profile)
+{
+	unsigned int i;
+	for (i = 0; i < sizeof(languages) / sizeof(languages[0]); i++)
+	{
+		if (name.compare(languages[i].name) != 0)
+			continue;
+
+		std::vector<std::string> comments;
+		std::vector<std::pair<std::string, std::string> > blockComments;
+		std::vector<std::string> continuations;
+
+		if (languages[i].comment)
+			comments.push_back(languages[i].comment);
+		if (languages[i].blockCommentStart)
+			blockComments.push_back(std::make_pair(std::string(languages[i].blockCommentStart),
+				std::string(languages[i].blockCommentEnd)));
+		if (languages[i].continuation)
+			continuations.push_back(languages[i].continuation);
+
+		profile = Profile(comments, blockComments, continuations);
+		return true;
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Namespace:		LineCounterLibrary
+// Function:		CountBuffer
+//
+// Description:		Counts the lines in a complete file held in memory.
+//
+// Input Arguments:
+//		profile	= const Profile&
+//		data	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Counts
+//
+//==========================================================================
+Counts CountBuffer(const Profile &profile, const char *data, const size_t &length)
+{
+	LineCounter counter(profile.GetCommentIndicators(),
+		profile.GetBlockCommentIndicators(), profile.GetContinuationIndicators());
+	counter.ProcessBuffer(data, length);
+
+	const LineCounter::Statistics statistics(counter.GetStatistics());
+	Counts counts;
+	counts.blankLines = statistics.blankLines;
+	counts.commentLines = statistics.commentLines;
+	counts.codeLines = statistics.codeLines;
+	return counts;
+}
+
+//==========================================================================
+// Class:			Stream
+// Function:		Stream
+//
+// Description:		Constructor for Stream class.
+//
+// Input Arguments:
+//		profile	= const Profile&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Stream::Stream(const Profile &profile)
+{
+	counter = new LineCounter(profile.GetCommentIndicators(),
+		profile.GetBlockCommentIndicators(), profile.GetContinuationIndicators());
+	counter->BeginStream();
+}
+
+//==========================================================================
+// Class:			Stream
+// Function:		~Stream
+//
+// Description:		Destructor for Stream class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Stream::~Stream()
+{
+	delete counter;
+}
+
+//==========================================================================
+// Class:			Stream
+// Function:		Write
+//
+// Description:		Parses the next piece of the file.
+//
+// Input Arguments:
+//		data	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Stream::Write(const char *data, const size_t &length)
+{
+	counter->ProcessChunk(data, length);
+}
+
+//==========================================================================
+// Class:			Stream
+// Function:		Finish
+//
+// Description:		Completes the current file and starts the next one.  The
+//					counter's statistics accumulate across files, so the
+//					counts for this file are the change since the last call.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Counts
+//
+//==========================================================================
+Counts Stream::Finish(void)
+{
+	counter->EndStream();
+
+	const LineCounter::Statistics statistics(counter->GetStatistics());
+	Counts counts;
+	counts.blankLines = statistics.blankLines - finished.blankLines;
+	counts.commentLines = statistics.commentLines - finished.commentLines;
+	counts.codeLines = statistics.codeLines - finished.codeLines;
+
+	finished.blankLines = statistics.blankLines;
+	finished.commentLines = statistics.commentLines;
+	finished.codeLines = statistics.codeLines;
+
+	counter->BeginStream();
+	return counts;
+}
+
+//==========================================================================
+// Class:			Document
+// Function:		Document
+//
+// Description:		Constructor for Document class.
+//
+// Input Arguments:
+//		profile	= const Profile&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Document::Document(const Profile &profile)
+{
+	counter = new IncrementalCounter(profile.GetCommentIndicators(),
+		profile.GetBlockCommentIndicators(), profile.GetContinuationIndicators());
+}
+
+//==========================================================================
+// Class:			Document
+// Function:		~Document
+//
+// Description:		Destructor for Document class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Document::~Document()
+{
+	delete counter;
+}
+
+//==========================================================================
+// Class:			Document
+// Function:		SetText
+//
+// Description:		Replaces the contents of the document.
+//
+// Input Arguments:
+//		data	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Document::SetText(const char *data, const size_t &length)
+{
+	counter->SetText(data, length);
+}
+
+//==========================================================================
+// Class:			Document
+// Function:		ReplaceLines
+//
+// Description:		Applies an edit to the document.
+//
+// Input Arguments:
+//		firstLine		= const size_t&
+//		removedCount	= const size_t&
+//		newLines		= const std::vector<std::string>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false if the range is outside of the document
+//
+//==========================================================================
+bool Document::ReplaceLines(const size_t &firstLine, const size_t &removedCount,
+	const std::vector<std::string> &newLines)
+{
+	return counter->ReplaceLines(firstLine, removedCount, newLines);
+}
+
+//==========================================================================
+// Class:			Document
+// Function:		GetCounts
+//
+// Description:		Returns the counts for the current contents of the document.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Counts
+//
+//==========================================================================
+Counts Document::GetCounts(void) const
+{
+	const LineCounter::Statistics statistics(counter->GetStatistics());
+	Counts counts;
+	counts.blankLines = statistics.blankLines;
+	counts.commentLines = statistics.commentLines;
+	counts.codeLines = statistics.codeLines;
+	return counts;
+}
+
+//==========================================================================
+// Class:			Document
+// Function:		GetLineCount
+//
+// Description:		Returns the number of lines in the document.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//==========================================================================
+size_t Document::GetLineCount(void) const
+{
+	return counter->GetLineCount();
+}
+
+}// namespace LineCounterLibrary
@@ -0,0 +1,117 @@
+// File:  lineCounterLibrary.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Interface for programs which link against the line counting library
+//        to count the lines of text in memory (unsaved editor buffers, patch
+//        blobs, etc.) without writing files or reading a configuration file.
+//        See lineCounterC.h for the C interface.
+
+#ifndef LINE_COUNTER_LIBRARY_H_
+#define LINE_COUNTER_LIBRARY_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <utility>
+
+class LineCounter;
+class IncrementalCounter;
+
+namespace LineCounterLibrary
+{
+
+// Incremented when the interface changes in a way that isn't backward compatible
+const unsigned int apiVersion = 1;
+
+struct Counts
+{
+	Counts() : blankLines(0), commentLines(0), codeLines(0) {};
+
+	unsigned long long blankLines;
+	unsigned long long commentLines;
+	unsigned long long codeLines;
+};
+
+// Comment syntax of a language.  Profiles can't be changed once they are
+// created, so one profile may be used by any number of threads at once.
+class Profile
+{
+public:
+	Profile(void) {};// No comments; every line is code or blank
+	Profile(const std::vector<std::string> &commentIndicators,
+		const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
+		const std::vector<std::string> &continuationIndicators);
+
+	// Built-in profiles match the example configuration files:  "c", "cpp",
+	// "java", "python" and "vb".  Returns false if the name is not recognized.
+	static bool ForLanguage(const std::string &name, Profile &profile);
+
+	const std::vector<std::string>& GetCommentIndicators(void) const { return commentIndicators; };
+	const std::vector<std::pair<std::string, std::string> >& GetBlockCommentIndicators(void) const { return blockCommentIndicators; };
+	const std::vector<std::string>& GetContinuationIndicators(void) const { return continuationIndicators; };
+
+private:
+	std::vector<std::string> commentIndicators;
+	std::vector<std::pair<std::string, std::string> > blockCommentIndicators;
+	std::vector<std::string> continuationIndicators;
+};
+
+// Counts the lines in a complete file.  UTF-16 text is recognized by its
+// byte order mark.  Safe to call from any number of threads at once.
+Counts CountBuffer(const Profile &profile, const char *data, const size_t &length);
+
+// For text which arrives in pieces; lines may span pieces.  Each stream
+// keeps its own state, so different threads may use different streams
+// at once, but a single stream must only be used by one thread at a time.
+class Stream
+{
+public:
+	Stream(const Profile &profile);
+	~Stream();
+
+	void Write(const char *data, const size_t &length);
+
+	// Returns the counts for the text written since the stream was created
+	// (or since the last call to Finish) and prepares for the next file
+	Counts Finish(void);
+
+private:
+	LineCounter *counter;
+	Counts finished;// Totals of the files already finished
+
+	Stream(const Stream&);
+	Stream& operator=(const Stream&);
+};
+
+// For files which are being edited.  After the first call to SetText, each
+// edit is parsed in time proportional to the size of the edit rather than
+// the size of the file (except where the edit changes the meaning of the
+// following lines, e.g. by starting a block comment).  A document must only
+// be used by one thread at a time.
+class Document
+{
+public:
+	Document(const Profile &profile);
+	~Document();
+
+	void SetText(const char *data, const size_t &length);
+
+	// Replaces removedCount lines starting at firstLine (counting from zero)
+	// with newLines, which must not contain newlines.  Returns false if the
+	// range is outside of the document.
+	bool ReplaceLines(const size_t &firstLine, const size_t &removedCount,
+		const std::vector<std::string> &newLines);
+
+	Counts GetCounts(void) const;
+	size_t GetLineCount(void) const;
+
+private:
+	IncrementalCounter *counter;
+
+	Document(const Document&);
+	Document& operator=(const Document&);
+};
+
+}// namespace LineCounterLibrary
+
+#endif// LINE_COUNTER_LIBRARY_H_
@@ -0,0 +1,239 @@
+// File:  lineTypeRecorder.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Records whether each line of a file is code, comment or blank as it
+//        is counted, as runs of lines of the same type, and writes the runs
+//        for each file so other tools can use them without parsing again.
+
+// Standard C++ headers
+#include <cstdio>
+
+// Local headers
+#include "lineTypeRecorder.h"
+
+//==========================================================================
+// Class:			LineTypeRecorder
+// Function:		GetName
+//
+// Description:		Returns the name used for the line type in JSON output.
+//
+// Input Arguments:
+//		type	= const LineType&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const char*
+//
+//==========================================================================
+const char* LineTypeRecorder::GetName(const LineType &type)
+{
+	if (type == LineCode)
+		return "code";
+	else if (type == LineComment)
+		return "comment";
+	return "blank";
+}
+
+//==========================================================================
+// Class:			LineTypeWriter
+// Function:		Open
+//
+// Description:		Creates the output file (writing the header for the
+//					binary format).
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//		format		= const Format&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LineTypeWriter::Open(const std::string &fileName, const Format &format)
+{
+	this->format = format;
+	file.open(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+		return false;
+
+	if (format == FormatBinary)
+		file.write("LCLT\x01", 5);
+
+	return file.good();
+}
+
+//==========================================================================
+// Class:			LineTypeWriter
+// Function:		Close
+//
+// Description:		Closes the output file.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if everything was written successfully, false otherwise
+//
+//==========================================================================
+bool LineTypeWriter::Close(void)
+{
+	file.close();
+	return !file.fail();
+}
+
+//==========================================================================
+// Class:			LineTypeWriter
+// Function:		Write
+//
+// Description:		Writes the runs recorded for one file.  The record is
+//					formatted before locking, so threads only wait for each
+//					other while the finished record is copied to the file.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//		recorder	= const LineTypeRecorder&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineTypeWriter::Write(const std::string &fileName, const LineTypeRecorder &recorder)
+{
+	std::string record;
+	if (format == FormatBinary)
+		AppendBinary(fileName, recorder, record);
+	else
+		AppendJson(fileName, recorder, record);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	file.write(record.data(), record.length());
+}
+
+//==========================================================================
+// Class:			LineTypeWriter
+// Function:		AppendJson
+//
+// Description:		Formats the runs for one file as a line of JSON.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//		recorder	= const LineTypeRecorder&
+//
+// Output Arguments:
+//		output		= std::string&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineTypeWriter::AppendJson(const std::string &fileName,
+	const LineTypeRecorder &recorder, std::string &output)
+{
+	output.append("{\"file\":\"");
+
+	std::string::const_iterator it;
+	char escaped[8];
+	for (it = fileName.begin(); it != fileName.end(); ++it)
+	{
+		if (*it == '"' || *it == '\\')
+		{
+			output.push_back('\\');
+			output.push_back(*it);
+		}
+		else if (static_cast<unsigned char>(*it) < 0x20)
+		{
+			snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(*it));
+			output.append(escaped);
+		}
+		else
+			output.push_back(*it);
+	}
+
+	output.append("\",\"runs\":[");
+
+	const std::vector<LineTypeRecorder::Run> &runs(recorder.GetRuns());
+	unsigned int i;
+	for (i = 0; i < runs.size(); i++)
+	{
+		if (i > 0)
+			output.push_back(',');
+		output.append("[\"");
+		output.append(LineTypeRecorder::GetName(runs[i].type));
+		output.append("\",");
+		output.append(std::to_string(runs[i].length));
+		output.push_back(']');
+	}
+
+	output.append("]}\n");
+}
+
+//==========================================================================
+// Class:			LineTypeWriter
+// Function:		AppendBinary
+//
+// Description:		Formats the runs for one file as a binary record.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//		recorder	= const LineTypeRecorder&
+//
+// Output Arguments:
+//		output		= std::string&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineTypeWriter::AppendBinary(const std::string &fileName,
+	const LineTypeRecorder &recorder, std::string &output)
+{
+	AppendVarint(fileName.length(), output);
+	output.append(fileName);
+
+	const std::vector<LineTypeRecorder::Run> &runs(recorder.GetRuns());
+	AppendVarint(runs.size(), output);
+
+	unsigned int i;
+	for (i = 0; i < runs.size(); i++)
+		AppendVarint(runs[i].length * 4 + runs[i].type, output);
+}
+
+//==========================================================================
+// Class:			LineTypeWriter
+// Function:		AppendVarint
+//
+// Description:		Appends a number as an unsigned LEB128 integer (seven
+//					bits per byte, least significant first, with the high
+//					bit set on all but the last byte).
+//
+// Input Arguments:
+//		value	= unsigned long long
+//
+// Output Arguments:
+//		output	= std::string&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LineTypeWriter::AppendVarint(unsigned long long value, std::string &output)
+{
+	while (value >= 0x80)
+	{
+		output.push_back(static_cast<char>((value & 0x7f) | 0x80));
+		value >>= 7;
+	}
+
+	output.push_back(static_cast<char>(value));
+}
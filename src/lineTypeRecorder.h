@@ -0,0 +1,102 @@
+// File:  lineTypeRecorder.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Records whether each line of a file is code, comment or blank as it
+//        is counted, as runs of lines of the same type, and writes the runs
+//        for each file so other tools can use them without parsing again.
+
+#ifndef LINE_TYPE_RECORDER_H_
+#define LINE_TYPE_RECORDER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <fstream>
+#include <mutex>
+
+// Local headers
+#include "sourceParser.h"
+
+class LineTypeRecorder
+{
+public:
+	enum LineType
+	{
+		LineCode,
+		LineComment,
+		LineBlank
+	};
+
+	struct Run
+	{
+		LineType type;
+		unsigned long long length;
+	};
+
+	void Clear(void) { runs.clear(); };
+
+	// Uses the same classification as LineCounter::CountLine()
+	inline void Add(const SourceParser::PositionState &state)
+	{
+		const LineType type(GetLineType(state));
+		if (!runs.empty() && runs.back().type == type)
+			runs.back().length++;
+		else
+		{
+			const Run run = { type, 1 };
+			runs.push_back(run);
+		}
+	};
+
+	const std::vector<Run>& GetRuns(void) const { return runs; };
+
+	static inline LineType GetLineType(const SourceParser::PositionState &state)
+	{
+		if (state == SourceParser::PositionCode)
+			return LineCode;
+		else if (state == SourceParser::PositionWhitespace)
+			return LineBlank;
+		return LineComment;
+	};
+
+	static const char* GetName(const LineType &type);
+
+private:
+	std::vector<Run> runs;
+};
+
+// Writes the runs for each file to a file, either as newline-delimited JSON:
+//   {"file":"src/main.cpp","runs":[["comment",4],["blank",1],["code",20]]}
+// or in binary form:  the header "LCLT" and a version byte (1), followed by
+// one record per file.  Each record is the length of the file name, the
+// name, the number of runs and then each run's length * 4 + type (LineType),
+// with all numbers as unsigned LEB128 variable-length integers.
+class LineTypeWriter
+{
+public:
+	enum Format
+	{
+		FormatNdjson,
+		FormatBinary
+	};
+
+	bool Open(const std::string &fileName, const Format &format);
+	bool Close(void);// Returns false if any write failed
+
+	// Thread-safe
+	void Write(const std::string &fileName, const LineTypeRecorder &recorder);
+
+	static void AppendJson(const std::string &fileName,
+		const LineTypeRecorder &recorder, std::string &output);
+	static void AppendBinary(const std::string &fileName,
+		const LineTypeRecorder &recorder, std::string &output);
+
+private:
+	Format format;
+	std::ofstream file;
+	std::mutex mutex;
+
+	static void AppendVarint(unsigned long long value, std::string &output);
+};
+
+#endif// LINE_TYPE_RECORDER_H_
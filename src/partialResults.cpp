@@ -0,0 +1,183 @@
+// File:  partialResults.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Compact text form of the statistics for part of a search, used to
+//        pass results between processes and to combine the results of
+//        separate runs.
+
+// Standard C++ headers
+#include <fstream>
+#include <sstream>
+
+// Local headers
+#include "partialResults.h"
+
+namespace PartialResults
+{
+
+// First line of partial result files
+static const std::string fileHeader("LineCounter partial results 1");
+
+//==========================================================================
+// Class:			None
+// Function:		Format
+//
+// Description:		Converts the statistics to a single line of text.
+//
+// Input Arguments:
+//		statistics	= const LineCounter::Statistics&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string Format(const LineCounter::Statistics &statistics)
+{
+	std::ostringstream ss;
+	ss << "files " << statistics.fileCount
+		<< " blank " << statistics.blankLines
+		<< " comment " << statistics.commentLines
+		<< " code " << statistics.codeLines;
+	return ss.str();
+}
+
+//==========================================================================
+// Class:			None
+// Function:		Parse
+//
+// Description:		Reads statistics from text created by Format().
+//
+// Input Arguments:
+//		text	= const std::string&
+//
+// Output Arguments:
+//		statistics	= LineCounter::Statistics&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool Parse(const std::string &text, LineCounter::Statistics &statistics)
+{
+	std::istringstream ss(text);
+	std::string files, blank, comment, code;
+	LineCounter::Statistics s;
+	if (!(ss >> files >> s.fileCount >> blank >> s.blankLines
+		>> comment >> s.commentLines >> code >> s.codeLines))
+		return false;
+
+	if (files != "files" || blank != "blank" || comment != "comment" || code != "code")
+		return false;
+
+	statistics = s;
+	return true;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		Write
+//
+// Description:		Writes the statistics to a partial results file.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//		statistics	= const LineCounter::Statistics&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool Write(const std::string &fileName, const LineCounter::Statistics &statistics)
+{
+	std::ofstream file(fileName.c_str());
+	if (!file.is_open())
+		return false;
+
+	file << fileHeader << '\n' << Format(statistics) << '\n';
+	return file.good();
+}
+
+//==========================================================================
+// Class:			None
+// Function:		Read
+//
+// Description:		Reads the statistics from a partial results file.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		statistics	= LineCounter::Statistics&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool Read(const std::string &fileName, LineCounter::Statistics &statistics)
+{
+	std::ifstream file(fileName.c_str());
+	std::string header, line;
+	if (!std::getline(file, header) || !std::getline(file, line))
+		return false;
+
+	if (!header.empty() && *header.rbegin() == '\r')
+		header.erase(header.length() - 1);
+
+	return header == fileHeader && Parse(line, statistics);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		Clear
+//
+// Description:		Sets all of the counts to zero.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		statistics	= LineCounter::Statistics&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Clear(LineCounter::Statistics &statistics)
+{
+	statistics.blankLines = 0;
+	statistics.commentLines = 0;
+	statistics.codeLines = 0;
+	statistics.fileCount = 0;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		Add
+//
+// Description:		Adds partial statistics to a total.
+//
+// Input Arguments:
+//		partial	= const LineCounter::Statistics&
+//
+// Output Arguments:
+//		total	= LineCounter::Statistics&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Add(const LineCounter::Statistics &partial, LineCounter::Statistics &total)
+{
+	total.blankLines += partial.blankLines;
+	total.commentLines += partial.commentLines;
+	total.codeLines += partial.codeLines;
+	total.fileCount += partial.fileCount;
+}
+
+}
@@ -0,0 +1,31 @@
+// File:  partialResults.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Compact text form of the statistics for part of a search, used to
+//        pass results between processes and to combine the results of
+//        separate runs.
+
+#ifndef PARTIAL_RESULTS_H_
+#define PARTIAL_RESULTS_H_
+
+// Standard C++ headers
+#include <string>
+
+// Local headers
+#include "lineCounter.h"
+
+namespace PartialResults
+{
+
+std::string Format(const LineCounter::Statistics &statistics);
+bool Parse(const std::string &text, LineCounter::Statistics &statistics);
+
+bool Write(const std::string &fileName, const LineCounter::Statistics &statistics);
+bool Read(const std::string &fileName, LineCounter::Statistics &statistics);
+
+void Clear(LineCounter::Statistics &statistics);
+void Add(const LineCounter::Statistics &partial, LineCounter::Statistics &total);
+
+}
+
+#endif// PARTIAL_RESULTS_H_
@@ -0,0 +1,401 @@
+// File:  pathFilter.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Compiled list of glob patterns (with .gitignore syntax) used to
+//        exclude files and directories from the search.
+
+// Standard C++ headers
+#include <cstring>
+
+// Local headers
+#include "pathFilter.h"
+
+//==========================================================================
+// Class:			PathFilter
+// Function:		AddPattern
+//
+// Description:		Compiles a single pattern and adds it to the list.  The
+//					syntax is that of .gitignore files:  blank lines and lines
+//					starting with '#' are ignored, a leading '!' re-includes
+//					paths excluded by earlier patterns, a trailing '/' matches
+//					only directories and a pattern containing no other '/'
+//					matches names at any depth.  Later patterns take
+//					precedence over earlier ones.
+//
+// Input Arguments:
+//		pattern	= const std::string&
+//		base	= const std::string&, directory (relative to the search
+//				  directory) to which the pattern applies
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PathFilter::AddPattern(const std::string &pattern, const std::string &base)
+{
+	size_t begin(0), end(pattern.length());
+	if (end > 0 && pattern[end - 1] == '\r')
+		end--;
+
+	// Trailing spaces are ignored unless escaped
+	while (end > begin && pattern[end - 1] == ' ' &&
+		!(end > begin + 1 && pattern[end - 2] == '\\'))
+		end--;
+
+	if (begin == end || pattern[begin] == '#')
+		return;
+
+	Pattern p;
+	p.base = base;
+	p.negate = pattern[begin] == '!';
+	if (p.negate)
+		begin++;
+
+	p.directoryOnly = end > begin && pattern[end - 1] == '/';
+	if (p.directoryOnly)
+		end--;
+
+	const size_t slash(pattern.find('/', begin));
+	p.matchName = slash == std::string::npos || slash >= end;
+	if (!p.matchName && pattern[begin] == '/')
+		begin++;
+
+	if (begin == end)
+		return;
+
+	Compile(pattern.substr(begin, end - begin), p.tokens);
+	if (p.tokens.size() == 1 && p.tokens[0].type == TokenLiteral)
+		p.kind = KindLiteral;
+	else if (p.tokens.size() == 2 && p.tokens[0].type == TokenStar &&
+		p.tokens[1].type == TokenLiteral && p.tokens[1].literal.find('/') == std::string::npos)
+		p.kind = KindSuffix;
+	else
+		p.kind = KindGeneral;
+
+	patterns.push_back(p);
+}
+
+//==========================================================================
+// Class:			PathFilter
+// Function:		AddPatterns
+//
+// Description:		Adds each line of the specified text (i.e. the contents
+//					of a .gitignore file) as a pattern.
+//
+// Input Arguments:
+//		contents	= const std::string&
+//		base		= const std::string&, directory (relative to the search
+//					  directory) to which the patterns apply
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PathFilter::AddPatterns(const std::string &contents, const std::string &base)
+{
+	size_t start(0), end;
+	while (start < contents.length())
+	{
+		end = contents.find('\n', start);
+		if (end == std::string::npos)
+			end = contents.length();
+
+		AddPattern(contents.substr(start, end - start), base);
+		start = end + 1;
+	}
+}
+
+//==========================================================================
+// Class:			PathFilter
+// Function:		RemovePatterns
+//
+// Description:		Removes the most recently added patterns, leaving the
+//					specified number.
+//
+// Input Arguments:
+//		count	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PathFilter::RemovePatterns(const size_t &count)
+{
+	if (count < patterns.size())
+		patterns.resize(count);
+}
+
+//==========================================================================
+// Class:			PathFilter
+// Function:		IsExcluded
+//
+// Description:		Checks the specified path against the patterns.  The
+//					last matching pattern determines the result.
+//
+// Input Arguments:
+//		begin		= const char*, path relative to the search directory
+//		end			= const char*
+//		isDirectory	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the path should be skipped
+//
+//==========================================================================
+bool PathFilter::IsExcluded(const char *begin, const char *end,
+	const bool &isDirectory) const
+{
+	const char *name(end);
+	while (name != begin && *(name - 1) != '/')
+		name--;
+
+	size_t i;
+	for (i = patterns.size(); i > 0; i--)
+	{
+		const Pattern &p(patterns[i - 1]);
+		if (p.directoryOnly && !isDirectory)
+			continue;
+
+		const size_t baseLength(p.base.length());
+		if (baseLength > 0 && (size_t(end - begin) <= baseLength ||
+			memcmp(begin, p.base.c_str(), baseLength) != 0))
+			continue;
+
+		if (Matches(p, p.matchName ? name : begin + baseLength, end))
+			return !p.negate;
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Class:			PathFilter
+// Function:		Compile
+//
+// Description:		Converts the glob to a list of tokens.
+//
+// Input Arguments:
+//		glob	= const std::string&
+//
+// Output Arguments:
+//		tokens	= std::vector<Token>&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PathFilter::Compile(const std::string &glob, std::vector<Token> &tokens)
+{
+	tokens.clear();
+	size_t i;
+	for (i = 0; i < glob.length(); i++)
+	{
+		Token token;
+		const char c(glob[i]);
+		if (c == '*')
+		{
+			if (i + 1 < glob.length() && glob[i + 1] == '*' && (i == 0 || glob[i - 1] == '/'))
+			{
+				if (i + 2 == glob.length())
+				{
+					token.type = TokenDoubleStar;
+					i++;
+				}
+				else if (glob[i + 2] == '/')
+				{
+					token.type = TokenDirectories;
+					i += 2;
+				}
+				else
+					token.type = TokenStar;
+			}
+			else
+				token.type = TokenStar;
+
+			// Consecutive stars are equivalent to one
+			if (token.type == TokenStar && !tokens.empty() && tokens.back().type == TokenStar)
+				continue;
+		}
+		else if (c == '?')
+			token.type = TokenAnyCharacter;
+		else if (c == '[' && glob.find(']', i + 2) != std::string::npos)
+		{
+			size_t j(i + 1);
+			const bool negate(glob[j] == '!' || glob[j] == '^');
+			if (negate)
+				j++;
+
+			// A ']' immediately following the '[' is part of the set
+			do
+			{
+				if (glob[j] == '\\' && j + 1 < glob.length())
+					j++;
+
+				if (j + 2 < glob.length() && glob[j + 1] == '-' && glob[j + 2] != ']')
+				{
+					unsigned int k;
+					for (k = (unsigned char)glob[j]; k <= (unsigned char)glob[j + 2]; k++)
+						token.characters.set(k);
+					j += 3;
+				}
+				else
+					token.characters.set((unsigned char)glob[j++]);
+			} while (j < glob.length() && glob[j] != ']');
+
+			if (j >= glob.length())
+			{
+				// Not a valid set after all; treat the '[' as a literal
+				token.characters.reset();
+				token.type = TokenLiteral;
+				token.literal = "[";
+			}
+			else
+			{
+				if (negate)
+					token.characters.flip();
+				token.characters.reset('/');
+				token.type = TokenCharacterClass;
+				i = j;
+			}
+		}
+		else
+		{
+			if (c == '\\' && i + 1 < glob.length())
+				i++;
+			token.type = TokenLiteral;
+			token.literal = glob[i];
+		}
+
+		if (token.type == TokenLiteral && !tokens.empty() && tokens.back().type == TokenLiteral)
+			tokens.back().literal.append(token.literal);
+		else
+			tokens.push_back(token);
+	}
+}
+
+//==========================================================================
+// Class:			PathFilter
+// Function:		Matches
+//
+// Description:		Checks the string against the pattern, using a string
+//					comparison for patterns without wildcards.
+//
+// Input Arguments:
+//		pattern	= const Pattern&
+//		begin	= const char*
+//		end		= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool PathFilter::Matches(const Pattern &pattern, const char *begin, const char *end)
+{
+	const size_t length(end - begin);
+	if (pattern.kind == KindLiteral)
+		return length == pattern.tokens[0].literal.length() &&
+			memcmp(begin, pattern.tokens[0].literal.c_str(), length) == 0;
+	else if (pattern.kind == KindSuffix)
+	{
+		const std::string &suffix(pattern.tokens[1].literal);
+		return length >= suffix.length() &&
+			memcmp(end - suffix.length(), suffix.c_str(), suffix.length()) == 0 &&
+			memchr(begin, '/', length - suffix.length()) == NULL;
+	}
+
+	return Matches(pattern.tokens, 0, begin, end);
+}
+
+//==========================================================================
+// Class:			PathFilter
+// Function:		Matches
+//
+// Description:		Checks the string against the tokens, starting with the
+//					specified token.  Wildcards try each possible length,
+//					shortest first.
+//
+// Input Arguments:
+//		tokens	= const std::vector<Token>&
+//		next	= size_t, index of the first token to match
+//		begin	= const char*
+//		end		= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool PathFilter::Matches(const std::vector<Token> &tokens, size_t next,
+	const char *begin, const char *end)
+{
+	for (; next < tokens.size(); next++)
+	{
+		const Token &token(tokens[next]);
+		switch (token.type)
+		{
+		case TokenLiteral:
+			if (size_t(end - begin) < token.literal.length() ||
+				memcmp(begin, token.literal.c_str(), token.literal.length()) != 0)
+				return false;
+			begin += token.literal.length();
+			break;
+
+		case TokenAnyCharacter:
+			if (begin == end || *begin == '/')
+				return false;
+			begin++;
+			break;
+
+		case TokenCharacterClass:
+			if (begin == end || !token.characters.test((unsigned char)*begin))
+				return false;
+			begin++;
+			break;
+
+		case TokenStar:
+			if (next + 1 == tokens.size())
+				return memchr(begin, '/', end - begin) == NULL;
+
+			for (;; begin++)
+			{
+				if (Matches(tokens, next + 1, begin, end))
+					return true;
+				if (begin == end || *begin == '/')
+					return false;
+			}
+
+		case TokenDoubleStar:
+			return true;
+
+		case TokenDirectories:
+			for (;;)
+			{
+				if (Matches(tokens, next + 1, begin, end))
+					return true;
+
+				const char *slash(static_cast<const char*>(memchr(begin, '/', end - begin)));
+				if (!slash)
+					return false;
+				begin = slash + 1;
+			}
+		}
+	}
+
+	return begin == end;
+}
@@ -0,0 +1,71 @@
+// File:  pathFilter.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Compiled list of glob patterns (with .gitignore syntax) used to
+//        exclude files and directories from the search.
+
+#ifndef PATH_FILTER_H_
+#define PATH_FILTER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <bitset>
+
+class PathFilter
+{
+public:
+	// Patterns are relative to base, which is empty or ends with '/'
+	void AddPattern(const std::string &pattern, const std::string &base = std::string());
+	void AddPatterns(const std::string &contents, const std::string &base);// One per line
+
+	size_t GetPatternCount(void) const { return patterns.size(); };
+	void RemovePatterns(const size_t &count);// Removes all but the first count patterns
+
+	// Path is relative to the search directory, separated by '/'
+	bool IsExcluded(const char *begin, const char *end, const bool &isDirectory) const;
+
+private:
+	enum TokenType
+	{
+		TokenLiteral,
+		TokenAnyCharacter,// ?
+		TokenCharacterClass,// [...]
+		TokenStar,// *, does not match '/'
+		TokenDoubleStar,// Trailing **, matches everything
+		TokenDirectories// **/, matches zero or more whole directories
+	};
+
+	struct Token
+	{
+		TokenType type;
+		std::string literal;
+		std::bitset<256> characters;
+	};
+
+	enum PatternKind
+	{
+		KindLiteral,// No wildcards
+		KindSuffix,// * followed by a literal, e.g. *.o
+		KindGeneral
+	};
+
+	struct Pattern
+	{
+		std::string base;
+		std::vector<Token> tokens;
+		PatternKind kind;
+		bool matchName;// No '/' in the pattern, so it matches the name at any depth
+		bool directoryOnly;
+		bool negate;
+	};
+
+	std::vector<Pattern> patterns;
+
+	static void Compile(const std::string &glob, std::vector<Token> &tokens);
+	static bool Matches(const Pattern &pattern, const char *begin, const char *end);
+	static bool Matches(const std::vector<Token> &tokens, size_t next,
+		const char *begin, const char *end);
+};
+
+#endif// PATH_FILTER_H_
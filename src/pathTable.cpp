@@ -0,0 +1,475 @@
+// File:  pathTable.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Compact storage for the paths of many files.  Each directory is
+//        stored once, as its name and its parent, and each file as its name
+//        and its directory, so the common parts of paths are only stored
+//        once.  Names are copied into large blocks rather than allocated
+//        one at a time.  Files are identified by integers, assigned in the
+//        order in which they are added.
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+// Local headers
+#include "pathTable.h"
+
+// Size of the blocks holding the names (longer names get their own block)
+const size_t PathTable::blockSize(65536);
+
+// Marks directories in the lists of directory entries built for sorting
+static const unsigned int directoryFlag(0x80000000);
+
+//==========================================================================
+// Class:			PathTable
+// Function:		PathTable
+//
+// Description:		Constructor for PathTable class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+PathTable::PathTable() : directoryTable(64, 0)
+{
+	Node root;
+	root.name = "";
+	root.length = 0;
+	root.parent = 0;
+	directories.push_back(root);
+
+	blockUsed = blockSize;// Allocate the first block when it's needed
+	allocatedBytes = 0;
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		~PathTable
+//
+// Description:		Destructor for PathTable class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+PathTable::~PathTable()
+{
+	unsigned int i;
+	for (i = 0; i < blocks.size(); i++)
+		delete [] blocks[i];
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		Add
+//
+// Description:		Adds a file.  Each part of the path before a slash is a
+//					directory.
+//
+// Input Arguments:
+//		path	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, id of the file
+//
+//==========================================================================
+unsigned int PathTable::Add(const std::string &path)
+{
+	assert(files.size() < directoryFlag);
+
+	unsigned int directory(0);
+	size_t start(0), slash;
+	while ((slash = path.find('/', start)) != std::string::npos)
+	{
+		directory = FindDirectory(directory, path.data() + start,
+			static_cast<unsigned int>(slash - start));
+		start = slash + 1;
+	}
+
+	Node file;
+	file.length = static_cast<unsigned int>(path.length() - start);
+	file.name = StoreName(path.data() + start, file.length);
+	file.parent = directory;
+	files.push_back(file);
+
+	return static_cast<unsigned int>(files.size() - 1);
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		FindDirectory
+//
+// Description:		Returns the index of the specified directory, adding it
+//					if it doesn't exist.
+//
+// Input Arguments:
+//		parent	= const unsigned int&
+//		name	= const char*
+//		length	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int PathTable::FindDirectory(const unsigned int &parent,
+	const char *name, const unsigned int &length)
+{
+	const size_t mask(directoryTable.size() - 1);
+	size_t slot(Hash(parent, name, length) & mask);
+	while (directoryTable[slot] != 0)
+	{
+		const Node &directory(directories[directoryTable[slot]]);
+		if (directory.parent == parent && directory.length == length &&
+			memcmp(directory.name, name, length) == 0)
+			return directoryTable[slot];
+		slot = (slot + 1) & mask;
+	}
+
+	Node directory;
+	directory.name = StoreName(name, length);
+	directory.length = length;
+	directory.parent = parent;
+	directories.push_back(directory);
+
+	const unsigned int index(static_cast<unsigned int>(directories.size() - 1));
+	directoryTable[slot] = index;
+
+	// Keep the table at most three-quarters full
+	if (directories.size() * 4 > directoryTable.size() * 3)
+		GrowDirectoryTable();
+
+	return index;
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		GrowDirectoryTable
+//
+// Description:		Doubles the size of the directory hash table.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PathTable::GrowDirectoryTable(void)
+{
+	std::vector<unsigned int>(directoryTable.size() * 2, 0).swap(directoryTable);
+	const size_t mask(directoryTable.size() - 1);
+
+	unsigned int i;
+	size_t slot;
+	for (i = 1; i < directories.size(); i++)
+	{
+		slot = Hash(directories[i].parent, directories[i].name, directories[i].length) & mask;
+		while (directoryTable[slot] != 0)
+			slot = (slot + 1) & mask;
+		directoryTable[slot] = i;
+	}
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		StoreName
+//
+// Description:		Copies a name into the current block.
+//
+// Input Arguments:
+//		name	= const char*
+//		length	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const char*, location of the copy
+//
+//==========================================================================
+const char* PathTable::StoreName(const char *name, const unsigned int &length)
+{
+	if (length > blockSize)
+	{
+		// Insert before the last block, so that block can still be filled
+		char *block(new char[length]);
+		blocks.insert(blocks.end() - (blocks.empty() ? 0 : 1), block);
+		allocatedBytes += length;
+		memcpy(block, name, length);
+		return block;
+	}
+
+	if (blocks.empty() || blockUsed + length > blockSize)
+	{
+		blocks.push_back(new char[blockSize]);
+		allocatedBytes += blockSize;
+		blockUsed = 0;
+	}
+
+	char *copy(blocks.back() + blockUsed);
+	memcpy(copy, name, length);
+	blockUsed += length;
+	return copy;
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		GetPath
+//
+// Description:		Returns the full path of a file.
+//
+// Input Arguments:
+//		id	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string PathTable::GetPath(const unsigned int &id) const
+{
+	assert(id < files.size());
+	std::string path;
+	AppendDirectory(files[id].parent, path);
+	path.append(files[id].name, files[id].length);
+	return path;
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		AppendDirectory
+//
+// Description:		Appends the path of a directory (with a trailing slash,
+//					except for the root).
+//
+// Input Arguments:
+//		directory	= const unsigned int&
+//
+// Output Arguments:
+//		path		= std::string&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PathTable::AppendDirectory(const unsigned int &directory, std::string &path) const
+{
+	if (directory == 0)
+		return;
+
+	AppendDirectory(directories[directory].parent, path);
+	path.append(directories[directory].name, directories[directory].length);
+	path.push_back('/');
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		GetSortedIds
+//
+// Description:		Lists the files in order of path, by visiting the
+//					entries of each directory in order, starting from the
+//					root.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<unsigned int>
+//
+//==========================================================================
+std::vector<unsigned int> PathTable::GetSortedIds(void) const
+{
+	// Group the entries of each directory together
+	std::vector<unsigned int> childStart(directories.size() + 1, 0);
+	unsigned int i;
+	for (i = 1; i < directories.size(); i++)
+		childStart[directories[i].parent + 1]++;
+	for (i = 0; i < files.size(); i++)
+		childStart[files[i].parent + 1]++;
+	for (i = 1; i < childStart.size(); i++)
+		childStart[i] += childStart[i - 1];
+
+	std::vector<unsigned int> next(childStart.begin(), childStart.end() - 1);
+	std::vector<unsigned int> children(childStart.back());
+	for (i = 1; i < directories.size(); i++)
+		children[next[directories[i].parent]++] = i | directoryFlag;
+	for (i = 0; i < files.size(); i++)
+		children[next[files[i].parent]++] = i;
+
+	std::vector<unsigned int> sortedIds;
+	sortedIds.reserve(files.size());
+	SortDirectory(0, childStart, children, sortedIds);
+	return sortedIds;
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		SortDirectory
+//
+// Description:		Sorts the entries of a directory and lists its files
+//					(and those of its subdirectories) in order.
+//
+// Input Arguments:
+//		directory	= const unsigned int&
+//		childStart	= const std::vector<unsigned int>&, index of each
+//					  directory's first entry in children
+//		children	= const std::vector<unsigned int>&
+//
+// Output Arguments:
+//		sortedIds	= std::vector<unsigned int>&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PathTable::SortDirectory(const unsigned int &directory,
+	const std::vector<unsigned int> &childStart, const std::vector<unsigned int> &children,
+	std::vector<unsigned int> &sortedIds) const
+{
+	std::vector<unsigned int> entries(children.begin() + childStart[directory],
+		children.begin() + childStart[directory + 1]);
+	// Entries are in order of id, and a stable sort keeps duplicates that way
+	std::stable_sort(entries.begin(), entries.end(), [this](const unsigned int &a, const unsigned int &b)
+	{
+		const bool aIsDirectory((a & directoryFlag) != 0), bIsDirectory((b & directoryFlag) != 0);
+		return KeyIsLess(aIsDirectory ? directories[a & ~directoryFlag] : files[a], aIsDirectory,
+			bIsDirectory ? directories[b & ~directoryFlag] : files[b], bIsDirectory);
+	});
+
+	unsigned int i;
+	const Node *lastFile(NULL);
+	for (i = 0; i < entries.size(); i++)
+	{
+		if ((entries[i] & directoryFlag) != 0)
+		{
+			SortDirectory(entries[i] & ~directoryFlag, childStart, children, sortedIds);
+			continue;
+		}
+
+		// Duplicates are next to each other
+		const Node &file(files[entries[i]]);
+		if (lastFile && lastFile->length == file.length &&
+			memcmp(lastFile->name, file.name, file.length) == 0)
+			continue;
+
+		sortedIds.push_back(entries[i]);
+		lastFile = &file;
+	}
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		KeyIsLess
+//
+// Description:		Compares two entries of the same directory.  The key for
+//					a file is its name and the key for a directory is its
+//					name followed by a slash.
+//
+// Input Arguments:
+//		a				= const Node&
+//		aIsDirectory	= const bool&
+//		b				= const Node&
+//		bIsDirectory	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if a comes before b
+//
+//==========================================================================
+bool PathTable::KeyIsLess(const Node &a, const bool &aIsDirectory,
+	const Node &b, const bool &bIsDirectory)
+{
+	const unsigned int length(std::min(a.length, b.length));
+	const int comparison(memcmp(a.name, b.name, length));
+	if (comparison != 0)
+		return comparison < 0;
+
+	// Compare the next character of each key (nothing, a slash or a character of the name)
+	const int aNext(a.length > length ? static_cast<unsigned char>(a.name[length]) : (aIsDirectory ? '/' : -1));
+	const int bNext(b.length > length ? static_cast<unsigned char>(b.name[length]) : (bIsDirectory ? '/' : -1));
+	return aNext < bNext;
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		Hash
+//
+// Description:		Hashes a directory's parent and name (FNV-1a).
+//
+// Input Arguments:
+//		parent	= const unsigned int&
+//		name	= const char*
+//		length	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//==========================================================================
+size_t PathTable::Hash(const unsigned int &parent, const char *name, const unsigned int &length)
+{
+	unsigned long long hash(14695981039346656037ULL ^ parent);
+	unsigned int i;
+	for (i = 0; i < length; i++)
+	{
+		hash ^= static_cast<unsigned char>(name[i]);
+		hash *= 1099511628211ULL;
+	}
+
+	return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+//==========================================================================
+// Class:			PathTable
+// Function:		GetMemoryUsage
+//
+// Description:		Returns the number of bytes allocated for the table.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//==========================================================================
+size_t PathTable::GetMemoryUsage(void) const
+{
+	return (directories.capacity() + files.capacity()) * sizeof(Node)
+		+ directoryTable.capacity() * sizeof(unsigned int)
+		+ blocks.capacity() * sizeof(char*) + allocatedBytes;
+}
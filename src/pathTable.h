@@ -0,0 +1,77 @@
+// File:  pathTable.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Compact storage for the paths of many files.  Each directory is
+//        stored once, as its name and its parent, and each file as its name
+//        and its directory, so the common parts of paths are only stored
+//        once.  Names are copied into large blocks rather than allocated
+//        one at a time.  Files are identified by integers, assigned in the
+//        order in which they are added.
+
+#ifndef PATH_TABLE_H_
+#define PATH_TABLE_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+
+class PathTable
+{
+public:
+	PathTable();
+	~PathTable();
+
+	// Returns the new file's id (the same path may be added more than once)
+	unsigned int Add(const std::string &path);
+
+	std::string GetPath(const unsigned int &id) const;
+	unsigned int GetFileCount(void) const { return static_cast<unsigned int>(files.size()); };
+
+	// Returns the ids in order of path (compared byte by byte), with only
+	// the first id for each path
+	std::vector<unsigned int> GetSortedIds(void) const;
+
+	// Bytes allocated for the table
+	size_t GetMemoryUsage(void) const;
+
+private:
+	PathTable(const PathTable&);
+	PathTable& operator=(const PathTable&);
+
+	struct Node
+	{
+		const char *name;// Not NUL terminated
+		unsigned int length;
+		unsigned int parent;// Index of the directory containing this node
+	};
+
+	std::vector<Node> directories;// The first is the root, with an empty name
+	std::vector<Node> files;
+
+	// Open addressing hash table of directory indices (zero for empty
+	// slots, since the root is never looked up)
+	std::vector<unsigned int> directoryTable;
+
+	static const size_t blockSize;
+	std::vector<char*> blocks;
+	size_t blockUsed;// Bytes used in the last block
+	size_t allocatedBytes;// Total size of the blocks
+
+	unsigned int FindDirectory(const unsigned int &parent, const char *name, const unsigned int &length);
+	void GrowDirectoryTable(void);
+	const char* StoreName(const char *name, const unsigned int &length);
+	void AppendDirectory(const unsigned int &directory, std::string &path) const;
+
+	void SortDirectory(const unsigned int &directory,
+		const std::vector<unsigned int> &childStart, const std::vector<unsigned int> &children,
+		std::vector<unsigned int> &sortedIds) const;
+
+	static size_t Hash(const unsigned int &parent, const char *name, const unsigned int &length);
+
+	// Orders the entries of a directory as their full paths would be ordered
+	// (a subdirectory's paths all start with its name and a slash)
+	static bool KeyIsLess(const Node &a, const bool &aIsDirectory,
+		const Node &b, const bool &bIsDirectory);
+};
+
+#endif// PATH_TABLE_H_
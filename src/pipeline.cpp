@@ -0,0 +1,835 @@
+// File:  pipeline.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Runs the search for files, reading of files and parsing of files as
+//        separate stages, each with its own threads, connected by bounded
+//        queues.  This keeps the disks and processors busy at the same time
+//        while limiting the amount of memory used for file contents.
+
+// Standard C++ headers
+#include <iostream>
+#include <thread>
+#include <cctype>
+#include <cstring>
+#include <cerrno>
+
+// *nix headers (also provided by Windows)
+#include <sys/types.h>
+#include <sys/stat.h>
+
+// Local headers
+#include "pipeline.h"
+#include "traverser.h"
+#include "fileProcessor.h"
+#include "fileReader.h"
+#include "uringReader.h"
+#include "archiveReader.h"
+#include "partialResults.h"
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for Pipeline class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const size_t Pipeline::maxQueuedFiles = 65536;
+const size_t Pipeline::archiveChunkSize = 1024 * 1024;
+const unsigned long long Pipeline::earlyClassifySize = 1024 * 1024;
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		Pipeline
+//
+// Description:		Constructor for Pipeline class.
+//
+// Input Arguments:
+//		info	= const LineCounterInformation&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Pipeline::Pipeline(const LineCounterInformation &info) : info(info),
+	readAheadSize((unsigned long long)info.readAheadSize * 1024 * 1024),
+	parallelParseMinimumSize((unsigned long long)info.parallelParseMinimumSize * 1024 * 1024),
+	fileQueue(info.overlapPrescan ? maxQueuedFiles : 0), bufferQueue(readAheadSize),
+	throttle((unsigned long long)info.ioBandwidthLimit * 1024 * 1024, info.ioOperationLimit),
+	searchStopped(false)
+{
+	nextDirectory = 0;
+	nextArchive = 0;
+	prunedDirectoryCount = 0;
+	PartialResults::Clear(archiveStatistics);
+
+	shardIndex = 0;
+	shardCount = 1;
+	shardBySubtree = false;
+
+	fileList = NULL;
+	fileListReader = NULL;
+	resultHandler = NULL;
+	lineTypeWriter = NULL;
+	journal = NULL;
+	fileHandler = NULL;
+	deadline = NULL;
+
+	fileQueue.SetDeviceLimits(info.solidStateDeviceDepth,
+		info.rotationalDeviceDepth, info.networkDeviceDepth);
+
+	unsigned int i, j;
+	for (i = 0; i < info.excludeList.size(); i++)
+		excludes.AddPattern(info.excludeList[i]);
+
+	extensions = info.extensionList;
+	for (i = 0; i < extensions.size(); i++)
+	{
+		for (j = 0; j < extensions[i].length(); j++)
+			extensions[i][j] = tolower((unsigned char)extensions[i][j]);
+	}
+
+	// Larger files are passed on unread; they are either too large to hold in
+	// memory or will be split up and read by multiple threads
+	maxBufferedFileSize = readAheadSize;
+	if (info.threadCount > 1 && parallelParseMinimumSize < maxBufferedFileSize)
+		maxBufferedFileSize = parallelParseMinimumSize;
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		Run
+//
+// Description:		Searches for, reads and parses the files.  Unless the
+//					pre-scan is overlapped with reading and parsing, the
+//					entire search completes first so the largest files are
+//					always read first.  Archives are read alongside the
+//					search, since their contents can only be found by
+//					reading them.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounter::Statistics
+//
+//==========================================================================
+LineCounter::Statistics Pipeline::Run(void)
+{
+	return RunStages(&Pipeline::TraverseDirectories, info.traversalThreadCount,
+		true, info.overlapPrescan);
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		Run
+//
+// Description:		Reads and parses the specified files.  No search is
+//					performed, so the configured directories, exclusions and
+//					shard are ignored.
+//
+// Input Arguments:
+//		files	= const std::vector<FileEntry>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounter::Statistics
+//
+//==========================================================================
+LineCounter::Statistics Pipeline::Run(const std::vector<FileEntry> &files)
+{
+	fileList = &files;
+	return RunStages(&Pipeline::QueueFileList, 1, false, info.overlapPrescan);
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		Run
+//
+// Description:		Reads and parses the files listed in the stream.  No
+//					search is performed, so the configured directories,
+//					archives, exclusions and shard are ignored, but files
+//					without matching extensions are not counted.  Files are
+//					read and parsed while the list is still being read.
+//
+// Input Arguments:
+//		fileList		= std::istream&
+//		nulDelimited	= const bool&, true if the paths are separated by
+//						  NUL characters instead of newlines
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounter::Statistics
+//
+//==========================================================================
+LineCounter::Statistics Pipeline::Run(std::istream &fileList, const bool &nulDelimited)
+{
+	FileListReader reader(fileList, nulDelimited);
+	fileListReader = &reader;
+	const LineCounter::Statistics statistics(RunStages(&Pipeline::QueueFileStream,
+		info.traversalThreadCount, false, true));
+	fileListReader = NULL;
+	return statistics;
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		Scan
+//
+// Description:		Performs the search and returns the files found, without
+//					reading them.  Archives are not included.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<FileEntry>
+//
+//==========================================================================
+std::vector<FileEntry> Pipeline::Scan(void)
+{
+	std::vector<FileEntry> files;
+	std::thread collector([this, &files]()
+	{
+		FileEntry entry;
+		while (fileQueue.Pop(entry))
+		{
+			fileQueue.Release(entry);
+			files.push_back(entry);
+		}
+	});
+
+	std::vector<std::thread> traversers;
+	unsigned int i;
+	for (i = 0; i < info.traversalThreadCount || i == 0; i++)
+		traversers.push_back(std::thread(&Pipeline::TraverseDirectories, this));
+
+	for (i = 0; i < traversers.size(); i++)
+		traversers[i].join();
+	fileQueue.Close();
+	collector.join();
+
+	return files;
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		RunStages
+//
+// Description:		Runs the file finding, reading and parsing stages.
+//
+// Input Arguments:
+//		findFiles		= void (Pipeline::*)(void), thread function which
+//						  adds files to the file queue
+//		findThreadCount	= const unsigned int&
+//		readArchives	= const bool&
+//		overlapFind		= const bool&, true to read and parse files while
+//						  they are still being found
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounter::Statistics
+//
+//==========================================================================
+LineCounter::Statistics Pipeline::RunStages(void (Pipeline::*findFiles)(void),
+	const unsigned int &findThreadCount, const bool &readArchives,
+	const bool &overlapFind)
+{
+	fileHandler = resultHandler;
+	if (journal)
+	{
+		journal->SetFileResultHandler(resultHandler);
+		fileHandler = journal;
+
+		// The directories holding these files are skipped, so links to
+		// them could not be recognized otherwise
+		journal->AddCompletedFileIds(visited);
+	}
+
+	FileProcessor processor(bufferQueue, info.commentList,
+		info.blockCommentList, info.continuationList);
+	processor.SetParallelParsing(info.threadCount, parallelParseMinimumSize);
+	processor.SetFileResultHandler(fileHandler);
+	processor.SetLineTypeWriter(lineTypeWriter);
+	if (info.skipNonSource)
+		processor.SetSkipCounter(&skipCounter);
+	if (throttle.IsEnabled())
+		processor.SetIoThrottle(&throttle);
+	processor.SetPreservePageCache(info.preservePageCache);
+	processor.SetDeadline(deadline);
+
+	// Applies to the threads started from here on
+	if (info.idleIoPriority && !IoThrottle::SetIdlePriority())
+	{
+		std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+		std::cout << "Failed to set idle I/O priority" << std::endl;
+	}
+
+	processor.Start(info.threadCount);
+
+	std::vector<std::thread> readers, traversers, archiveReaders;
+	unsigned int i;
+	for (i = 0; readArchives && i < info.archiveList.size() && i < info.readThreadCount; i++)
+		archiveReaders.push_back(std::thread(&Pipeline::ReadArchives, this));
+
+	if (overlapFind)
+	{
+		for (i = 0; i < info.readThreadCount || i == 0; i++)
+			readers.push_back(std::thread(&Pipeline::ReadFiles, this));
+	}
+
+	for (i = 0; i < findThreadCount || i == 0; i++)
+		traversers.push_back(std::thread(findFiles, this));
+
+	for (i = 0; i < traversers.size(); i++)
+		traversers[i].join();
+	fileQueue.Close();
+
+	if (!overlapFind)
+	{
+		for (i = 0; i < info.readThreadCount || i == 0; i++)
+			readers.push_back(std::thread(&Pipeline::ReadFiles, this));
+	}
+
+	for (i = 0; i < readers.size(); i++)
+		readers[i].join();
+	for (i = 0; i < archiveReaders.size(); i++)
+		archiveReaders[i].join();
+	bufferQueue.Close();
+
+	processor.Wait();
+	LineCounter::Statistics statistics(processor.GetStatistics());
+	PartialResults::Add(archiveStatistics, statistics);
+	return statistics;
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		SetShard
+//
+// Description:		Restricts the search to one of several shards.  Must be
+//					called before Run().
+//
+// Input Arguments:
+//		index		= const unsigned int&
+//		count		= const unsigned int&
+//		bySubtree	= const bool&, true to assign whole top-level directories
+//					  to shards, false to assign individual files
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Pipeline::SetShard(const unsigned int &index, const unsigned int &count,
+	const bool &bySubtree)
+{
+	shardIndex = index;
+	shardCount = count;
+	shardBySubtree = bySubtree;
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		TraverseDirectories
+//
+// Description:		Traversal stage thread function.  Searches directories
+//					from the configured list until none remain.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Pipeline::TraverseDirectories(void)
+{
+	Traverser traverser(info.extensionList, fileQueue,
+		info.recurseIntoSubDirectories, excludes, info.useGitIgnore, visited);
+	traverser.SetShard(shardIndex, shardCount, shardBySubtree);
+	traverser.SetCheckpointJournal(journal);
+	traverser.SetDeadline(deadline);
+	for (;;)
+	{
+		std::string directoryName;
+		{
+			std::lock_guard<std::mutex> lock(directoryMutex);
+			if (nextDirectory >= info.directoryList.size())
+			{
+				prunedDirectoryCount += traverser.GetPrunedDirectoryCount();
+				if (traverser.WasStopped())
+					searchStopped = true;
+				return;
+			}
+			directoryName = info.directoryList[nextDirectory++];
+		}
+
+		// Make sure the directory exists (this is really redundant, since the
+		// same check happens in the config file class)
+		if (!traverser.Traverse(directoryName))
+		{
+			std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+			std::cout << "Directory '" << directoryName
+				<< "' does not exist!  Skipping..." << std::endl;
+		}
+	}
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		QueueFileList
+//
+// Description:		Adds the files passed to Run() to the file queue (except
+//					those completed by an earlier run).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Pipeline::QueueFileList(void)
+{
+	unsigned int i;
+	for (i = 0; i < fileList->size(); i++)
+	{
+		if (!journal || journal->OnFileFound((*fileList)[i].path))
+			fileQueue.Push((*fileList)[i]);
+	}
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		QueueFileStream
+//
+// Description:		File list thread function.  Takes paths from the file
+//					list until none remain (or until the deadline passes) and
+//					adds the files with matching extensions to the file
+//					queue.  Paths which aren't regular files are reported and
+//					skipped; on *nix, files listed more than once (or through
+//					links) are only counted once.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Pipeline::QueueFileStream(void)
+{
+	std::string path;
+	for (;;)
+	{
+		{
+			std::lock_guard<std::mutex> lock(directoryMutex);
+			if (!fileListReader->Next(path))
+				return;
+		}
+
+		if (deadline && deadline->HasPassed())
+		{
+			searchStopped = true;
+			return;
+		}
+
+		const size_t nameStart(path.find_last_of("/\\") + 1);
+		if (!Traverser::ExtensionMatches(path.c_str() + nameStart,
+			path.length() - nameStart, extensions))
+			continue;
+
+		FileEntry entry;
+		entry.path = path;
+#ifdef WIN32
+		struct _stati64 st;
+		const bool found(_stati64(path.c_str(), &st) == 0);
+		const bool regular(found && (st.st_mode & _S_IFREG) != 0);
+#else
+		struct stat st;
+		const bool found(stat(path.c_str(), &st) == 0);
+		const bool regular(found && S_ISREG(st.st_mode));
+#endif
+		if (!regular)
+		{
+			const std::string reason(found ? "is not a regular file" : strerror(errno));
+			std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+			std::cout << "File '" << path << "' cannot be counted (" << reason
+				<< ")!  Skipping..." << std::endl;
+			continue;
+		}
+
+		entry.size = st.st_size;
+#ifdef WIN32
+		entry.device = 0;
+		entry.inode = 0;
+#else
+		entry.device = st.st_dev;
+		entry.inode = st.st_ino;
+		if (!visited.Insert(st.st_dev, st.st_ino))
+			continue;
+#endif
+
+		if (!journal || journal->OnFileFound(entry.path))
+			fileQueue.Push(entry);
+	}
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		ReadFiles
+//
+// Description:		Read stage thread function.  Reads files from the file
+//					queue into memory and passes them to the parse stage.
+//					Files too large to be held in memory (or large enough to
+//					be split across threads) are passed on unread.  Uses
+//					io_uring when enabled and supported by the kernel, unless
+//					reads are limited or the page cache is to be preserved.
+//					Otherwise, when skipping non-source files, the start of
+//					larger files is checked first, and files which will be
+//					skipped are passed on without reading the rest.  Once
+//					the deadline has passed, files are passed on unread (and
+//					reported as unfinished by the parse stage).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Pipeline::ReadFiles(void)
+{
+	if (info.useIoUring && !throttle.IsEnabled() && !info.preservePageCache)
+	{
+		UringReader reader(info.ioUringDepth);
+		if (reader.IsOK())
+		{
+			reader.Run(fileQueue, bufferQueue, maxBufferedFileSize, deadline);
+			return;
+		}
+	}
+
+	FileEntry entry;
+	while (fileQueue.Pop(entry))
+	{
+		FileBuffer file;
+		file.entry = entry;
+		file.buffered = false;
+
+		if ((!deadline || !deadline->HasPassed()) &&
+			entry.size < maxBufferedFileSize && (!info.skipNonSource ||
+			entry.size < earlyClassifySize || IsSource(entry.path)))
+		{
+			throttle.Acquire(entry.size);
+			file.buffered = FileReader::Read(entry.path, entry.size,
+				file.contents, info.preservePageCache);
+		}
+		fileQueue.Release(entry);
+
+		// Failed reads are passed on unbuffered so errors are reported by the parser
+		const size_t weight(file.contents.length() + 1);
+		bufferQueue.Push(std::move(file), weight);
+	}
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		ReadArchives
+//
+// Description:		Archive stage thread function.  Reads archives from the
+//					configured list until none remain, or until the
+//					deadline passes.  When sharding, each archive belongs to
+//					a single shard.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Pipeline::ReadArchives(void)
+{
+	LineCounter counter(info.commentList, info.blockCommentList, info.continuationList);
+	LineTypeRecorder recorder;
+	if (lineTypeWriter)
+		counter.SetLineTypeRecorder(&recorder);
+
+	std::vector<char> chunk;
+	for (;;)
+	{
+		unsigned int index;
+		{
+			std::lock_guard<std::mutex> lock(directoryMutex);
+			if (nextArchive >= info.archiveList.size())
+				break;
+
+			if (deadline && deadline->HasPassed())
+			{
+				searchStopped = true;
+				break;
+			}
+			index = nextArchive++;
+		}
+
+		if (index % shardCount == shardIndex)
+			ReadArchive(info.archiveList[index], counter, recorder, chunk);
+	}
+
+	std::lock_guard<std::mutex> lock(archiveMutex);
+	PartialResults::Add(counter.GetStatistics(), archiveStatistics);
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		ReadArchive
+//
+// Description:		Reads the matching files from an archive.  Files small
+//					enough to hold in memory are passed to the parse stage;
+//					larger files are parsed here as they are decompressed,
+//					since they can't be read again later.  Files completed by
+//					an earlier run are skipped.  Stops early (leaving the
+//					rest of the archive unsearched, and any large file being
+//					parsed cut short) if the deadline passes.
+//
+// Input Arguments:
+//		archiveName	= const std::string&
+//		counter		= LineCounter&, for files too large to hold in memory
+//		recorder	= const LineTypeRecorder&, the counter's recorder (if
+//					  line types are being written)
+//		chunk		= std::vector<char>&, buffer for those files
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Pipeline::ReadArchive(const std::string &archiveName, LineCounter &counter,
+	const LineTypeRecorder &recorder, std::vector<char> &chunk)
+{
+	ArchiveReader reader;
+	if (!reader.Open(archiveName))
+	{
+		std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+		std::cout << "Archive '" << archiveName << "' could not be opened!  Skipping..." << std::endl;
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+		std::cout << "Entering archive: " << archiveName << std::endl;
+	}
+
+	std::string name;
+	unsigned long long size;
+	while (reader.NextEntry(name, size))
+	{
+		if (deadline && deadline->HasPassed())
+		{
+			searchStopped = true;
+			break;
+		}
+
+		const size_t nameStart(name.find_last_of('/') + 1);
+		if (!Traverser::ExtensionMatches(name.c_str() + nameStart,
+			name.length() - nameStart, extensions) || IsArchiveEntryExcluded(name))
+			continue;
+
+		FileBuffer file;
+		file.entry.path = archiveName + "/" + name;
+		file.entry.size = size;
+		file.entry.device = 0;
+		file.entry.inode = 0;
+		if (journal && !journal->OnFileFound(file.entry.path))
+			continue;
+
+		// Buffered files are classified by the parse stage
+		if (size < maxBufferedFileSize)
+		{
+			file.buffered = true;
+			file.contents.resize(static_cast<size_t>(size));
+			if (size > 0 && reader.Read(&file.contents[0], file.contents.size()) != size)
+				break;
+
+			const size_t weight(file.contents.length() + 1);
+			bufferQueue.Push(std::move(file), weight);
+			continue;
+		}
+
+		chunk.resize(archiveChunkSize);
+		size_t count(reader.Read(chunk.data(), chunk.size()));
+		if (info.skipNonSource)
+		{
+			const ContentClassifier::ContentType type(
+				ContentClassifier::Classify(chunk.data(), count, count == size));
+			if (type != ContentClassifier::ContentSource)
+			{
+				skipCounter.Add(type, size);
+				if (fileHandler)
+					fileHandler->OnFileSkipped(file.entry, type);
+				std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+				std::cout << "  Skipping " << ContentClassifier::GetName(type)
+					<< " file: " << name.substr(nameStart) << std::endl;
+				continue;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+			std::cout << "  Parsing file: " << name.substr(nameStart) << std::endl;
+		}
+
+		const LineCounter::Statistics before(counter.GetStatistics());
+		unsigned long long parsedBytes(0);
+		counter.BeginStream();
+		while (count > 0)
+		{
+			counter.ProcessChunk(chunk.data(), count);
+			parsedBytes += count;
+			if (parsedBytes < size && deadline && deadline->HasPassed())
+			{
+				counter.StopStream(parsedBytes);
+				break;
+			}
+			count = reader.Read(chunk.data(), chunk.size());
+		}
+
+		if (!counter.WasStopped())
+		{
+			counter.EndStream();
+			if (lineTypeWriter)
+				lineTypeWriter->Write(file.entry.path, recorder);
+		}
+
+		if (fileHandler)
+		{
+			const LineCounter::Statistics after(counter.GetStatistics());
+			LineCounter::Statistics fileStatistics;
+			fileStatistics.blankLines = after.blankLines - before.blankLines;
+			fileStatistics.commentLines = after.commentLines - before.commentLines;
+			fileStatistics.codeLines = after.codeLines - before.codeLines;
+			fileStatistics.fileCount = after.fileCount - before.fileCount;
+			if (counter.WasStopped())
+				fileHandler->OnFileCutShort(file.entry, fileStatistics, parsedBytes);
+			else
+				fileHandler->OnFileResult(file.entry, fileStatistics);
+		}
+	}
+
+	if (reader.HasFailed())
+	{
+		std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+		std::cout << "  Problems encountered while reading archive '"
+			<< archiveName << "'" << std::endl;
+	}
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		IsArchiveEntryExcluded
+//
+// Description:		Checks the path of a file within an archive, and each of
+//					the directories containing it, against the exclude
+//					patterns.  (.gitignore files within archives are not
+//					used.)
+//
+// Input Arguments:
+//		name	= const std::string&, path within the archive
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool Pipeline::IsArchiveEntryExcluded(const std::string &name) const
+{
+	if (excludes.GetPatternCount() == 0)
+		return false;
+
+	size_t slash(name.find('/'));
+	while (slash != std::string::npos)
+	{
+		if (excludes.IsExcluded(name.c_str(), name.c_str() + slash, true))
+			return true;
+		slash = name.find('/', slash + 1);
+	}
+
+	return excludes.IsExcluded(name.c_str(), name.c_str() + name.length(), false);
+}
+
+//==========================================================================
+// Class:			Pipeline
+// Function:		IsSource
+//
+// Description:		Checks the start of the file for content which should not
+//					be counted.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the file should be read and parsed (including if
+//		the check fails, so the error is reported by the parser)
+//
+//==========================================================================
+bool Pipeline::IsSource(const std::string &fileName)
+{
+	throttle.Acquire(ContentClassifier::sampleSize);
+
+	std::string head;
+	if (!FileReader::ReadHead(fileName, ContentClassifier::sampleSize,
+		head, info.preservePageCache))
+		return true;
+
+	return ContentClassifier::Classify(head.data(), head.length(),
+		head.length() < ContentClassifier::sampleSize) == ContentClassifier::ContentSource;
+}
@@ -0,0 +1,127 @@
+// File:  pipeline.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Runs the search for files, reading of files and parsing of files as
+//        separate stages, each with its own threads, connected by bounded
+//        queues.  This keeps the disks and processors busy at the same time
+//        while limiting the amount of memory used for file contents.
+
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <istream>
+#include <mutex>
+#include <atomic>
+
+// Local headers
+#include "lineCounter.h"
+#include "lineCounterConfigFile.h"
+#include "fileQueue.h"
+#include "boundedQueue.h"
+#include "pathFilter.h"
+#include "fileIdSet.h"
+#include "fileProcessor.h"
+#include "contentClassifier.h"
+#include "checkpointJournal.h"
+#include "ioThrottle.h"
+#include "deadline.h"
+#include "fileListReader.h"
+
+class Pipeline
+{
+public:
+	Pipeline(const LineCounterInformation &info);
+
+	LineCounter::Statistics Run(void);
+	LineCounter::Statistics Run(const std::vector<FileEntry> &files);// Skips the search
+
+	// Skips the search, counting the files listed in the stream (see
+	// FileListReader) which have matching extensions as they are read
+	LineCounter::Statistics Run(std::istream &fileList, const bool &nulDelimited);
+
+	// Searches for files without reading them
+	std::vector<FileEntry> Scan(void);
+
+	// Receives the statistics for each file as it is parsed
+	void SetFileResultHandler(FileResultHandler *handler) { resultHandler = handler; };
+
+	// Receives the type of each line of each file as it is parsed
+	void SetLineTypeWriter(LineTypeWriter *writer) { lineTypeWriter = writer; };
+
+	// Records completed files and directories, and skips those completed by
+	// an earlier run; results are passed on to the file result handler
+	void SetCheckpointJournal(CheckpointJournal *journal) { this->journal = journal; };
+
+	// Once the deadline has passed, the search stops and files which have
+	// not been parsed are reported to the file result handler as unfinished
+	void SetDeadline(const Deadline *deadline) { this->deadline = deadline; };
+
+	// True if directories or archives were left unsearched because of the
+	// deadline
+	bool WasSearchStopped(void) const { return searchStopped; };
+
+	unsigned int GetPrunedDirectoryCount(void) const { return prunedDirectoryCount; };
+	const ContentClassifier::SkipCounter& GetSkipCounter(void) const { return skipCounter; };
+
+	// Count only one of several shards of the files (see Traverser::SetShard())
+	void SetShard(const unsigned int &index, const unsigned int &count, const bool &bySubtree);
+
+private:
+	static const size_t maxQueuedFiles;
+	static const size_t archiveChunkSize;
+	static const unsigned long long earlyClassifySize;
+
+	const LineCounterInformation &info;
+	const unsigned long long readAheadSize;// [bytes]
+	const unsigned long long parallelParseMinimumSize;// [bytes]
+	unsigned long long maxBufferedFileSize;// [bytes]
+
+	FileQueue fileQueue;
+	BoundedQueue<FileBuffer> bufferQueue;
+
+	PathFilter excludes;
+	FileIdSet visited;
+	std::vector<std::string> extensions;// Lower case
+	ContentClassifier::SkipCounter skipCounter;
+	IoThrottle throttle;
+
+	unsigned int nextDirectory;
+	unsigned int nextArchive;
+	unsigned int prunedDirectoryCount;
+
+	unsigned int shardIndex;
+	unsigned int shardCount;
+	bool shardBySubtree;
+	std::mutex directoryMutex;
+
+	const std::vector<FileEntry> *fileList;
+	FileListReader *fileListReader;
+	FileResultHandler *resultHandler;
+	LineTypeWriter *lineTypeWriter;
+	CheckpointJournal *journal;
+	FileResultHandler *fileHandler;// The journal, if set, otherwise resultHandler
+	const Deadline *deadline;
+	std::atomic<bool> searchStopped;
+
+	std::mutex archiveMutex;
+	LineCounter::Statistics archiveStatistics;// Files too large to buffer
+
+	LineCounter::Statistics RunStages(void (Pipeline::*findFiles)(void),
+		const unsigned int &findThreadCount, const bool &readArchives,
+		const bool &overlapFind);
+
+	void TraverseDirectories(void);
+	void QueueFileList(void);
+	void QueueFileStream(void);
+	void ReadFiles(void);
+	void ReadArchives(void);
+	void ReadArchive(const std::string &archiveName, LineCounter &counter,
+		const LineTypeRecorder &recorder, std::vector<char> &chunk);
+	bool IsArchiveEntryExcluded(const std::string &name) const;
+	bool IsSource(const std::string &fileName);
+};
+
+#endif// PIPELINE_H_
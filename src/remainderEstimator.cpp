@@ -0,0 +1,284 @@
+// File:  remainderEstimator.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Estimates the lines in files which were found but not counted
+//        before the deadline.  The lines per byte of the files which were
+//        counted (or skipped) with the same extension and of similar size
+//        (within a power of two) are applied to the sizes of the unfinished
+//        files, falling back on all files with the same extension, then on
+//        all counted files.
+
+// Standard C++ headers
+#include <cmath>
+
+// Local headers
+#include "remainderEstimator.h"
+#include "sampler.h"
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		RemainderEstimator
+//
+// Description:		Constructor for RemainderEstimator class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+RemainderEstimator::RemainderEstimator()
+{
+	resultHandler = NULL;
+}
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		OnFileResult
+//
+// Description:		Records the size and lines of a counted file.  Called
+//					from the parse threads.
+//
+// Input Arguments:
+//		entry		= const FileEntry&
+//		statistics	= const LineCounter::Statistics&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RemainderEstimator::OnFileResult(const FileEntry &entry,
+	const LineCounter::Statistics &statistics)
+{
+	AddCounted(Sampler::GetStratumKey(entry), &statistics, entry.size);
+	if (resultHandler)
+		resultHandler->OnFileResult(entry, statistics);
+}
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		OnFileSkipped
+//
+// Description:		Records the size of a skipped file.  Skipped files count
+//					as files with no lines, since unfinished files of the
+//					same kind are just as likely to be skipped.
+//
+// Input Arguments:
+//		entry	= const FileEntry&
+//		type	= const ContentClassifier::ContentType&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RemainderEstimator::OnFileSkipped(const FileEntry &entry,
+	const ContentClassifier::ContentType &type)
+{
+	AddCounted(Sampler::GetStratumKey(entry), NULL, entry.size);
+	if (resultHandler)
+		resultHandler->OnFileSkipped(entry, type);
+}
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		OnFileUnfinished
+//
+// Description:		Records the size of a file which was not counted.
+//
+// Input Arguments:
+//		entry	= const FileEntry&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RemainderEstimator::OnFileUnfinished(const FileEntry &entry)
+{
+	AddUnfinished(Sampler::GetStratumKey(entry), entry.size);
+	if (resultHandler)
+		resultHandler->OnFileUnfinished(entry);
+}
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		OnFileCutShort
+//
+// Description:		Records the counted start of a file which was cut short,
+//					and the size of the rest of it.  Both are grouped by the
+//					size of the whole file, so the rest is estimated from
+//					the start when no similar files were completed.
+//
+// Input Arguments:
+//		entry		= const FileEntry&
+//		statistics	= const LineCounter::Statistics&
+//		parsedBytes	= const unsigned long long&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RemainderEstimator::OnFileCutShort(const FileEntry &entry,
+	const LineCounter::Statistics &statistics, const unsigned long long &parsedBytes)
+{
+	const std::string key(Sampler::GetStratumKey(entry));
+	AddCounted(key, &statistics, parsedBytes);
+	AddUnfinished(key, entry.size > parsedBytes ? entry.size - parsedBytes : 0);
+	if (resultHandler)
+		resultHandler->OnFileCutShort(entry, statistics, parsedBytes);
+}
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		AddCounted
+//
+// Description:		Adds a file (or part of one) to the totals for its
+//					extension and size, and to those for its extension.
+//
+// Input Arguments:
+//		key			= const std::string&, from Sampler::GetStratumKey()
+//		statistics	= const LineCounter::Statistics*, NULL for skipped files
+//		bytes		= const unsigned long long&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RemainderEstimator::AddCounted(const std::string &key,
+	const LineCounter::Statistics *statistics, const unsigned long long &bytes)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	Totals *totals[] = {&counted[key], &counted[key.substr(0, key.find('/'))]};
+	unsigned int i;
+	for (i = 0; i < sizeof(totals) / sizeof(totals[0]); i++)
+	{
+		if (statistics)
+			PartialResults::Add(*statistics, totals[i]->statistics);
+		totals[i]->bytes += bytes;
+	}
+}
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		AddUnfinished
+//
+// Description:		Adds a file to the unfinished totals for its extension
+//					and size.
+//
+// Input Arguments:
+//		key		= const std::string&, from Sampler::GetStratumKey()
+//		bytes	= const unsigned long long&, not yet counted
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RemainderEstimator::AddUnfinished(const std::string &key, const unsigned long long &bytes)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	Totals &totals(unfinished[key]);
+	totals.statistics.fileCount++;
+	totals.bytes += bytes;
+}
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		GetEstimate
+//
+// Description:		Estimates the lines in the unfinished files.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		estimate	= Estimate&
+//
+// Return Value:
+//		bool, false if nothing was counted to estimate from
+//
+//==========================================================================
+bool RemainderEstimator::GetEstimate(Estimate &estimate) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// Keys without a slash are the per-extension totals
+	Totals all;
+	std::map<std::string, Totals>::const_iterator it;
+	for (it = counted.begin(); it != counted.end(); ++it)
+	{
+		if (it->first.find('/') != std::string::npos)
+			continue;
+
+		PartialResults::Add(it->second.statistics, all.statistics);
+		all.bytes += it->second.bytes;
+	}
+
+	PartialResults::Clear(estimate.statistics);
+	estimate.bytes = 0;
+	for (it = unfinished.begin(); it != unfinished.end(); ++it)
+	{
+		estimate.statistics.fileCount += it->second.statistics.fileCount;
+		estimate.bytes += it->second.bytes;
+
+		std::map<std::string, Totals>::const_iterator basis(counted.find(it->first));
+		if (basis == counted.end() || basis->second.bytes == 0)
+			basis = counted.find(it->first.substr(0, it->first.find('/')));
+		const Totals &ratio(basis != counted.end() && basis->second.bytes > 0 ? basis->second : all);
+		estimate.statistics.blankLines += Scale(ratio.statistics.blankLines, it->second.bytes, ratio.bytes);
+		estimate.statistics.commentLines += Scale(ratio.statistics.commentLines, it->second.bytes, ratio.bytes);
+		estimate.statistics.codeLines += Scale(ratio.statistics.codeLines, it->second.bytes, ratio.bytes);
+	}
+
+	return all.bytes > 0;
+}
+
+//==========================================================================
+// Class:			RemainderEstimator
+// Function:		Scale
+//
+// Description:		Scales a line count by the ratio of two sizes, rounding
+//					to the nearest line.
+//
+// Input Arguments:
+//		lines			= const unsigned long long&, counted in countedBytes
+//		bytes			= const unsigned long long&
+//		countedBytes	= const unsigned long long&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned long long, lines expected in bytes
+//
+//==========================================================================
+unsigned long long RemainderEstimator::Scale(const unsigned long long &lines,
+	const unsigned long long &bytes, const unsigned long long &countedBytes)
+{
+	if (countedBytes == 0)
+		return 0;
+
+	return static_cast<unsigned long long>(floor(
+		static_cast<double>(lines) * static_cast<double>(bytes)
+		/ static_cast<double>(countedBytes) + 0.5));
+}
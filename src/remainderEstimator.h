@@ -0,0 +1,75 @@
+// File:  remainderEstimator.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Estimates the lines in files which were found but not counted
+//        before the deadline.  The lines per byte of the files which were
+//        counted (or skipped) with the same extension and of similar size
+//        (within a power of two) are applied to the sizes of the unfinished
+//        files, falling back on all files with the same extension, then on
+//        all counted files.
+
+#ifndef REMAINDER_ESTIMATOR_H_
+#define REMAINDER_ESTIMATOR_H_
+
+// Standard C++ headers
+#include <string>
+#include <map>
+#include <mutex>
+
+// Local headers
+#include "lineCounter.h"
+#include "fileQueue.h"
+#include "fileProcessor.h"
+#include "partialResults.h"
+
+class RemainderEstimator : public FileResultHandler
+{
+public:
+	RemainderEstimator();
+
+	// Results are passed on to this handler after they are recorded
+	void SetFileResultHandler(FileResultHandler *handler) { resultHandler = handler; };
+
+	virtual void OnFileResult(const FileEntry &entry,
+		const LineCounter::Statistics &statistics);
+	virtual void OnFileSkipped(const FileEntry &entry,
+		const ContentClassifier::ContentType &type);
+	virtual void OnFileUnfinished(const FileEntry &entry);
+	virtual void OnFileCutShort(const FileEntry &entry,
+		const LineCounter::Statistics &statistics, const unsigned long long &parsedBytes);
+
+	struct Estimate
+	{
+		LineCounter::Statistics statistics;// fileCount is exact
+		unsigned long long bytes;// Exact
+	};
+
+	// Returns false if no files were counted to estimate from (in which case
+	// only the file count and bytes are set)
+	bool GetEstimate(Estimate &estimate) const;
+
+private:
+	FileResultHandler *resultHandler;
+
+	struct Totals
+	{
+		Totals() : bytes(0) { PartialResults::Clear(statistics); };
+
+		LineCounter::Statistics statistics;
+		unsigned long long bytes;
+	};
+
+	mutable std::mutex mutex;
+	// By Sampler::GetStratumKey() and by extension alone (only for counted
+	// files)
+	std::map<std::string, Totals> counted;
+	std::map<std::string, Totals> unfinished;// Only fileCount and bytes are used
+
+	void AddCounted(const std::string &key, const LineCounter::Statistics *statistics,
+		const unsigned long long &bytes);
+	void AddUnfinished(const std::string &key, const unsigned long long &bytes);
+	static unsigned long long Scale(const unsigned long long &lines,
+		const unsigned long long &bytes, const unsigned long long &countedBytes);
+};
+
+#endif// REMAINDER_ESTIMATOR_H_
@@ -0,0 +1,424 @@
+// File:  resultDiff.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Compares two sets of per-file results (see fileResults.h) and
+//        totals the changes by file, directory and extension.  Both sets are
+//        read once, in order of path, and only the largest changes are kept,
+//        so memory use doesn't depend on the number of files.
+
+// Standard C++ headers
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+
+// Local headers
+#include "resultDiff.h"
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		ResultDiff
+//
+// Description:		Constructor for ResultDiff class.
+//
+// Input Arguments:
+//		topCount	= const unsigned int&, number of files and of
+//					  directories to report
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ResultDiff::ResultDiff(const unsigned int &topCount) : topCount(topCount)
+{
+	Reset();
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		Reset
+//
+// Description:		Clears the results of any previous comparison.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ResultDiff::Reset(void)
+{
+	files.clear();
+	directories.clear();
+	extensions.clear();
+	extensionChanges.clear();
+	openDirectories.clear();
+
+	total = MakeChange("total", StatusChanged);
+	addedFileCount = 0;
+	removedFileCount = 0;
+	changedFileCount = 0;
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		Compare
+//
+// Description:		Merges the two sets of results (each sorted by path) and
+//					totals the differences.  Files which are only in the
+//					first set were removed and those only in the second set
+//					were added.
+//
+// Input Arguments:
+//		before	= FileResultReader&
+//		after	= FileResultReader&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool ResultDiff::Compare(FileResultReader &before, FileResultReader &after)
+{
+	Reset();
+
+	std::string beforePath, afterPath;
+	LineCounter::Statistics beforeStatistics, afterStatistics;
+	bool haveBefore(before.Next(beforePath, beforeStatistics));
+	bool haveAfter(after.Next(afterPath, afterStatistics));
+	Change change;
+	while (haveBefore || haveAfter)
+	{
+		if (haveAfter && (!haveBefore || afterPath < beforePath))
+		{
+			change = MakeChange(afterPath, StatusAdded);
+			change.blankLines = afterStatistics.blankLines;
+			change.commentLines = afterStatistics.commentLines;
+			change.codeLines = afterStatistics.codeLines;
+			haveAfter = after.Next(afterPath, afterStatistics);
+		}
+		else if (haveBefore && (!haveAfter || beforePath < afterPath))
+		{
+			change = MakeChange(beforePath, StatusRemoved);
+			change.blankLines = -static_cast<long long>(beforeStatistics.blankLines);
+			change.commentLines = -static_cast<long long>(beforeStatistics.commentLines);
+			change.codeLines = -static_cast<long long>(beforeStatistics.codeLines);
+			haveBefore = before.Next(beforePath, beforeStatistics);
+		}
+		else
+		{
+			change = MakeChange(afterPath, StatusChanged);
+			change.blankLines = static_cast<long long>(afterStatistics.blankLines - beforeStatistics.blankLines);
+			change.commentLines = static_cast<long long>(afterStatistics.commentLines - beforeStatistics.commentLines);
+			change.codeLines = static_cast<long long>(afterStatistics.codeLines - beforeStatistics.codeLines);
+			haveBefore = before.Next(beforePath, beforeStatistics);
+			haveAfter = after.Next(afterPath, afterStatistics);
+		}
+
+		AddFile(change);
+	}
+
+	while (!openDirectories.empty())
+		CloseDirectory();
+
+	std::sort_heap(files.begin(), files.end(), IsLarger);
+	std::sort_heap(directories.begin(), directories.end(), IsLarger);
+
+	std::map<std::string, Change>::const_iterator it;
+	for (it = extensionChanges.begin(); it != extensionChanges.end(); ++it)
+		extensions.push_back(it->second);
+	std::sort(extensions.begin(), extensions.end(), IsLarger);
+
+	return !before.HasFailed() && !after.HasFailed();
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		AddFile
+//
+// Description:		Adds the change to one file to the totals.
+//
+// Input Arguments:
+//		change	= const Change&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ResultDiff::AddFile(const Change &change)
+{
+	if (change.status == StatusAdded)
+		addedFileCount++;
+	else if (change.status == StatusRemoved)
+		removedFileCount++;
+	else if (GetMagnitude(change) > 0)
+		changedFileCount++;
+
+	Add(change, total);
+
+	const std::string extension(GetExtension(change.name));
+	std::map<std::string, Change>::iterator it(extensionChanges.find(extension));
+	if (it == extensionChanges.end())
+		it = extensionChanges.insert(std::make_pair(extension, MakeChange(
+			extension.empty() ? std::string("(none)") : extension, StatusChanged))).first;
+	Add(change, it->second);
+
+	const size_t slash(change.name.find_last_of('/'));
+	EnterDirectory(slash == std::string::npos ? std::string() : change.name.substr(0, slash + 1));
+	Add(change, openDirectories.back().change);
+	openDirectories.back().hasFiles = true;
+
+	if (GetMagnitude(change) > 0)
+		AddTop(change, files);
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		EnterDirectory
+//
+// Description:		Closes the open directories which don't contain the
+//					specified directory, and opens the directory and any of
+//					its parents which aren't already open.
+//
+// Input Arguments:
+//		directory	= const std::string&, ending with a slash (or empty)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ResultDiff::EnterDirectory(const std::string &directory)
+{
+	while (!openDirectories.empty() && directory.compare(0,
+		openDirectories.back().change.name.length(), openDirectories.back().change.name) != 0)
+		CloseDirectory();
+
+	OpenDirectory open;
+	open.hasFiles = false;
+	open.subdirectoryCount = 0;
+	if (openDirectories.empty())
+	{
+		open.change = MakeChange(std::string(), StatusChanged);
+		openDirectories.push_back(open);
+	}
+
+	size_t position(openDirectories.back().change.name.length());
+	size_t slash;
+	while ((slash = directory.find('/', position)) != std::string::npos)
+	{
+		openDirectories.back().subdirectoryCount++;
+		open.change = MakeChange(directory.substr(0, slash + 1), StatusChanged);
+		openDirectories.push_back(open);
+		position = slash + 1;
+	}
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		CloseDirectory
+//
+// Description:		Reports the innermost open directory's total and adds it
+//					to its parent.  Directories with no files and only one
+//					subdirectory (such as the parents of the search
+//					directory) have the same total as the subdirectory, so
+//					they aren't reported.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ResultDiff::CloseDirectory(void)
+{
+	OpenDirectory closed(openDirectories.back());
+	openDirectories.pop_back();
+	if (!openDirectories.empty())
+		Add(closed.change, openDirectories.back().change);
+
+	if ((closed.hasFiles || closed.subdirectoryCount > 1) && GetMagnitude(closed.change) > 0)
+	{
+		if (closed.change.name.empty())
+			closed.change.name = "./";
+		AddTop(closed.change, directories);
+	}
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		AddTop
+//
+// Description:		Keeps the change if it is one of the topCount largest.
+//					The heap's first element is the smallest change kept.
+//
+// Input Arguments:
+//		change	= const Change&
+//
+// Output Arguments:
+//		top		= std::vector<Change>&, heap of the largest changes
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ResultDiff::AddTop(const Change &change, std::vector<Change> &top) const
+{
+	if (top.size() < topCount)
+	{
+		top.push_back(change);
+		std::push_heap(top.begin(), top.end(), IsLarger);
+	}
+	else if (topCount > 0 && IsLarger(change, top.front()))
+	{
+		std::pop_heap(top.begin(), top.end(), IsLarger);
+		top.back() = change;
+		std::push_heap(top.begin(), top.end(), IsLarger);
+	}
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		MakeChange
+//
+// Description:		Creates a change with all counts zero.
+//
+// Input Arguments:
+//		name	= const std::string&
+//		status	= const Status&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Change
+//
+//==========================================================================
+ResultDiff::Change ResultDiff::MakeChange(const std::string &name, const Status &status)
+{
+	Change change;
+	change.name = name;
+	change.status = status;
+	change.blankLines = 0;
+	change.commentLines = 0;
+	change.codeLines = 0;
+	return change;
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		Add
+//
+// Description:		Adds one change to another.
+//
+// Input Arguments:
+//		change	= const Change&
+//
+// Output Arguments:
+//		total	= Change&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ResultDiff::Add(const Change &change, Change &total)
+{
+	total.blankLines += change.blankLines;
+	total.commentLines += change.commentLines;
+	total.codeLines += change.codeLines;
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		GetMagnitude
+//
+// Description:		Returns the size of a change, for ranking changes.
+//
+// Input Arguments:
+//		change	= const Change&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned long long, total number of lines gained or lost
+//
+//==========================================================================
+unsigned long long ResultDiff::GetMagnitude(const Change &change)
+{
+	return std::llabs(change.blankLines) + std::llabs(change.commentLines)
+		+ std::llabs(change.codeLines);
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		IsLarger
+//
+// Description:		Orders changes from largest to smallest (and then by
+//					name, so the order doesn't depend on the input order).
+//
+// Input Arguments:
+//		a	= const Change&
+//		b	= const Change&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if a comes before b
+//
+//==========================================================================
+bool ResultDiff::IsLarger(const Change &a, const Change &b)
+{
+	const unsigned long long magnitudeA(GetMagnitude(a)), magnitudeB(GetMagnitude(b));
+	if (magnitudeA != magnitudeB)
+		return magnitudeA > magnitudeB;
+	return a.name < b.name;
+}
+
+//==========================================================================
+// Class:			ResultDiff
+// Function:		GetExtension
+//
+// Description:		Returns the file's extension, in lower case.
+//
+// Input Arguments:
+//		path	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string, empty if the file name has no extension
+//
+//==========================================================================
+std::string ResultDiff::GetExtension(const std::string &path)
+{
+	const size_t dot(path.find_last_of("./"));
+	if (dot == std::string::npos || path[dot] == '/')
+		return std::string();
+
+	std::string extension(path.substr(dot + 1));
+	unsigned int i;
+	for (i = 0; i < extension.length(); i++)
+		extension[i] = tolower((unsigned char)extension[i]);
+
+	return extension;
+}
@@ -0,0 +1,95 @@
+// File:  resultDiff.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Compares two sets of per-file results (see fileResults.h) and
+//        totals the changes by file, directory and extension.  Both sets are
+//        read once, in order of path, and only the largest changes are kept,
+//        so memory use doesn't depend on the number of files.
+
+#ifndef RESULT_DIFF_H_
+#define RESULT_DIFF_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <map>
+
+// Local headers
+#include "fileResults.h"
+
+class ResultDiff
+{
+public:
+	// Keeps the topCount largest changes to files and to directories
+	explicit ResultDiff(const unsigned int &topCount);
+
+	// Returns false if either set of results can't be read
+	bool Compare(FileResultReader &before, FileResultReader &after);
+
+	enum Status
+	{
+		StatusChanged,
+		StatusAdded,
+		StatusRemoved
+	};
+
+	struct Change
+	{
+		std::string name;
+		Status status;
+		long long blankLines;
+		long long commentLines;
+		long long codeLines;
+	};
+
+	// Largest changes first (by total number of lines changed)
+	const std::vector<Change>& GetFiles(void) const { return files; };
+	const std::vector<Change>& GetDirectories(void) const { return directories; };
+	const std::vector<Change>& GetExtensions(void) const { return extensions; };
+
+	const Change& GetTotal(void) const { return total; };
+
+	unsigned long long GetAddedFileCount(void) const { return addedFileCount; };
+	unsigned long long GetRemovedFileCount(void) const { return removedFileCount; };
+	unsigned long long GetChangedFileCount(void) const { return changedFileCount; };
+
+private:
+	const unsigned int topCount;
+
+	// Heaps of the largest changes, until the comparison is complete
+	std::vector<Change> files;
+	std::vector<Change> directories;
+	std::vector<Change> extensions;
+
+	Change total;
+	std::map<std::string, Change> extensionChanges;
+
+	unsigned long long addedFileCount;
+	unsigned long long removedFileCount;
+	unsigned long long changedFileCount;
+
+	// The directories containing the current file, from the top down.  Paths
+	// are sorted, so each directory's files are contiguous and a directory's
+	// total is complete once a file outside of it is reached.
+	struct OpenDirectory
+	{
+		Change change;// Including subdirectories
+		bool hasFiles;
+		unsigned int subdirectoryCount;
+	};
+	std::vector<OpenDirectory> openDirectories;
+
+	void Reset(void);
+	void AddFile(const Change &change);
+	void EnterDirectory(const std::string &directory);
+	void CloseDirectory(void);
+	void AddTop(const Change &change, std::vector<Change> &top) const;
+
+	static Change MakeChange(const std::string &name, const Status &status);
+	static void Add(const Change &change, Change &total);
+	static unsigned long long GetMagnitude(const Change &change);
+	static bool IsLarger(const Change &a, const Change &b);
+	static std::string GetExtension(const std::string &path);
+};
+
+#endif// RESULT_DIFF_H_
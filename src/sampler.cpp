@@ -0,0 +1,451 @@
+// File:  sampler.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Estimates line counts by parsing a stratified random sample of the
+//        files found by the search.  Files are grouped by extension and by
+//        size (in powers of two), and the totals for each group are
+//        extrapolated from the sizes of all of its files.  The sample is
+//        enlarged until the requested precision is reached.
+
+// Standard C++ headers
+#include <map>
+#include <random>
+#include <algorithm>
+#include <sstream>
+#include <cctype>
+#include <cmath>
+
+// Local headers
+#include "sampler.h"
+
+//==========================================================================
+// Class:			Sampler
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for Sampler class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int Sampler::pilotSize = 4;
+const unsigned int Sampler::maxRounds = 5;
+const double Sampler::z = 1.96;
+
+//==========================================================================
+// Class:			Sampler
+// Function:		Sampler
+//
+// Description:		Constructor for Sampler class.  Sorts the files into
+//					strata and shuffles each stratum.  The random number
+//					generator is always seeded the same way, so repeated
+//					runs over the same files give the same estimate.
+//
+// Input Arguments:
+//		files		= const std::vector<FileEntry>&
+//		maxError	= const double&, fraction of the total number of lines
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Sampler::Sampler(const std::vector<FileEntry> &files, const double &maxError)
+	: maxError(maxError)
+{
+	round = 0;
+
+	std::map<std::string, unsigned int> strataIndices;
+	unsigned int i;
+	for (i = 0; i < files.size(); i++)
+	{
+		const std::string key(GetStratumKey(files[i]));
+		std::map<std::string, unsigned int>::const_iterator it(strataIndices.find(key));
+		if (it == strataIndices.end())
+		{
+			it = strataIndices.insert(std::make_pair(key,
+				static_cast<unsigned int>(strata.size()))).first;
+			strata.push_back(Stratum());
+		}
+
+		strata[it->second].files.push_back(files[i]);
+		strata[it->second].bytes += files[i].size;
+	}
+
+	std::mt19937 generator(12345);
+	for (i = 0; i < strata.size(); i++)
+		std::shuffle(strata[i].files.begin(), strata[i].files.end(), generator);
+}
+
+//==========================================================================
+// Class:			Sampler
+// Function:		NextSample
+//
+// Description:		Chooses the next files to parse.  The first sample
+//					includes a few files from every stratum.  After that,
+//					the variation seen within each stratum is used to decide
+//					how many files are needed from each (Neyman allocation)
+//					to meet the requested precision.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		sample	= std::vector<FileEntry>&
+//
+// Return Value:
+//		bool, false if no more files need to be parsed
+//
+//==========================================================================
+bool Sampler::NextSample(std::vector<FileEntry> &sample)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	sample.clear();
+
+	std::vector<size_t> targets(strata.size());
+	unsigned int i;
+	if (round == 0)
+	{
+		for (i = 0; i < strata.size(); i++)
+			targets[i] = std::min<size_t>(strata[i].files.size(), pilotSize);
+	}
+	else
+	{
+		if (round >= maxRounds)
+			return false;
+
+		std::vector<StratumEstimate> estimates(strata.size());
+		double total(0.0);
+		double variance[CategoryCount] = {};
+		unsigned int c;
+		for (i = 0; i < strata.size(); i++)
+		{
+			estimates[i] = EstimateStratum(strata[i]);
+			for (c = 0; c < CategoryCount; c++)
+			{
+				total += estimates[i].total[c];
+				variance[c] += estimates[i].variance[c];
+			}
+		}
+
+		const double targetVariance(pow(maxError * total / z, 2));
+		bool precise(true);
+		for (c = 0; c < CategoryCount; c++)
+		{
+			if (variance[c] > targetVariance)
+				precise = false;
+		}
+
+		if (precise || total <= 0.0)
+			return false;
+
+		for (i = 0; i < strata.size(); i++)
+			targets[i] = strata[i].sampled;
+
+		for (c = 0; c < CategoryCount; c++)
+		{
+			double weightedDeviation(0.0), weightedVariance(0.0);
+			for (i = 0; i < strata.size(); i++)
+			{
+				const double size(static_cast<double>(strata[i].files.size()));
+				weightedDeviation += size * estimates[i].deviation[c];
+				weightedVariance += size * pow(estimates[i].deviation[c], 2);
+			}
+
+			if (weightedDeviation <= 0.0)
+				continue;
+
+			const double sampleSize(pow(weightedDeviation, 2)
+				/ (targetVariance + weightedVariance));
+			for (i = 0; i < strata.size(); i++)
+			{
+				// Ask for a little more than needed, since the deviations are
+				// only estimates and each extra round has a fixed cost
+				const double size(static_cast<double>(strata[i].files.size()));
+				const size_t target(static_cast<size_t>(ceil(1.1 * sampleSize
+					* size * estimates[i].deviation[c] / weightedDeviation)));
+				targets[i] = std::max(targets[i],
+					std::min(target, strata[i].files.size()));
+			}
+		}
+	}
+
+	for (i = 0; i < strata.size(); i++)
+	{
+		for (; strata[i].sampled < targets[i]; strata[i].sampled++)
+			sample.push_back(strata[i].files[strata[i].sampled]);
+	}
+
+	round++;
+	return !sample.empty();
+}
+
+//==========================================================================
+// Class:			Sampler
+// Function:		OnFileResult
+//
+// Description:		Records the statistics for a sampled file.
+//
+// Input Arguments:
+//		entry		= const FileEntry&
+//		statistics	= const LineCounter::Statistics&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Sampler::OnFileResult(const FileEntry &entry,
+	const LineCounter::Statistics &statistics)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	results[entry.path] = statistics;
+}
+
+//==========================================================================
+// Class:			Sampler
+// Function:		OnFileSkipped
+//
+// Description:		Records a sampled file which was skipped because of its
+//					contents.
+//
+// Input Arguments:
+//		entry	= const FileEntry&
+//		type	= const ContentClassifier::ContentType&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Sampler::OnFileSkipped(const FileEntry &entry,
+	const ContentClassifier::ContentType &/*type*/)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	skipped.insert(entry.path);
+}
+
+//==========================================================================
+// Class:			Sampler
+// Function:		GetEstimate
+//
+// Description:		Returns the estimated totals and their 95% confidence
+//					intervals.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Estimate
+//
+//==========================================================================
+Sampler::Estimate Sampler::GetEstimate(void) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	double total[CategoryCount] = {};
+	double variance[CategoryCount] = {};
+	double fileCount(0.0);
+	Estimate estimate = {};
+
+	unsigned int i, c;
+	size_t j;
+	for (i = 0; i < strata.size(); i++)
+	{
+		const StratumEstimate stratumEstimate(EstimateStratum(strata[i]));
+		for (c = 0; c < CategoryCount; c++)
+		{
+			total[c] += stratumEstimate.total[c];
+			variance[c] += stratumEstimate.variance[c];
+		}
+
+		fileCount += stratumEstimate.fileCount;
+		estimate.sampledFileCount += strata[i].sampled;
+		estimate.totalBytes += strata[i].bytes;
+		for (j = 0; j < strata[i].sampled; j++)
+			estimate.sampledBytes += strata[i].files[j].size;
+	}
+
+	estimate.statistics.fileCount = static_cast<unsigned long long>(floor(fileCount + 0.5));
+	estimate.statistics.blankLines = static_cast<unsigned long long>(floor(total[CategoryBlank] + 0.5));
+	estimate.statistics.commentLines = static_cast<unsigned long long>(floor(total[CategoryComment] + 0.5));
+	estimate.statistics.codeLines = static_cast<unsigned long long>(floor(total[CategoryCode] + 0.5));
+	estimate.margin.blankLines = static_cast<unsigned long long>(ceil(z * sqrt(variance[CategoryBlank])));
+	estimate.margin.commentLines = static_cast<unsigned long long>(ceil(z * sqrt(variance[CategoryComment])));
+	estimate.margin.codeLines = static_cast<unsigned long long>(ceil(z * sqrt(variance[CategoryCode])));
+
+	return estimate;
+}
+
+//==========================================================================
+// Class:			Sampler
+// Function:		EstimateStratum
+//
+// Description:		Estimates the totals for a stratum using the ratio of
+//					lines to bytes in the sampled files.  The variance uses
+//					the residuals about that ratio, with the finite
+//					population correction, so a fully sampled stratum is
+//					exact.  Skipped files add no lines and are not counted
+//					as files; the unsampled files are assumed to be skipped
+//					as often as the sampled ones were, and the residuals of
+//					the skipped files keep the uncertainty in that share in
+//					the variance.  Must be called with the mutex locked.
+//
+// Input Arguments:
+//		stratum	= const Stratum&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		StratumEstimate
+//
+//==========================================================================
+Sampler::StratumEstimate Sampler::EstimateStratum(const Stratum &stratum) const
+{
+	StratumEstimate estimate = {};
+	const size_t n(stratum.sampled);
+	const double populationSize(static_cast<double>(stratum.files.size()));
+	if (n == 0)
+	{
+		estimate.fileCount = populationSize;
+		return estimate;
+	}
+
+	std::vector<LineCounter::Statistics> sampled(n);
+	double sumBytes(0.0);
+	size_t i, counted(0);
+	for (i = 0; i < n; i++)
+	{
+		sumBytes += static_cast<double>(stratum.files[i].size);
+		if (skipped.find(stratum.files[i].path) != skipped.end())
+			continue;// No lines, and not a counted file
+
+		counted++;
+		std::unordered_map<std::string, LineCounter::Statistics>::const_iterator
+			it(results.find(stratum.files[i].path));
+		if (it != results.end())
+			sampled[i] = it->second;
+		else// Not parsed (i.e. could not be read)
+			sampled[i] = LineCounter::Statistics();
+	}
+
+	const double sampleSize(static_cast<double>(n));
+	estimate.fileCount = populationSize * static_cast<double>(counted) / sampleSize;
+
+	unsigned int c;
+	for (c = 0; c < CategoryCount; c++)
+	{
+		double sumLines(0.0);
+		for (i = 0; i < n; i++)
+			sumLines += static_cast<double>(GetCount(sampled[i], static_cast<Category>(c)));
+
+		// Files of zero length (the only kind in a stratum with no bytes)
+		// have no lines, but fall back to the mean per file just in case
+		const bool useRatio(sumBytes > 0.0);
+		const double ratio(useRatio ? sumLines / sumBytes : sumLines / sampleSize);
+		estimate.total[c] = ratio * (useRatio ?
+			static_cast<double>(stratum.bytes) : populationSize);
+
+		double sumSquares(0.0);
+		for (i = 0; i < n; i++)
+		{
+			const double predicted(useRatio ?
+				ratio * static_cast<double>(stratum.files[i].size) : ratio);
+			sumSquares += pow(static_cast<double>(GetCount(
+				sampled[i], static_cast<Category>(c))) - predicted, 2);
+		}
+
+		const double s2(n > 1 ? sumSquares / (sampleSize - 1.0) : 0.0);
+		estimate.deviation[c] = sqrt(s2);
+		estimate.variance[c] = populationSize * populationSize
+			* (1.0 - sampleSize / populationSize) * s2 / sampleSize;
+	}
+
+	return estimate;
+}
+
+//==========================================================================
+// Class:			Sampler
+// Function:		GetCount
+//
+// Description:		Returns the number of lines in the specified category.
+//
+// Input Arguments:
+//		statistics	= const LineCounter::Statistics&
+//		category	= const Category&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned long long
+//
+//==========================================================================
+unsigned long long Sampler::GetCount(const LineCounter::Statistics &statistics,
+	const Category &category)
+{
+	if (category == CategoryBlank)
+		return statistics.blankLines;
+	else if (category == CategoryComment)
+		return statistics.commentLines;
+	return statistics.codeLines;
+}
+
+//==========================================================================
+// Class:			Sampler
+// Function:		GetStratumKey
+//
+// Description:		Returns a string identifying the file's stratum, made up
+//					of its (lower case) extension and the base-two logarithm
+//					of its size.
+//
+// Input Arguments:
+//		entry	= const FileEntry&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string Sampler::GetStratumKey(const FileEntry &entry)
+{
+	const size_t nameStart(entry.path.find_last_of("/\\") + 1);
+	const size_t dot(entry.path.rfind('.'));
+	std::string extension;
+	if (dot != std::string::npos && dot >= nameStart)
+		extension = entry.path.substr(dot + 1);
+
+	std::string::iterator it;
+	for (it = extension.begin(); it != extension.end(); ++it)
+		*it = static_cast<char>(tolower(static_cast<unsigned char>(*it)));
+
+	unsigned int sizeClass(0);
+	unsigned long long size(entry.size);
+	while (size > 0)
+	{
+		sizeClass++;
+		size >>= 1;
+	}
+
+	std::ostringstream ss;
+	ss << extension << '/' << sizeClass;
+	return ss.str();
+}
@@ -0,0 +1,104 @@
+// File:  sampler.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Estimates line counts by parsing a stratified random sample of the
+//        files found by the search.  Files are grouped by extension and by
+//        size (in powers of two), and the totals for each group are
+//        extrapolated from the sizes of all of its files.  The sample is
+//        enlarged until the requested precision is reached.
+
+#ifndef SAMPLER_H_
+#define SAMPLER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+
+// Local headers
+#include "lineCounter.h"
+#include "fileQueue.h"
+#include "fileProcessor.h"
+
+class Sampler : public FileResultHandler
+{
+public:
+	// maxError is the desired half-width of the 95% confidence interval of
+	// each category, as a fraction of the estimated total number of lines
+	Sampler(const std::vector<FileEntry> &files, const double &maxError);
+
+	// Returns the files to parse next, or false when the estimate is
+	// precise enough (or every file has been sampled)
+	bool NextSample(std::vector<FileEntry> &sample);
+
+	virtual void OnFileResult(const FileEntry &entry,
+		const LineCounter::Statistics &statistics);
+
+	// Skipped files are left out of the estimates, like they are left out of
+	// full counts
+	virtual void OnFileSkipped(const FileEntry &entry,
+		const ContentClassifier::ContentType &type);
+
+	struct Estimate
+	{
+		LineCounter::Statistics statistics;// fileCount is exact unless files were skipped
+		LineCounter::Statistics margin;// Half-widths of the confidence intervals
+
+		unsigned long long sampledFileCount;
+		unsigned long long sampledBytes;
+		unsigned long long totalBytes;
+	};
+
+	Estimate GetEstimate(void) const;
+
+	// Groups files by (lower case) extension and size, as
+	// "<extension>/<size class>"
+	static std::string GetStratumKey(const FileEntry &entry);
+
+private:
+	static const unsigned int pilotSize;// Files initially sampled from each stratum
+	static const unsigned int maxRounds;
+	static const double z;// For a 95% confidence interval
+
+	const double maxError;
+	unsigned int round;
+
+	struct Stratum
+	{
+		Stratum() : bytes(0), sampled(0) {};
+
+		std::vector<FileEntry> files;// In random order
+		unsigned long long bytes;
+		size_t sampled;// The first sampled files have been selected
+	};
+
+	std::vector<Stratum> strata;
+
+	mutable std::mutex mutex;
+	std::unordered_map<std::string, LineCounter::Statistics> results;
+	std::unordered_set<std::string> skipped;
+
+	enum Category
+	{
+		CategoryBlank,
+		CategoryComment,
+		CategoryCode,
+		CategoryCount
+	};
+
+	struct StratumEstimate
+	{
+		double total[CategoryCount];
+		double variance[CategoryCount];// Of the total
+		double deviation[CategoryCount];// Per file, for allocating the sample
+		double fileCount;// Excluding skipped files
+	};
+
+	StratumEstimate EstimateStratum(const Stratum &stratum) const;
+	static unsigned long long GetCount(const LineCounter::Statistics &statistics,
+		const Category &category);
+};
+
+#endif// SAMPLER_H_
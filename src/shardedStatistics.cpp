@@ -0,0 +1,142 @@
+// File:  shardedStatistics.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Line count statistics kept in separate cache lines for each worker
+//        thread.  Each shard is updated by a single thread and can be read
+//        by any thread without locking, using a sequence lock to obtain a
+//        consistent snapshot while updates are in progress.
+
+// Local headers
+#include "shardedStatistics.h"
+#include "partialResults.h"
+
+//==========================================================================
+// Class:			ShardedStatistics
+// Function:		ShardedStatistics
+//
+// Description:		Constructor for ShardedStatistics class.
+//
+// Input Arguments:
+//		shardCount	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ShardedStatistics::ShardedStatistics(const unsigned int &shardCount)
+	: shards(shardCount)
+{
+	unsigned int i;
+	for (i = 0; i < shards.size(); i++)
+	{
+		Counters &c(shards[i].counters);
+		c.sequence.store(0, std::memory_order_relaxed);
+		c.blankLines.store(0, std::memory_order_relaxed);
+		c.commentLines.store(0, std::memory_order_relaxed);
+		c.codeLines.store(0, std::memory_order_relaxed);
+		c.fileCount.store(0, std::memory_order_relaxed);
+	}
+}
+
+//==========================================================================
+// Class:			ShardedStatistics
+// Function:		Publish
+//
+// Description:		Replaces the statistics for the specified shard.  Only
+//					the thread which owns the shard may call this.
+//
+// Input Arguments:
+//		shard		= const unsigned int&
+//		statistics	= const LineCounter::Statistics&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ShardedStatistics::Publish(const unsigned int &shard,
+	const LineCounter::Statistics &statistics)
+{
+	Counters &c(shards[shard].counters);
+	const unsigned int sequence(c.sequence.load(std::memory_order_relaxed));
+	c.sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	c.blankLines.store(statistics.blankLines, std::memory_order_relaxed);
+	c.commentLines.store(statistics.commentLines, std::memory_order_relaxed);
+	c.codeLines.store(statistics.codeLines, std::memory_order_relaxed);
+	c.fileCount.store(statistics.fileCount, std::memory_order_relaxed);
+
+	c.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+//==========================================================================
+// Class:			ShardedStatistics
+// Function:		Read
+//
+// Description:		Returns the statistics for the specified shard.  If the
+//					owning thread is part way through an update, tries again
+//					so that the counts are consistent with each other.
+//
+// Input Arguments:
+//		shard	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounter::Statistics
+//
+//==========================================================================
+LineCounter::Statistics ShardedStatistics::Read(const unsigned int &shard) const
+{
+	const Counters &c(shards[shard].counters);
+	LineCounter::Statistics statistics;
+	unsigned int before, after;
+	do
+	{
+		before = c.sequence.load(std::memory_order_acquire);
+		statistics.blankLines = c.blankLines.load(std::memory_order_relaxed);
+		statistics.commentLines = c.commentLines.load(std::memory_order_relaxed);
+		statistics.codeLines = c.codeLines.load(std::memory_order_relaxed);
+		statistics.fileCount = c.fileCount.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		after = c.sequence.load(std::memory_order_relaxed);
+	} while ((before & 1) != 0 || before != after);
+
+	return statistics;
+}
+
+//==========================================================================
+// Class:			ShardedStatistics
+// Function:		Snapshot
+//
+// Description:		Returns the sum of the statistics of all shards.  Each
+//					shard's contribution is internally consistent.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		LineCounter::Statistics
+//
+//==========================================================================
+LineCounter::Statistics ShardedStatistics::Snapshot(void) const
+{
+	LineCounter::Statistics total;
+	PartialResults::Clear(total);
+
+	unsigned int i;
+	for (i = 0; i < shards.size(); i++)
+		PartialResults::Add(Read(i), total);
+
+	return total;
+}
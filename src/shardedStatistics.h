@@ -0,0 +1,56 @@
+// File:  shardedStatistics.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Line count statistics kept in separate cache lines for each worker
+//        thread.  Each shard is updated by a single thread and can be read
+//        by any thread without locking, using a sequence lock to obtain a
+//        consistent snapshot while updates are in progress.
+
+#ifndef SHARDED_STATISTICS_H_
+#define SHARDED_STATISTICS_H_
+
+// Standard C++ headers
+#include <vector>
+#include <atomic>
+
+// Local headers
+#include "lineCounter.h"
+
+class ShardedStatistics
+{
+public:
+	ShardedStatistics(const unsigned int &shardCount);
+
+	// Replaces the shard's statistics; only one thread may publish to each shard
+	void Publish(const unsigned int &shard, const LineCounter::Statistics &statistics);
+
+	// May be called from any thread at any time
+	LineCounter::Statistics Read(const unsigned int &shard) const;
+	LineCounter::Statistics Snapshot(void) const;// Sum of all shards
+
+	unsigned int GetShardCount(void) const { return static_cast<unsigned int>(shards.size()); };
+
+private:
+	static const size_t cacheLineSize = 64;
+
+	struct Counters
+	{
+		std::atomic<unsigned int> sequence;// Odd while an update is in progress
+		std::atomic<unsigned long long> blankLines;
+		std::atomic<unsigned long long> commentLines;
+		std::atomic<unsigned long long> codeLines;
+		std::atomic<unsigned long long> fileCount;
+	};
+
+	// Padded to two cache lines, so the counters of neighboring shards never
+	// share a cache line, however the vector's storage happens to be aligned
+	struct Shard
+	{
+		Counters counters;
+		char padding[2 * cacheLineSize - sizeof(Counters)];
+	};
+
+	std::vector<Shard> shards;
+};
+
+#endif// SHARDED_STATISTICS_H_
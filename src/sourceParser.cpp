@@ -4,12 +4,12 @@
 // Desc:  Parses source code.
 
 // Standard C++ headers
-#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 
 // Local headers
 #include "sourceParser.h"
-#include "stringTrimmer.h"
 
 //==========================================================================
 // Class:			SourceParser
@@ -36,6 +36,21 @@ SourceParser::SourceParser(const std::vector<std::string> &commentIndicators,
 	blockCommentIndicators(blockCommentIndicators),
 	continuationIndicators(continuationIndicators)
 {
+	memset(isTokenStart, 0, sizeof(isTokenStart));
+
+	unsigned int i;
+	for (i = 0; i < commentIndicators.size(); i++)
+	{
+		if (!commentIndicators[i].empty())
+			isTokenStart[(unsigned char)commentIndicators[i][0]] = true;
+	}
+
+	for (i = 0; i < blockCommentIndicators.size(); i++)
+	{
+		if (!blockCommentIndicators[i].first.empty())
+			isTokenStart[(unsigned char)blockCommentIndicators[i].first[0]] = true;
+	}
+
 	Reset();
 }
 
@@ -46,7 +61,7 @@ SourceParser::SourceParser(const std::vector<std::string> &commentIndicators,
 // Description:		Parses the specified line.
 //
 // Input Arguments:
-//		line	= std::string
+//		line	= const std::string&
 //
 // Output Arguments:
 //		None
@@ -55,81 +70,95 @@ SourceParser::SourceParser(const std::vector<std::string> &commentIndicators,
 //		SourceParser::PositionState
 //
 //==========================================================================
-SourceParser::PositionState SourceParser::ParseLine(std::string line)
+SourceParser::PositionState SourceParser::ParseLine(const std::string &line)
+{
+	return ParseLine(line.data(), line.data() + line.length());
+}
+
+//==========================================================================
+// Class:			SourceParser
+// Function:		ParseLine
+//
+// Description:		Parses the line contained in the specified range.  Each
+//					character is visited at most once (plus a constant number
+//					of token comparisons), so the time required is linear in
+//					the length of the line and no memory is allocated.
+//
+// Input Arguments:
+//		begin	= const char*, first character of the line
+//		end		= const char*, one past the last character of the line
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		SourceParser::PositionState
+//
+//==========================================================================
+SourceParser::PositionState SourceParser::ParseLine(const char *begin, const char *end)
 {
 	// Only left trim so we don't get the line continuation stuff wrong
-	line = StringTrimmer::LeftTrim(line);
+	const char *position(SkipWhitespace(begin, end));
+	if (position == end)
+	{
+		// Blank lines do not close block comments
+		if (state != PositionBlockComment)
+			state = PositionWhitespace;
+		return PositionWhitespace;
+	}
 
-	size_t location;
-	switch (state)
+	if (state == PositionContinuingComment)
 	{
-	case PositionBlockComment:
-		if (line.empty())
-			return PositionWhitespace;
-		else if ((location = LineContainsString(line, blockEndIndicator)) != std::string::npos)
-		{
+		if (!LineEndsWithContinuation(position, end))
 			state = PositionComment;
-			line = StringTrimmer::LeftTrim(line.substr(location));
-			if (!line.empty())
-			{
-				if (ParseLine(line) == PositionCode)
-					return PositionCode;
-			}
-		}
-		// No change to state - stay in the comment
-		break;
+		return state;
+	}
 
-	case PositionContinuingComment:
-		if (line.empty())
-			state = PositionWhitespace;
-		else if (!LineEndsWithContinuation(line))
-			state = PositionComment;
-		break;
+	bool foundCode(false);
+	while (position != end)
+	{
+		if (state == PositionBlockComment)
+		{
+			const std::string &endIndicator(blockCommentIndicators[blockCommentIndex].second);
+			position = FindString(position, end, endIndicator);
+			if (position == end)
+				break;// Comment continues onto the next line
 
-	case PositionComment:
-	case PositionCode:
-	case PositionWhitespace:
-		if (line.empty())
-			state = PositionWhitespace;
-		else if (LineStartsWithSingleLineComment(line))
+			position = SkipWhitespace(position + endIndicator.length(), end);
+			state = PositionComment;
+		}
+		else if (!isTokenStart[(unsigned char)*position])
 		{
-			if (LineEndsWithContinuation(line))
+			foundCode = true;
+			position++;
+		}
+		else if (StartsWithSingleLineComment(position, end))
+		{
+			// Whatever appears first wins, so block comment starts following
+			// a single-line comment indicator are ignored
+			if (LineEndsWithContinuation(position, end))
 				state = PositionContinuingComment;
 			else
 				state = PositionComment;
+			break;
 		}
-		else if ((location = LineStartsWithBlockCommentStart(line, blockEndIndicator)) != std::string::npos)
+		else if (StartsWithBlockCommentStart(position, end, blockCommentIndex))
 		{
+			position += blockCommentIndicators[blockCommentIndex].first.length();
 			state = PositionBlockComment;
-			line = line.substr(location);
-			if (!line.empty())
-			{
-				if (ParseLine(line) == PositionCode)
-					return PositionCode;
-			}
 		}
 		else
 		{
-			if ((location = LineContainsBlockCommentStart(line, blockEndIndicator)) != std::string::npos)
-			{
-				state = PositionBlockComment;
-				line = StringTrimmer::LeftTrim(line.substr(location));
-				ParseLine(line);
-				return PositionCode;
-			}
-			else if (LineContainsSingleLineComment(line) &&
-				LineEndsWithContinuation(line))
-			{
-				state = PositionContinuingComment;
-				return PositionCode;
-			}
-			state = PositionCode;
+			foundCode = true;
+			position++;
 		}
+	}
 
-		break;
-
-	default:
-		assert(false);
+	if (foundCode)
+	{
+		if (state != PositionBlockComment && state != PositionContinuingComment)
+			state = PositionCode;
+		return PositionCode;
 	}
 
 	return state;
@@ -137,13 +166,38 @@ SourceParser::PositionState SourceParser::ParseLine(std::string line)
 
 //==========================================================================
 // Class:			SourceParser
-// Function:		LineStartsWithSingleLineComment
+// Function:		SetState
 //
-// Description:		Determines if the line starts with a single-line comment
-//					indicator.
+// Description:		Sets the parser state, as if the previous line had left
+//					the parser in the specified state.
 //
 // Input Arguments:
-//		line	= const std::string&
+//		state				= const PositionState&
+//		blockCommentIndex	= const size_t&, index of the open block comment's
+//							  indicators (used only for PositionBlockComment)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SourceParser::SetState(const PositionState &state, const size_t &blockCommentIndex)
+{
+	assert(state != PositionBlockComment || blockCommentIndex < blockCommentIndicators.size());
+	this->state = state;
+	this->blockCommentIndex = blockCommentIndex;
+}
+
+//==========================================================================
+// Class:			SourceParser
+// Function:		IsWhitespace
+//
+// Description:		Determines if the specified character is whitespace.
+//
+// Input Arguments:
+//		c	= const char&
 //
 // Output Arguments:
 //		None
@@ -152,54 +206,102 @@ SourceParser::PositionState SourceParser::ParseLine(std::string line)
 //		bool
 //
 //==========================================================================
-bool SourceParser::LineStartsWithSingleLineComment(const std::string &line) const
+bool SourceParser::IsWhitespace(const char &c)
 {
-	unsigned int i;
-	for (i = 0; i < commentIndicators.size(); i++)
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+//==========================================================================
+// Class:			SourceParser
+// Function:		SkipWhitespace
+//
+// Description:		Returns a pointer to the first non-whitespace character
+//					in the specified range.  Unicode spaces (UTF-8 encoded)
+//					are only checked for when a non-ASCII byte is found.
+//
+// Input Arguments:
+//		begin	= const char*
+//		end		= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const char*, equal to end if the range is all whitespace
+//
+//==========================================================================
+const char* SourceParser::SkipWhitespace(const char *begin, const char *end)
+{
+	while (begin != end)
 	{
-		if (line.find(commentIndicators[i]) == 0)
-			return true;
+		if (IsWhitespace(*begin))
+			begin++;
+		else if ((unsigned char)*begin >= 0xc2)
+		{
+			const size_t length(UnicodeWhitespaceLength(begin, end));
+			if (length == 0)
+				break;
+			begin += length;
+		}
+		else
+			break;
 	}
 
-	return false;
+	return begin;
 }
 
 //==========================================================================
 // Class:			SourceParser
-// Function:		LineContainsSingleLineComment
+// Function:		UnicodeWhitespaceLength
 //
-// Description:		Determines if the line contains a single-line comment indicator.
+// Description:		Checks for a UTF-8 encoded Unicode space character
+//					(no-break spaces, the typographic spaces, line and
+//					paragraph separators and the byte order mark).
 //
 // Input Arguments:
-//		line	= const std::string&
+//		begin	= const char*
+//		end		= const char*
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		bool
+//		size_t, length of the character in bytes, or zero if the range does
+//		not start with a space character
 //
 //==========================================================================
-bool SourceParser::LineContainsSingleLineComment(const std::string &line) const
+size_t SourceParser::UnicodeWhitespaceLength(const char *begin, const char *end)
 {
-	unsigned int i;
-	for (i = 0; i < commentIndicators.size(); i++)
-	{
-		if (line.find(commentIndicators[i]) != std::string::npos)
-			return true;
-	}
+	const unsigned char *c(reinterpret_cast<const unsigned char*>(begin));
+	const ptrdiff_t length(end - begin);
+	if (length >= 2 && c[0] == 0xc2 && (c[1] == 0xa0 || c[1] == 0x85))// U+00A0, U+0085
+		return 2;
+	else if (length < 3)
+		return 0;
 
-	return false;
+	if (c[0] == 0xe2 && c[1] == 0x80 &&
+		((c[2] >= 0x80 && c[2] <= 0x8a) || c[2] == 0xa8 || c[2] == 0xa9 || c[2] == 0xaf))// U+2000-U+200A, U+2028, U+2029, U+202F
+		return 3;
+	else if ((c[0] == 0xe2 && c[1] == 0x81 && c[2] == 0x9f) ||// U+205F
+		(c[0] == 0xe3 && c[1] == 0x80 && c[2] == 0x80) ||// U+3000
+		(c[0] == 0xe1 && c[1] == 0x9a && c[2] == 0x80) ||// U+1680
+		(c[0] == 0xef && c[1] == 0xbb && c[2] == 0xbf))// U+FEFF
+		return 3;
+
+	return 0;
 }
 
 //==========================================================================
 // Class:			SourceParser
-// Function:		LineEndsWithContinuation
+// Function:		StartsWith
 //
-// Description:		Determines if the line ends with a line continuation indicator.
+// Description:		Determines if the specified range starts with the
+//					specified (non-empty) string.
 //
 // Input Arguments:
-//		line	= const std::string&
+//		begin	= const char*
+//		end		= const char*
+//		s		= const std::string&
 //
 // Output Arguments:
 //		None
@@ -208,115 +310,143 @@ bool SourceParser::LineContainsSingleLineComment(const std::string &line) const
 //		bool
 //
 //==========================================================================
-bool SourceParser::LineEndsWithContinuation(const std::string &line) const
+bool SourceParser::StartsWith(const char *begin, const char *end, const std::string &s)
 {
-	unsigned int i;
-	for (i = 0; i < continuationIndicators.size(); i++)
-	{
-		if (line.find(continuationIndicators[i]) ==
-			line.length() - continuationIndicators[i].length())
-			return true;
-	}
+	if (s.empty() || (size_t)(end - begin) < s.length())
+		return false;
 
-	return false;
+	return memcmp(begin, s.data(), s.length()) == 0;
 }
 
 //==========================================================================
 // Class:			SourceParser
-// Function:		LineStartsWithBlockCommentStart
+// Function:		FindString
 //
-// Description:		Determines if the line starts with a block comment start
-//					indicator.
+// Description:		Finds the first occurrence of the specified string within
+//					the specified range.
 //
 // Input Arguments:
-//		line	= const std::string&
+//		begin	= const char*
+//		end		= const char*
+//		s		= const std::string&
 //
 // Output Arguments:
-//		matchingEndIndicator	= std::string&, if true, contains the string
-//								  indicating the end of the comment section
+//		None
 //
 // Return Value:
-//		size_t, indicating of position of last character of indicator string
+//		const char*, pointing to the start of the match, or end if not found
 //
 //==========================================================================
-size_t SourceParser::LineStartsWithBlockCommentStart(const std::string &line,
-	std::string& matchingEndIndicator) const
+const char* SourceParser::FindString(const char *begin, const char *end, const std::string &s)
 {
-	unsigned int i;
-	for (i = 0; i < blockCommentIndicators.size(); i++)
+	if (s.empty())
+		return begin;
+
+	while ((size_t)(end - begin) >= s.length())
 	{
-		if (line.find(blockCommentIndicators[i].first) == 0)
-		{
-			matchingEndIndicator = blockCommentIndicators[i].second;
-			return blockCommentIndicators[i].first.length();
-		}
+		begin = static_cast<const char*>(memchr(begin, s[0], end - begin - s.length() + 1));
+		if (!begin)
+			return end;
+		else if (memcmp(begin + 1, s.data() + 1, s.length() - 1) == 0)
+			return begin;
+		begin++;
 	}
 
-	return std::string::npos;
+	return end;
 }
 
 //==========================================================================
 // Class:			SourceParser
-// Function:		LineContainsString
+// Function:		StartsWithSingleLineComment
 //
-// Description:		Determines if the line contains the specified string.
+// Description:		Determines if the range starts with a single-line comment
+//					indicator.
 //
 // Input Arguments:
-//		line	= const std::string&
-//		s		= const std::string&
+//		begin	= const char*
+//		end		= const char*
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		size_t, indicating of position of last character of indicator string
+//		bool
 //
 //==========================================================================
-size_t SourceParser::LineContainsString(const std::string &line,
-	const std::string &s) const
+bool SourceParser::StartsWithSingleLineComment(const char *begin, const char *end) const
 {
-	size_t location = line.find(s);
-	if (location == std::string::npos)
-		return location;
+	unsigned int i;
+	for (i = 0; i < commentIndicators.size(); i++)
+	{
+		if (StartsWith(begin, end, commentIndicators[i]))
+			return true;
+	}
 
-	return line.find(s) + s.length();
+	return false;
 }
 
 //==========================================================================
 // Class:			SourceParser
-// Function:		LineContainsBlockCommentStart
+// Function:		StartsWithBlockCommentStart
 //
-// Description:		Determines if the line contains a block comment start indicator.
+// Description:		Determines if the range starts with a block comment start
+//					indicator.
 //
 // Input Arguments:
-//		line	= const std::string&
+//		begin	= const char*
+//		end		= const char*
 //
 // Output Arguments:
-//		matchingEndIndicator	= std::string&, if true, contains the string
-//								  indicating the end of the comment section
+//		index	= size_t&, if true, contains the index of the matching
+//				  block comment indicator pair
 //
 // Return Value:
-//		size_t, indicating of position of last character of indicator string
+//		bool
 //
 //==========================================================================
-size_t SourceParser::LineContainsBlockCommentStart(const std::string &line,
-	std::string& matchingEndIndicator) const
+bool SourceParser::StartsWithBlockCommentStart(const char *begin,
+	const char *end, size_t &index) const
 {
-	size_t location;
 	unsigned int i;
-	std::vector<std::pair<size_t, std::string> > endOfSequences;
 	for (i = 0; i < blockCommentIndicators.size(); i++)
 	{
-		if ((location = LineContainsString(line, blockCommentIndicators[i].first)) != std::string::npos)
+		if (StartsWith(begin, end, blockCommentIndicators[i].first))
 		{
-			endOfSequences.push_back(std::make_pair(location, blockCommentIndicators[i].second));
+			index = i;
+			return true;
 		}
 	}
 
-	if (endOfSequences.size() == 0)
-		return std::string::npos;
+	return false;
+}
+
+//==========================================================================
+// Class:			SourceParser
+// Function:		LineEndsWithContinuation
+//
+// Description:		Determines if the range ends with a line continuation indicator.
+//
+// Input Arguments:
+//		begin	= const char*
+//		end		= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool SourceParser::LineEndsWithContinuation(const char *begin, const char *end) const
+{
+	unsigned int i;
+	for (i = 0; i < continuationIndicators.size(); i++)
+	{
+		const std::string &indicator(continuationIndicators[i]);
+		if (!indicator.empty() && (size_t)(end - begin) >= indicator.length() &&
+			memcmp(end - indicator.length(), indicator.data(), indicator.length()) == 0)
+			return true;
+	}
 
-	std::pair<size_t, std::string> firstMatch = *std::min_element(endOfSequences.begin(), endOfSequences.end());
-	matchingEndIndicator = firstMatch.second;
-	return firstMatch.first;
-}
\ No newline at end of file
+	return false;
+}
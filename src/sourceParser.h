@@ -27,8 +27,15 @@ public:
 		PositionBlockComment
 	};
 
-	void Reset(void) { state = PositionCode; };// Reset prior to parsing a new file
-	PositionState ParseLine(std::string line);
+	void Reset(void) { state = PositionCode; blockCommentIndex = 0; };// Reset prior to parsing a new file
+	PositionState ParseLine(const std::string &line);
+	PositionState ParseLine(const char *begin, const char *end);
+
+	// For resuming parsing part way through a file
+	PositionState GetState(void) const { return state; };
+	size_t GetBlockCommentIndex(void) const { return blockCommentIndex; };
+	void SetState(const PositionState &state, const size_t &blockCommentIndex = 0);
+	size_t GetBlockCommentIndicatorCount(void) const { return blockCommentIndicators.size(); };
 
 private:
 	const std::vector<std::string> commentIndicators;
@@ -36,14 +43,21 @@ private:
 	const std::vector<std::string> continuationIndicators;
 
 	PositionState state;
-	std::string blockEndIndicator;
-
-	bool LineStartsWithSingleLineComment(const std::string &line) const;
-	bool LineContainsSingleLineComment(const std::string &line) const;
-	bool LineEndsWithContinuation(const std::string &line) const;
-	size_t LineStartsWithBlockCommentStart(const std::string &line, std::string& matchingEndIndicator) const;
-	size_t LineContainsString(const std::string &line, const std::string &s) const;
-	size_t LineContainsBlockCommentStart(const std::string &line, std::string& matchingEndIndicator) const;
+	size_t blockCommentIndex;// Index of the open block comment's indicators
+
+	// Lookup table of first characters of the comment and block comment start
+	// tokens, so most characters can be rejected without comparing strings
+	bool isTokenStart[256];
+
+	static bool IsWhitespace(const char &c);
+	static const char* SkipWhitespace(const char *begin, const char *end);
+	static size_t UnicodeWhitespaceLength(const char *begin, const char *end);
+	static bool StartsWith(const char *begin, const char *end, const std::string &s);
+	static const char* FindString(const char *begin, const char *end, const std::string &s);
+
+	bool StartsWithSingleLineComment(const char *begin, const char *end) const;
+	bool StartsWithBlockCommentStart(const char *begin, const char *end, size_t &index) const;
+	bool LineEndsWithContinuation(const char *begin, const char *end) const;
 };
 
 #endif// SOURCE_PARSER_H_
@@ -0,0 +1,280 @@
+// File:  textDecoder.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Detects the encoding of text from its byte order mark, and converts
+//        UTF-16 text to UTF-8 so it can be parsed like any other file.  Text
+//        may be converted in pieces of any size.
+
+// Standard C++ headers
+#include <cstring>
+#include <stdint.h>
+
+// Local headers
+#include "textDecoder.h"
+
+//==========================================================================
+// Class:			TextDecoder
+// Function:		DetectEncoding
+//
+// Description:		Determines the encoding from the byte order mark at the
+//					start of the text.
+//
+// Input Arguments:
+//		data	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		bomLength	= size_t&, in bytes
+//
+// Return Value:
+//		Encoding
+//
+//==========================================================================
+TextDecoder::Encoding TextDecoder::DetectEncoding(const char *data,
+	const size_t &length, size_t &bomLength)
+{
+	const unsigned char *bytes(reinterpret_cast<const unsigned char*>(data));
+	if (length >= 3 && bytes[0] == 0xef && bytes[1] == 0xbb && bytes[2] == 0xbf)
+	{
+		bomLength = 3;
+		return EncodingUtf8;
+	}
+	else if (length >= 2 && bytes[0] == 0xff && bytes[1] == 0xfe)
+	{
+		bomLength = 2;
+		return EncodingUtf16LittleEndian;
+	}
+	else if (length >= 2 && bytes[0] == 0xfe && bytes[1] == 0xff)
+	{
+		bomLength = 2;
+		return EncodingUtf16BigEndian;
+	}
+
+	bomLength = 0;
+	return EncodingUtf8;
+}
+
+//==========================================================================
+// Class:			TextDecoder
+// Function:		TextDecoder
+//
+// Description:		Constructor for TextDecoder class.
+//
+// Input Arguments:
+//		encoding	= const Encoding&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+TextDecoder::TextDecoder(const Encoding &encoding)
+{
+	Reset(encoding);
+}
+
+//==========================================================================
+// Class:			TextDecoder
+// Function:		Reset
+//
+// Description:		Prepares to decode new text.
+//
+// Input Arguments:
+//		encoding	= const Encoding&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TextDecoder::Reset(const Encoding &encoding)
+{
+	this->encoding = encoding;
+	hasPendingByte = false;
+	pendingByte = 0;
+	pendingHighSurrogate = 0;
+}
+
+//==========================================================================
+// Class:			TextDecoder
+// Function:		Decode
+//
+// Description:		Converts the next piece of text to UTF-8.  Runs of ASCII
+//					characters are converted four at a time.
+//
+// Input Arguments:
+//		data	= const char*
+//		length	= const size_t&
+//
+// Output Arguments:
+//		output	= std::string&, the converted text is appended
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TextDecoder::Decode(const char *data, const size_t &length, std::string &output)
+{
+	if (encoding == EncodingUtf8)
+	{
+		output.append(data, length);
+		return;
+	}
+
+	const unsigned char *p(reinterpret_cast<const unsigned char*>(data));
+	const unsigned char *end(p + length);
+	const bool littleEndian(encoding == EncodingUtf16LittleEndian);
+
+	if (hasPendingByte && p != end)
+	{
+		DecodeUnit(littleEndian ? (pendingByte | (*p << 8)) : ((pendingByte << 8) | *p), output);
+		hasPendingByte = false;
+		p++;
+	}
+
+	// Mask which is zero for four ASCII code units (in memory order, so it
+	// doesn't depend on the processor's byte order)
+	static const unsigned char littleEndianBytes[8] = { 0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff };
+	static const unsigned char bigEndianBytes[8] = { 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80 };
+	uint64_t asciiMask;
+	memcpy(&asciiMask, littleEndian ? littleEndianBytes : bigEndianBytes, sizeof(asciiMask));
+	const size_t offset(littleEndian ? 0 : 1);
+
+	output.reserve(output.size() + length / 2);
+	while (end - p >= 2)
+	{
+		if (end - p >= 8 && pendingHighSurrogate == 0)
+		{
+			uint64_t word;
+			memcpy(&word, p, sizeof(word));
+			if ((word & asciiMask) == 0)
+			{
+				const char ascii[4] = { static_cast<char>(p[offset]), static_cast<char>(p[offset + 2]),
+					static_cast<char>(p[offset + 4]), static_cast<char>(p[offset + 6]) };
+				output.append(ascii, sizeof(ascii));
+				p += 8;
+				continue;
+			}
+		}
+
+		DecodeUnit(littleEndian ? (p[0] | (p[1] << 8)) : ((p[0] << 8) | p[1]), output);
+		p += 2;
+	}
+
+	if (p != end)
+	{
+		pendingByte = *p;
+		hasPendingByte = true;
+	}
+}
+
+//==========================================================================
+// Class:			TextDecoder
+// Function:		Finish
+//
+// Description:		Completes decoding.  Any incomplete character is replaced
+//					with U+FFFD.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		output	= std::string&, the converted text is appended
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TextDecoder::Finish(std::string &output)
+{
+	if (pendingHighSurrogate != 0 || hasPendingByte)
+		AppendCodePoint(0xfffd, output);
+
+	pendingHighSurrogate = 0;
+	hasPendingByte = false;
+}
+
+//==========================================================================
+// Class:			TextDecoder
+// Function:		DecodeUnit
+//
+// Description:		Converts a single UTF-16 code unit, combining surrogate
+//					pairs.  Unpaired surrogates become U+FFFD.
+//
+// Input Arguments:
+//		unit	= const unsigned int&
+//
+// Output Arguments:
+//		output	= std::string&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TextDecoder::DecodeUnit(const unsigned int &unit, std::string &output)
+{
+	if (pendingHighSurrogate != 0)
+	{
+		if (unit >= 0xdc00 && unit <= 0xdfff)
+		{
+			AppendCodePoint(0x10000 + ((pendingHighSurrogate - 0xd800) << 10)
+				+ (unit - 0xdc00), output);
+			pendingHighSurrogate = 0;
+			return;
+		}
+
+		AppendCodePoint(0xfffd, output);
+		pendingHighSurrogate = 0;
+	}
+
+	if (unit >= 0xd800 && unit <= 0xdbff)
+		pendingHighSurrogate = unit;
+	else if (unit >= 0xdc00 && unit <= 0xdfff)
+		AppendCodePoint(0xfffd, output);
+	else
+		AppendCodePoint(unit, output);
+}
+
+//==========================================================================
+// Class:			TextDecoder
+// Function:		AppendCodePoint
+//
+// Description:		Appends the UTF-8 form of a code point.
+//
+// Input Arguments:
+//		codePoint	= const unsigned long&
+//
+// Output Arguments:
+//		output	= std::string&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TextDecoder::AppendCodePoint(const unsigned long &codePoint, std::string &output)
+{
+	if (codePoint < 0x80)
+		output.push_back(static_cast<char>(codePoint));
+	else if (codePoint < 0x800)
+	{
+		output.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+		output.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+	}
+	else if (codePoint < 0x10000)
+	{
+		output.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+		output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+		output.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+	}
+	else
+	{
+		output.push_back(static_cast<char>(0xf0 | (codePoint >> 18)));
+		output.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f)));
+		output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+		output.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+	}
+}
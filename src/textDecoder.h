@@ -0,0 +1,46 @@
+// File:  textDecoder.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Detects the encoding of text from its byte order mark, and converts
+//        UTF-16 text to UTF-8 so it can be parsed like any other file.  Text
+//        may be converted in pieces of any size.
+
+#ifndef TEXT_DECODER_H_
+#define TEXT_DECODER_H_
+
+// Standard C++ headers
+#include <string>
+
+class TextDecoder
+{
+public:
+	enum Encoding
+	{
+		EncodingUtf8,// Including ASCII and text with no byte order mark
+		EncodingUtf16LittleEndian,
+		EncodingUtf16BigEndian
+	};
+
+	// Returns the length of the byte order mark in bomLength (zero if none)
+	static Encoding DetectEncoding(const char *data, const size_t &length, size_t &bomLength);
+
+	TextDecoder(const Encoding &encoding = EncodingUtf16LittleEndian);
+	void Reset(const Encoding &encoding);
+
+	// Appends the UTF-8 form of the data to output; incomplete characters at
+	// the end of the data are completed by the next call
+	void Decode(const char *data, const size_t &length, std::string &output);
+	void Finish(std::string &output);// Call after the last piece
+
+private:
+	Encoding encoding;
+
+	bool hasPendingByte;
+	unsigned char pendingByte;
+	unsigned int pendingHighSurrogate;// Zero if none
+
+	void DecodeUnit(const unsigned int &unit, std::string &output);
+	static void AppendCodePoint(const unsigned long &codePoint, std::string &output);
+};
+
+#endif// TEXT_DECODER_H_
@@ -2,18 +2,33 @@
 // Date:  3/27/2011
 // Auth:  K. Loux
 // Desc:  Traverses directory structures searching for files in which
-//        lines should be counted and added to the total count.
+//        lines should be counted and adds them to the queue of files to parse.
+
+#ifdef WIN32
+// Windows headers
+#include <windows.h>
+#else
+// *nix headers
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#endif
 
 // Standard C++ headers
 #include <iostream>
 #include <string>
-#include <fstream>
-
-// wxWidgets headers
-#include <wx/wx.h>
+#include <cstring>
+#include <cctype>
 
 // Local headers
 #include "traverser.h"
+#include "fileProcessor.h"
+#include "fileReader.h"
 
 using namespace std;
 
@@ -24,10 +39,14 @@ using namespace std;
 // Description:		Constructor for Traverser class.
 //
 // Input Arguments:
-//		extensions				= const std::vector<std::string>&
-//		commentIndicators		= const std::vector<std::string>&
-//		blockCommentIndicators	= const std::vector<std::pair<std::string, std::string> >&
-//		continuationIndicators	= const std::vector<std::string>&
+//		extensions	= const std::vector<std::string>&
+//		queue		= FileQueue&, receives files to be parsed
+//		recursive	= const bool&, true to search sub-directories
+//		excludes	= const PathFilter&, files and directories to skip
+//		useGitIgnore	= const bool&, true to also skip files and directories
+//					  listed in .gitignore files
+//		visited		= FileIdSet&, files and directories already searched (may be
+//					  shared with other traversers)
 //
 // Output Arguments:
 //		None
@@ -37,77 +56,621 @@ using namespace std;
 //
 //==========================================================================
 Traverser::Traverser(const std::vector<std::string> &extensions,
-	const std::vector<std::string> &commentIndicators,
-	const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
-	const std::vector<std::string> &continuationIndicators) : extensions(extensions),
-	counter(commentIndicators, blockCommentIndicators, continuationIndicators)
+	FileQueue &queue, const bool &recursive, const PathFilter &excludes,
+	const bool &useGitIgnore, FileIdSet &visited) : extensions(extensions),
+	recursive(recursive), queue(queue), excludes(excludes),
+	useGitIgnore(useGitIgnore), visited(visited)
+{
+	rootLength = 0;
+	prunedDirectoryCount = 0;
+
+	shardIndex = 0;
+	shardCount = 1;
+	shardBySubtree = false;
+
+	journal = NULL;
+
+	deadline = NULL;
+	stopped = false;
+
+	unsigned int i, j;
+	for (i = 0; i < this->extensions.size(); i++)
+	{
+		for (j = 0; j < this->extensions[i].length(); j++)
+			this->extensions[i][j] = tolower((unsigned char)this->extensions[i][j]);
+	}
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		SetShard
+//
+// Description:		Restricts the search to one of several shards, so the
+//					search can be split between processes.  Shards contain
+//					either individual files (chosen by hashing their paths)
+//					or whole top-level directories, which allows directories
+//					belonging to other shards to be skipped without searching
+//					them.  Links to the same file are only recognized within
+//					a shard, so links in different shards are each counted.
+//
+// Input Arguments:
+//		index		= const unsigned int&
+//		count		= const unsigned int&
+//		bySubtree	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Traverser::SetShard(const unsigned int &index, const unsigned int &count,
+	const bool &bySubtree)
+{
+	shardIndex = index;
+	shardCount = count;
+	shardBySubtree = bySubtree;
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		Traverse
+//
+// Description:		Searches the specified directory (and sub-directories,
+//					if recursive).  Paths are handled as raw bytes, without
+//					any character set conversion.
+//
+// Input Arguments:
+//		directory	= const std::string&, must end with a path separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, false if the directory could not be opened
+//
+//==========================================================================
+bool Traverser::Traverse(const std::string &directory)
 {
+	if (ShouldStop())
+		return true;
+
+	std::string path(directory);
+	rootLength = path.length();
+#ifdef WIN32
+	if (GetFileAttributesA(path.c_str()) == INVALID_FILE_ATTRIBUTES)
+		return false;
+
+	if (!IsComplete(path))
+		TraverseDirectory(path);
+#else
+	const int fd(open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+	if (fd < 0)
+		return false;
+
+	if (IsNewDirectory(fd) && !IsComplete(path))
+		TraverseDirectory(fd, path);
+	close(fd);
+#endif
+	return true;
 }
 
 //==========================================================================
 // Class:			Traverser
 // Function:		OnFile
 //
-// Description:		Called each time a new file is encountered.  Determines
-//					if we should parse it and add to the statistics (if
-//					extension matches).
+// Description:		Called each time a file with a matching extension is
+//					encountered.  Queues it along with its size, so the
+//					largest files can be parsed first, and the device holding
+//					it, so reads can be scheduled per device.
 //
 // Input Arguments:
-//		fileName	= const wxString&
+//		fileName	= const std::string&
+//		size		= const unsigned long long&
+//		device		= const unsigned long long&
+//		inode		= const unsigned long long&, zero if unknown
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		wxDirTraverseResult
+//		TraverseResult
 //
 //==========================================================================
-wxDirTraverseResult Traverser::OnFile(const wxString &fileName)
+Traverser::TraverseResult Traverser::OnFile(const std::string &fileName,
+	const unsigned long long &size, const unsigned long long &device,
+	const unsigned long long &inode)
 {
-	wxString ext = fileName.AfterLast('.');
-	unsigned int i;
+	if (journal && !journal->OnFileFound(fileName))
+		return TraverseContinue;
+
+	FileEntry entry;
+	entry.path = fileName;
+	entry.size = size;
+	entry.device = device;
+	entry.inode = inode;
+	queue.Push(entry);
+
+	return TraverseContinue;
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		OnDir
+//
+// Description:		Called each time a new directory is encountered.  Prints
+//					the directory name to the screen, for the user's
+//					information, unless the directory was completed by an
+//					earlier run.
+//
+// Input Arguments:
+//		directoryName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		TraverseResult
+//
+//==========================================================================
+Traverser::TraverseResult Traverser::OnDir(const std::string &directoryName)
+{
+	if (IsComplete(directoryName + "/"))
+		return TraverseIgnore;
+
+	std::lock_guard<std::mutex> lock(FileProcessor::outputMutex);
+	cout << "Entering directory: " << directoryName << endl;
+	return TraverseContinue;
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		ExtensionMatches
+//
+// Description:		Checks the file name's extension against the list of
+//					extensions to parse (case insensitive).
+//
+// Input Arguments:
+//		name		= const char*, file name without directory
+//		length		= const size_t&
+//		extensions	= const std::vector<std::string>&, lower case
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool Traverser::ExtensionMatches(const char *name, const size_t &length,
+	const std::vector<std::string> &extensions)
+{
+	const char *dot(name + length);
+	while (dot != name && *(dot - 1) != '.')
+		dot--;
+
+	if (dot == name)
+		return false;
+	dot--;
+
+	const char *extension(dot + 1);
+	const size_t extensionLength(name + length - extension);
+	unsigned int i, j;
 	for (i = 0; i < extensions.size(); i++)
 	{
-		if (wxString(extensions[i].c_str(), wxConvUTF8).CmpNoCase(ext) == 0)
+		if (extensions[i].length() != extensionLength)
+			continue;
+
+		for (j = 0; j < extensionLength; j++)
+		{
+			if (tolower((unsigned char)extension[j]) != extensions[i][j])
+				break;
+		}
+
+		if (j == extensionLength)
+			return true;
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		IsExcluded
+//
+// Description:		Checks the path (relative to the search directory)
+//					against the exclude patterns.
+//
+// Input Arguments:
+//		path		= const std::string&
+//		isDirectory	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the file or directory should be skipped
+//
+//==========================================================================
+bool Traverser::IsExcluded(const std::string &path, const bool &isDirectory) const
+{
+	if (excludes.GetPatternCount() == 0)
+		return false;
+
+	return excludes.IsExcluded(path.c_str() + rootLength,
+		path.c_str() + path.length(), isDirectory);
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		InShard
+//
+// Description:		Checks to see if the file or directory belongs to our
+//					shard.  With shards by subtree, only entries directly
+//					within the search directory are assigned to shards, and
+//					everything below them belongs to the same shard.
+//
+// Input Arguments:
+//		path		= const std::string&
+//		isDirectory	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool Traverser::InShard(const std::string &path, const bool &isDirectory) const
+{
+	if (shardCount <= 1)
+		return true;
+
+	if (shardBySubtree)
+	{
+		if (memchr(path.c_str() + rootLength, '/', path.length() - rootLength))
+			return true;
+	}
+	else if (isDirectory)
+		return true;
+
+	// FNV-1a, so all processes agree regardless of platform
+	unsigned long long hash(14695981039346656037ULL);
+	size_t i;
+	for (i = 0; i < path.length(); i++)
+	{
+		hash ^= (unsigned char)path[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash % shardCount == shardIndex;
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		IsComplete
+//
+// Description:		Checks to see if the directory was completed by an
+//					earlier run (according to the checkpoint journal).
+//
+// Input Arguments:
+//		path	= const std::string&, ending with a separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool Traverser::IsComplete(const std::string &path) const
+{
+	return journal && journal->IsDirectoryComplete(path);
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		ShouldStop
+//
+// Description:		Checks to see if the deadline has passed, and records
+//					that the search was stopped if it has.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool Traverser::ShouldStop(void)
+{
+	if (!deadline || !deadline->HasPassed())
+		return false;
+
+	stopped = true;
+	return true;
+}
+
+//==========================================================================
+// Class:			Traverser
+// Function:		LoadGitIgnore
+//
+// Description:		Adds the patterns from the directory's .gitignore file
+//					(if there is one) to the exclude patterns.
+//
+// Input Arguments:
+//		path	= const std::string&, path to the directory, ending with a separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Traverser::LoadGitIgnore(const std::string &path)
+{
+	std::string contents;
+	if (FileReader::Read(path + ".gitignore", 0, contents))
+		excludes.AddPatterns(contents, path.substr(rootLength));
+}
+
+#ifdef WIN32
+//==========================================================================
+// Class:			Traverser
+// Function:		TraverseDirectory
+//
+// Description:		Searches the specified directory.  Hidden files and
+//					directories are skipped, as are those matching the
+//					exclude patterns.  Nothing more is searched once the
+//					deadline has passed.
+//
+// Input Arguments:
+//		path	= std::string&, path to the directory, ending with a separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Traverser::TraverseDirectory(std::string &path)
+{
+	if (ShouldStop())
+		return;
+
+	const size_t pathLength(path.length());
+	const size_t patternCount(excludes.GetPatternCount());
+	if (useGitIgnore)
+		LoadGitIgnore(path);
+
+	if (journal)
+		journal->OnDirectoryEntered(path);
+
+	path.append("*");
+
+	WIN32_FIND_DATAA data;
+	HANDLE find(FindFirstFileA(path.c_str(), &data));
+	path.resize(pathLength);
+	if (find == INVALID_HANDLE_VALUE)
+	{
+		if (journal)
+			journal->OnDirectorySearched(path);
+		excludes.RemovePatterns(patternCount);
+		return;
+	}
+
+	std::vector<std::string> subDirectories;
+	do
+	{
+		if (data.cFileName[0] == '.' || (data.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN))
+			continue;
+
+		if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+		{
+			// File IDs are not available from the directory listing, so
+			// cycles are avoided by not following junctions and links
+			if (recursive && !(data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+				subDirectories.push_back(data.cFileName);
+		}
+		else if (ExtensionMatches(data.cFileName, strlen(data.cFileName), extensions))
+		{
+			path.append(data.cFileName);
+			if (!IsExcluded(path, false) && InShard(path, false))
+				OnFile(path, ((unsigned long long)data.nFileSizeHigh << 32) | data.nFileSizeLow, 0, 0);
+			path.resize(pathLength);
+		}
+	} while (FindNextFileA(find, &data));
+	FindClose(find);
+
+	unsigned int i;
+	for (i = 0; i < subDirectories.size(); i++)
+	{
+		path.append(subDirectories[i]);
+		if (IsExcluded(path, true))
+			prunedDirectoryCount++;
+		else if (InShard(path, true) && OnDir(path) == TraverseContinue)
 		{
-#ifdef __WXMSW__
-			wxString shortFileName = fileName.Mid(fileName.find_last_of('\\') + 1);
-#elif defined __WXGTK__
-			wxString shortFileName = fileName.Mid(fileName.find_last_of('/') + 1);
+			path.append("/");
+			TraverseDirectory(path);
+		}
+		path.resize(pathLength);
+	}
+
+	// Not complete if any part was left unsearched
+	if (journal && !stopped)
+		journal->OnDirectorySearched(path);
+	excludes.RemovePatterns(patternCount);
+}
 #else
-#error "Unrecognized platform!"
+//==========================================================================
+// Class:			Traverser
+// Function:		TraverseDirectory
+//
+// Description:		Searches the specified directory.  Hidden files and
+//					directories are skipped, as are those matching the
+//					exclude patterns.  Entries are opened and examined
+//					relative to the directory's file descriptor, and the entry
+//					type reported with the directory listing is used so that
+//					only matching files (plus symbolic links and entries of
+//					unknown type) need to be examined with stat.  On Linux the
+//					listing is read in large blocks with getdents64.  Nothing
+//					more is searched once the deadline has passed.
+//
+// Input Arguments:
+//		directory	= const int&, open file descriptor for the directory
+//		path		= std::string&, path to the directory, ending with a separator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Traverser::TraverseDirectory(const int &directory, std::string &path)
+{
+	if (ShouldStop())
+		return;
+
+	const size_t pathLength(path.length());
+	std::vector<std::string> subDirectories;
+
+	const size_t patternCount(excludes.GetPatternCount());
+	if (useGitIgnore)
+		LoadGitIgnore(path);
+
+	if (journal)
+		journal->OnDirectoryEntered(path);
+
+#ifdef __linux__
+	entryBuffer.resize(64 * 1024);
+	long count;
+	while ((count = syscall(SYS_getdents64, directory, &entryBuffer.front(), entryBuffer.size())) > 0)
+	{
+		long offset;
+		for (offset = 0; offset < count; )
+		{
+			const struct dirent64 *entry(reinterpret_cast<const struct dirent64*>(&entryBuffer[offset]));
+			offset += entry->d_reclen;
+#else
+	const int listFd(dup(directory));
+	DIR *listing(listFd < 0 ? NULL : fdopendir(listFd));
+	if (!listing)
+	{
+		if (listFd >= 0)
+			close(listFd);
+		if (journal)
+			journal->OnDirectorySearched(path);
+		excludes.RemovePatterns(patternCount);
+		return;
+	}
+
+	{
+		const struct dirent *entry;
+		while ((entry = readdir(listing)) != NULL)
+		{
 #endif
-			cout << "  Parsing file: " << shortFileName.mb_str() << endl;
-			if (!counter.ProcessFile(std::string(fileName.mb_str())))
-				cout << "  Problems encounterd while parsing '"
-				<< shortFileName.mb_str() << "'" << endl;
-			break;
+			if (entry->d_name[0] == '.')
+				continue;
+
+			unsigned char type(entry->d_type);
+			struct stat st;
+			bool haveStat(false);
+			if (type == DT_UNKNOWN || type == DT_LNK)
+			{
+				// Follow links, as the wxWidgets implementation did
+				if (fstatat(directory, entry->d_name, &st, 0) != 0)
+					continue;
+
+				haveStat = true;
+				type = S_ISDIR(st.st_mode) ? DT_DIR : (S_ISREG(st.st_mode) ? DT_REG : DT_UNKNOWN);
+			}
+
+			if (type == DT_DIR)
+			{
+				if (recursive)
+					subDirectories.push_back(entry->d_name);
+			}
+			else if (type == DT_REG && ExtensionMatches(entry->d_name, strlen(entry->d_name), extensions))
+			{
+				if (!haveStat && fstatat(directory, entry->d_name, &st, 0) != 0)
+					continue;
+
+				// Hard links and links to files elsewhere in the search are
+				// only counted once
+				path.append(entry->d_name);
+				if (!IsExcluded(path, false) && InShard(path, false) &&
+					visited.Insert(st.st_dev, st.st_ino))
+					OnFile(path, st.st_size, st.st_dev, st.st_ino);
+				path.resize(pathLength);
+			}
 		}
 	}
 
-	return wxDIR_CONTINUE;
+#ifndef __linux__
+	closedir(listing);
+#endif
+
+	unsigned int i;
+	for (i = 0; i < subDirectories.size(); i++)
+	{
+		path.append(subDirectories[i]);
+		if (IsExcluded(path, true))
+			prunedDirectoryCount++;
+		else if (InShard(path, true))
+		{
+			const int fd(openat(directory, subDirectories[i].c_str(),
+				O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+			if (fd >= 0)
+			{
+				if (IsNewDirectory(fd) && OnDir(path) == TraverseContinue)
+				{
+					path.append("/");
+					TraverseDirectory(fd, path);
+				}
+				close(fd);
+			}
+		}
+		path.resize(pathLength);
+	}
+
+	// Not complete if any part was left unsearched
+	if (journal && !stopped)
+		journal->OnDirectorySearched(path);
+	excludes.RemovePatterns(patternCount);
 }
 
 //==========================================================================
 // Class:			Traverser
-// Function:		OnDir
+// Function:		IsNewDirectory
 //
-// Description:		Called each time a new directory is encountered.  Simply
-//					prints the directory name to the screen, for the user's
-//					information.
+// Description:		Records the directory as visited.  Directories reached a
+//					second time (through links, possibly forming a cycle, or
+//					through overlapping search directories) are not searched
+//					again.
 //
 // Input Arguments:
-//		directoryName	= const wxString&
+//		directory	= const int&, open file descriptor for the directory
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		wxDirTraverseResult
+//		bool, true if the directory has not been visited before
 //
 //==========================================================================
-wxDirTraverseResult Traverser::OnDir(const wxString &directoryName)
+bool Traverser::IsNewDirectory(const int &directory)
 {
-	cout << "Entering directory: " << directoryName.mb_str() << endl;
-	return wxDIR_CONTINUE;
-}
\ No newline at end of file
+	struct stat st;
+	if (fstat(directory, &st) != 0)
+		return false;
+
+	return visited.Insert(st.st_dev, st.st_ino);
+}
+#endif
@@ -2,7 +2,7 @@
 // Date:  3/27/2011
 // Auth:  K. Loux
 // Desc:  Traverses directory structures searching for files in which
-//        lines should be counted and added to the total count.
+//        lines should be counted and adds them to the queue of files to parse.
 
 #ifndef TRAVERSER_H_
 #define TRAVERSER_H_
@@ -11,31 +11,85 @@
 #include <string>
 #include <vector>
 
-// wxWidgets headers
-#include <wx/dir.h>
-
 // Local headers
-#include "lineCounter.h"
+#include "fileQueue.h"
+#include "pathFilter.h"
+#include "fileIdSet.h"
+#include "checkpointJournal.h"
+#include "deadline.h"
 
-class Traverser : public wxDirTraverser
+class Traverser
 {
 public:
 	// Constructor
-	Traverser(const std::vector<std::string> &extensions,
-		const std::vector<std::string> &commentIndicators,
-		const std::vector<std::pair<std::string, std::string> > &blockCommentIndicators,
-		const std::vector<std::string> &continuationIndicators);
-	virtual ~Traverser() {};
+	Traverser(const std::vector<std::string> &extensions, FileQueue &queue,
+		const bool &recursive, const PathFilter &excludes, const bool &useGitIgnore,
+		FileIdSet &visited);
+
+	bool Traverse(const std::string &directory);
+
+	unsigned int GetPrunedDirectoryCount(void) const { return prunedDirectoryCount; };
+
+	void SetShard(const unsigned int &index, const unsigned int &count, const bool &bySubtree);
 
-	virtual wxDirTraverseResult OnFile(const wxString &fileName);
-	virtual wxDirTraverseResult OnDir(const wxString &directoryName);
+	// When set, directories and files completed by an earlier run are skipped
+	// and the progress of the search is reported to the journal
+	void SetCheckpointJournal(CheckpointJournal *journal) { this->journal = journal; };
 
-	const LineCounter::Statistics GetStatistics(void) const { return counter.GetStatistics(); };
+	// When set, no more directories are searched once the deadline has
+	// passed.  WasStopped() is true if anything was left unsearched.
+	void SetDeadline(const Deadline *deadline) { this->deadline = deadline; };
+	bool WasStopped(void) const { return stopped; };
+
+	// extensions must be lower case
+	static bool ExtensionMatches(const char *name, const size_t &length,
+		const std::vector<std::string> &extensions);
 
 private:
-	const std::vector<std::string> extensions;// List of extensions to parse
+	std::vector<std::string> extensions;// List of extensions to parse (lower case)
+	const bool recursive;
+
+	FileQueue &queue;
+
+	PathFilter excludes;
+	const bool useGitIgnore;
+	size_t rootLength;// Length of the search directory portion of the path
+	unsigned int prunedDirectoryCount;
+
+	FileIdSet &visited;
+
+	unsigned int shardIndex;
+	unsigned int shardCount;
+	bool shardBySubtree;
+
+	CheckpointJournal *journal;
+
+	const Deadline *deadline;
+	bool stopped;
+
+	enum TraverseResult
+	{
+		TraverseContinue,
+		TraverseIgnore
+	};
+
+	TraverseResult OnFile(const std::string &fileName, const unsigned long long &size,
+		const unsigned long long &device, const unsigned long long &inode);
+	TraverseResult OnDir(const std::string &directoryName);
+
+	bool IsExcluded(const std::string &path, const bool &isDirectory) const;
+	void LoadGitIgnore(const std::string &path);
+	bool InShard(const std::string &path, const bool &isDirectory) const;
+	bool IsComplete(const std::string &path) const;
+	bool ShouldStop(void);
 
-	LineCounter counter;
+#ifdef WIN32
+	void TraverseDirectory(std::string &path);
+#else
+	std::vector<char> entryBuffer;
+	void TraverseDirectory(const int &directory, std::string &path);
+	bool IsNewDirectory(const int &directory);
+#endif
 };
 
 #endif// TRAVERSER_H_
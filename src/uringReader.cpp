@@ -0,0 +1,632 @@
+// File:  uringReader.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Reads files using Linux io_uring.  The open, read and close
+//        operations for many files are batched together and submitted with
+//        a single system call, reading into a fixed set of registered
+//        buffers.  IsOK() returns false if io_uring is not supported, in
+//        which case the caller should fall back to FileReader.
+
+// Local headers
+#include "uringReader.h"
+
+#ifdef HAVE_IO_URING
+// *nix headers
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Standard C++ headers
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#endif
+
+//==========================================================================
+// Class:			UringReader
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for UringReader class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const size_t UringReader::bufferSize = 1024 * 1024;
+
+//==========================================================================
+// Class:			UringReader
+// Function:		UringReader
+//
+// Description:		Constructor for UringReader class.
+//
+// Input Arguments:
+//		depth	= const unsigned int&, number of files to read at once
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+UringReader::UringReader(const unsigned int &depth) : ringFd(-1)
+{
+#ifdef HAVE_IO_URING
+	submissionRing = MAP_FAILED;
+	completionRing = MAP_FAILED;
+	sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+	pendingSubmissions = 0;
+
+	if (!Initialize(depth > 0 ? depth : 1))
+		Cleanup();
+#else
+	(void)depth;
+#endif
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		~UringReader
+//
+// Description:		Destructor for UringReader class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+UringReader::~UringReader()
+{
+#ifdef HAVE_IO_URING
+	Cleanup();
+#endif
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		Run
+//
+// Description:		Reads files from the input queue and passes them to the
+//					output queue until the input queue is closed and empty.
+//					Files at least maxBufferedFileSize bytes long are passed
+//					on unread, as are files which could not be read (so the
+//					parser can report the error) and files taken from the
+//					queue after the deadline has passed.
+//
+// Input Arguments:
+//		input				= FileQueue&
+//		output				= BoundedQueue<FileBuffer>&
+//		maxBufferedFileSize	= const unsigned long long&
+//		deadline			= const Deadline*, may be NULL
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void UringReader::Run(FileQueue &input, BoundedQueue<FileBuffer> &output,
+	const unsigned long long &maxBufferedFileSize, const Deadline *deadline)
+{
+#ifdef HAVE_IO_URING
+	bool inputOpen(true);
+	unsigned int activeSlots(0);
+	unsigned int i;
+	while (inputOpen || activeSlots > 0)
+	{
+		// Start as many new files as we have free slots
+		for (i = 0; i < slots.size() && inputOpen; i++)
+		{
+			if (slots[i].stage != StageIdle)
+				continue;
+
+			FileEntry entry;
+			if (!input.Pop(entry, activeSlots == 0))
+			{
+				inputOpen = !input.IsFinished();
+				break;
+			}
+
+			if (entry.size >= maxBufferedFileSize || (deadline && deadline->HasPassed()))
+			{
+				input.Release(entry);
+				FileBuffer file;
+				file.entry = entry;
+				file.buffered = false;
+				output.Push(std::move(file));
+				continue;
+			}
+
+			slots[i].file.entry = entry;
+			slots[i].file.contents.clear();
+			slots[i].file.contents.reserve(entry.size);
+			QueueOpen(i);
+			activeSlots++;
+		}
+
+		if (activeSlots == 0)
+			continue;
+
+		if (!SubmitAndWait())
+			break;
+
+		unsigned int head(*completionHead);
+		while (head != __atomic_load_n(completionTail, __ATOMIC_ACQUIRE))
+		{
+			const io_uring_cqe &cqe(cqes[head & *completionMask]);
+			HandleCompletion(static_cast<unsigned int>(cqe.user_data), cqe.res,
+				input, output, activeSlots);
+			head++;
+		}
+		__atomic_store_n(completionHead, head, __ATOMIC_RELEASE);
+	}
+
+	// Only reached with active slots if the ring failed, so fall back on the
+	// parser to read anything still in progress (files being closed have
+	// been read completely, and their descriptors were handed to the ring)
+	for (i = 0; i < slots.size(); i++)
+	{
+		if (slots[i].stage != StageIdle)
+		{
+			if (slots[i].fd >= 0)
+				close(slots[i].fd);
+			Finish(i, slots[i].stage == StageClosing, input, output, activeSlots);
+		}
+	}
+#else
+	(void)input;
+	(void)output;
+	(void)maxBufferedFileSize;
+	(void)deadline;
+#endif
+}
+
+#ifdef HAVE_IO_URING
+//==========================================================================
+// Class:			UringReader
+// Function:		Initialize
+//
+// Description:		Creates the ring, maps it into our address space and
+//					registers the read buffers.
+//
+// Input Arguments:
+//		depth	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool UringReader::Initialize(const unsigned int &depth)
+{
+	io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	ringFd = syscall(__NR_io_uring_setup, depth, &params);
+	if (ringFd < 0)
+		return false;
+
+	submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+	completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+	{
+		if (completionRingSize > submissionRingSize)
+			submissionRingSize = completionRingSize;
+		completionRingSize = submissionRingSize;
+	}
+
+	submissionRing = mmap(NULL, submissionRingSize, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+	if (submissionRing == MAP_FAILED)
+		return false;
+
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+		completionRing = submissionRing;
+	else
+	{
+		completionRing = mmap(NULL, completionRingSize, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+		if (completionRing == MAP_FAILED)
+			return false;
+	}
+
+	sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+	sqes = static_cast<io_uring_sqe*>(mmap(NULL, sqesSize, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES));
+	if (sqes == MAP_FAILED)
+		return false;
+
+	char *sq(static_cast<char*>(submissionRing));
+	submissionHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+	submissionTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+	submissionMask = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+	submissionArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+
+	char *cq(static_cast<char*>(completionRing));
+	completionHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+	completionTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+	completionMask = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+	cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+	if (!OperationsSupported())
+		return false;
+
+	// One slot (and one registered buffer) per file in flight
+	slots.resize(params.sq_entries);
+	bufferMemory.resize(slots.size() * bufferSize);
+	std::vector<iovec> buffers(slots.size());
+	unsigned int i;
+	for (i = 0; i < slots.size(); i++)
+	{
+		slots[i].stage = StageIdle;
+		slots[i].fd = -1;
+		slots[i].buffer = &bufferMemory[i * bufferSize];
+		buffers[i].iov_base = slots[i].buffer;
+		buffers[i].iov_len = bufferSize;
+	}
+
+	return syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_BUFFERS,
+		&buffers.front(), buffers.size()) == 0;
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		OperationsSupported
+//
+// Description:		Checks that the kernel supports the operations we use.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool UringReader::OperationsSupported(void) const
+{
+	const unsigned int opCount(256);
+	const size_t probeSize(sizeof(io_uring_probe) + opCount * sizeof(io_uring_probe_op));
+	io_uring_probe *probe(static_cast<io_uring_probe*>(calloc(1, probeSize)));
+	if (!probe)
+		return false;
+
+	bool supported(syscall(__NR_io_uring_register, ringFd,
+		IORING_REGISTER_PROBE, probe, opCount) == 0);
+	const unsigned char required[] = { IORING_OP_OPENAT, IORING_OP_READ_FIXED, IORING_OP_CLOSE };
+	unsigned int i;
+	for (i = 0; supported && i < sizeof(required); i++)
+	{
+		supported = required[i] <= probe->last_op &&
+			(probe->ops[required[i]].flags & IO_URING_OP_SUPPORTED) != 0;
+	}
+
+	free(probe);
+	return supported;
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		Cleanup
+//
+// Description:		Unmaps and closes the ring.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void UringReader::Cleanup(void)
+{
+	if (sqes != MAP_FAILED)
+		munmap(sqes, sqesSize);
+	if (completionRing != MAP_FAILED && completionRing != submissionRing)
+		munmap(completionRing, completionRingSize);
+	if (submissionRing != MAP_FAILED)
+		munmap(submissionRing, submissionRingSize);
+	if (ringFd >= 0)
+		close(ringFd);
+
+	sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+	completionRing = MAP_FAILED;
+	submissionRing = MAP_FAILED;
+	ringFd = -1;
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		GetSubmission
+//
+// Description:		Returns the next free submission queue entry, cleared and
+//					tagged with the slot index.  There is never more than one
+//					operation in flight per slot, so the queue cannot overflow.
+//					The entry is not visible to the kernel until it has been
+//					filled in and PublishSubmission() is called.
+//
+// Input Arguments:
+//		slot	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		io_uring_sqe*
+//
+//==========================================================================
+io_uring_sqe* UringReader::GetSubmission(const unsigned int &slot)
+{
+	io_uring_sqe *sqe(&sqes[*submissionTail & *submissionMask]);
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->user_data = slot;
+	return sqe;
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		PublishSubmission
+//
+// Description:		Adds the entry returned by GetSubmission() to the
+//					submission ring.  The tail is stored with release
+//					semantics so the kernel sees the completed entry.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void UringReader::PublishSubmission(void)
+{
+	const unsigned int tail(*submissionTail);
+	const unsigned int index(tail & *submissionMask);
+	submissionArray[index] = index;
+	__atomic_store_n(submissionTail, tail + 1, __ATOMIC_RELEASE);
+	pendingSubmissions++;
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		QueueOpen
+//
+// Description:		Queues the opening of the slot's file.
+//
+// Input Arguments:
+//		slot	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void UringReader::QueueOpen(const unsigned int &slot)
+{
+	slots[slot].stage = StageOpening;
+	slots[slot].offset = 0;
+
+	io_uring_sqe *sqe(GetSubmission(slot));
+	sqe->opcode = IORING_OP_OPENAT;
+	sqe->fd = AT_FDCWD;
+	sqe->addr = reinterpret_cast<unsigned long long>(slots[slot].file.entry.path.c_str());
+	sqe->open_flags = O_RDONLY | O_CLOEXEC;
+	PublishSubmission();
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		QueueRead
+//
+// Description:		Queues a read of the slot's file into its registered
+//					buffer.
+//
+// Input Arguments:
+//		slot	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void UringReader::QueueRead(const unsigned int &slot)
+{
+	slots[slot].stage = StageReading;
+
+	io_uring_sqe *sqe(GetSubmission(slot));
+	sqe->opcode = IORING_OP_READ_FIXED;
+	sqe->fd = slots[slot].fd;
+	sqe->addr = reinterpret_cast<unsigned long long>(slots[slot].buffer);
+	sqe->len = bufferSize;
+	sqe->off = slots[slot].offset;
+	sqe->buf_index = slot;
+	PublishSubmission();
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		QueueClose
+//
+// Description:		Queues the closing of the slot's file.  The slot no
+//					longer owns the descriptor once the close is queued.
+//
+// Input Arguments:
+//		slot	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void UringReader::QueueClose(const unsigned int &slot)
+{
+	slots[slot].stage = StageClosing;
+
+	io_uring_sqe *sqe(GetSubmission(slot));
+	sqe->opcode = IORING_OP_CLOSE;
+	sqe->fd = slots[slot].fd;
+	PublishSubmission();
+	slots[slot].fd = -1;
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		SubmitAndWait
+//
+// Description:		Submits all queued operations and waits for at least
+//					one to complete.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool UringReader::SubmitAndWait(void)
+{
+	for (;;)
+	{
+		const int submitted(syscall(__NR_io_uring_enter, ringFd,
+			pendingSubmissions, 1, IORING_ENTER_GETEVENTS, NULL, 0));
+		if (submitted >= 0)
+		{
+			pendingSubmissions -= submitted;
+			return true;
+		}
+		else if (errno != EINTR && errno != EAGAIN)
+			return false;
+	}
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		HandleCompletion
+//
+// Description:		Advances the slot's file to the next stage following
+//					completion of an operation.
+//
+// Input Arguments:
+//		slot		= const unsigned int&
+//		result		= const int&, result of the operation (negative errno
+//					  value on failure)
+//		input		= FileQueue&
+//		output		= BoundedQueue<FileBuffer>&
+//		activeSlots	= unsigned int&
+//
+// Output Arguments:
+//		activeSlots	= unsigned int&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void UringReader::HandleCompletion(const unsigned int &slot, const int &result,
+	FileQueue &input, BoundedQueue<FileBuffer> &output, unsigned int &activeSlots)
+{
+	Slot &s(slots[slot]);
+	if (s.stage == StageOpening)
+	{
+		if (result < 0)
+			Finish(slot, false, input, output, activeSlots);
+		else
+		{
+			s.fd = result;
+			QueueRead(slot);
+		}
+	}
+	else if (s.stage == StageReading)
+	{
+		if (result < 0)
+		{
+			close(s.fd);
+			Finish(slot, false, input, output, activeSlots);
+			return;
+		}
+
+		s.file.contents.append(s.buffer, result);
+		s.offset += result;
+
+		// A short read at (or past) the expected size is taken as end-of-file,
+		// saving a read which would return zero
+		if (result == 0 || ((size_t)result < bufferSize && s.offset >= s.file.entry.size))
+			QueueClose(slot);
+		else
+			QueueRead(slot);
+	}
+	else if (s.stage == StageClosing)
+		Finish(slot, true, input, output, activeSlots);
+}
+
+//==========================================================================
+// Class:			UringReader
+// Function:		Finish
+//
+// Description:		Passes the slot's file to the output queue and frees the
+//					slot (and the file's place in its device's limit).
+//
+// Input Arguments:
+//		slot		= const unsigned int&
+//		buffered	= const bool&, false if the file could not be read
+//		input		= FileQueue&
+//		output		= BoundedQueue<FileBuffer>&
+//		activeSlots	= unsigned int&
+//
+// Output Arguments:
+//		activeSlots	= unsigned int&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void UringReader::Finish(const unsigned int &slot, const bool &buffered,
+	FileQueue &input, BoundedQueue<FileBuffer> &output, unsigned int &activeSlots)
+{
+	Slot &s(slots[slot]);
+	input.Release(s.file.entry);
+	s.file.buffered = buffered;
+	if (!buffered)
+		s.file.contents.clear();
+
+	const size_t weight(s.file.contents.length() + 1);
+	output.Push(std::move(s.file), weight);
+
+	s.file = FileBuffer();
+	s.stage = StageIdle;
+	s.fd = -1;
+	activeSlots--;
+}
+#endif
@@ -0,0 +1,103 @@
+// File:  uringReader.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Reads files using Linux io_uring.  The open, read and close
+//        operations for many files are batched together and submitted with
+//        a single system call, reading into a fixed set of registered
+//        buffers.  IsOK() returns false if io_uring is not supported, in
+//        which case the caller should fall back to FileReader.
+
+#ifndef URING_READER_H_
+#define URING_READER_H_
+
+// Standard C++ headers
+#include <vector>
+
+// Local headers
+#include "fileQueue.h"
+#include "boundedQueue.h"
+#include "deadline.h"
+
+#ifdef __linux__
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+#endif
+
+// Operations we use were added along with the probe interface (Linux 5.6)
+#ifdef IO_URING_OP_SUPPORTED
+#define HAVE_IO_URING
+#endif
+
+class UringReader
+{
+public:
+	UringReader(const unsigned int &depth);
+	~UringReader();
+
+	bool IsOK(void) const { return ringFd >= 0; };
+
+	// Once the deadline (if any) has passed, files are passed on unread
+	void Run(FileQueue &input, BoundedQueue<FileBuffer> &output,
+		const unsigned long long &maxBufferedFileSize, const Deadline *deadline = NULL);
+
+private:
+	static const size_t bufferSize;
+
+	int ringFd;
+
+#ifdef HAVE_IO_URING
+	enum Stage
+	{
+		StageIdle,
+		StageOpening,
+		StageReading,
+		StageClosing
+	};
+
+	struct Slot
+	{
+		Stage stage;
+		FileBuffer file;
+		int fd;
+		unsigned long long offset;
+		char *buffer;
+	};
+
+	std::vector<Slot> slots;
+	std::vector<char> bufferMemory;
+
+	// Shared ring memory
+	void *submissionRing;
+	size_t submissionRingSize;
+	void *completionRing;
+	size_t completionRingSize;
+	io_uring_sqe *sqes;
+	size_t sqesSize;
+
+	unsigned int *submissionHead, *submissionTail, *submissionMask, *submissionArray;
+	unsigned int *completionHead, *completionTail, *completionMask;
+	io_uring_cqe *cqes;
+
+	unsigned int pendingSubmissions;
+
+	bool Initialize(const unsigned int &depth);
+	bool OperationsSupported(void) const;
+	void Cleanup(void);
+
+	io_uring_sqe* GetSubmission(const unsigned int &slot);
+	void PublishSubmission(void);
+	void QueueOpen(const unsigned int &slot);
+	void QueueRead(const unsigned int &slot);
+	void QueueClose(const unsigned int &slot);
+	bool SubmitAndWait(void);
+	void HandleCompletion(const unsigned int &slot, const int &result, FileQueue &input,
+		BoundedQueue<FileBuffer> &output, unsigned int &activeSlots);
+	void Finish(const unsigned int &slot, const bool &buffered, FileQueue &input,
+		BoundedQueue<FileBuffer> &output, unsigned int &activeSlots);
+#endif
+};
+
+#endif// URING_READER_H_
@@ -0,0 +1,84 @@
+// File:  worker.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Counts shards of a search on behalf of a coordinator process.
+
+// Standard C++ headers
+#include <sstream>
+
+// Local headers
+#include "worker.h"
+#include "connection.h"
+#include "pipeline.h"
+#include "partialResults.h"
+
+//==========================================================================
+// Class:			Worker
+// Function:		Worker
+//
+// Description:		Constructor for Worker class.
+//
+// Input Arguments:
+//		info	= const LineCounterInformation&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+Worker::Worker(const LineCounterInformation &info) : info(info)
+{
+}
+
+//==========================================================================
+// Class:			Worker
+// Function:		Run
+//
+// Description:		Connects to the coordinator, then counts each shard it
+//					is given and returns the results.
+//
+// Input Arguments:
+//		host	= const std::string&
+//		port	= const unsigned short&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the coordinator ran out of work, false if the
+//		connection failed
+//
+//==========================================================================
+bool Worker::Run(const std::string &host, const unsigned short &port)
+{
+	Connection connection;
+	if (!connection.Connect(host, port))
+		return false;
+
+	std::string line;
+	while (connection.WriteLine("NEXT") && connection.ReadLine(line))
+	{
+		if (line == "DONE")
+			return true;
+
+		std::istringstream request(line);
+		std::string keyword, mode;
+		unsigned int shard, shardCount;
+		if (!(request >> keyword >> shard >> shardCount >> mode) ||
+			keyword != "SHARD" || shard >= shardCount)
+			return false;
+
+		Pipeline pipeline(info);
+		pipeline.SetShard(shard, shardCount, mode == "subtree");
+		const LineCounter::Statistics statistics(pipeline.Run());
+
+		std::ostringstream result;
+		result << "RESULT " << shard << " " << PartialResults::Format(statistics);
+		if (!connection.WriteLine(result.str()))
+			return false;
+	}
+
+	return false;
+}
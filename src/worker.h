@@ -0,0 +1,27 @@
+// File:  worker.h
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Counts shards of a search on behalf of a coordinator process.
+
+#ifndef WORKER_H_
+#define WORKER_H_
+
+// Standard C++ headers
+#include <string>
+
+// Local headers
+#include "lineCounterConfigFile.h"
+
+class Worker
+{
+public:
+	Worker(const LineCounterInformation &info);
+
+	// Requests and counts shards until the coordinator has no more
+	bool Run(const std::string &host, const unsigned short &port);
+
+private:
+	const LineCounterInformation &info;
+};
+
+#endif// WORKER_H_
@@ -0,0 +1,221 @@
+// File:  archiveReaderTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for tar archive reader class and streamed parsing of the
+//        files it reads.
+
+// Standard C++ headers
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+// zlib headers
+#include <zlib.h>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "archiveReader.h"
+#include "lineCounter.h"
+
+class ArchiveReaderTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		tarName = "archiveReaderTest.tar";
+		gzipName = "archiveReaderTest.tar.gz";
+		longName = std::string(150, 'd') + "/long.cpp";
+		source = "// comment\n\nint x;\n/* block\n comment */ int y;\nno newline";
+
+		AddEntry("dir/", "", '5');
+		AddEntry("dir/a.cpp", source, '0');
+		AddEntry("././@LongLink", longName, 'L');
+		AddEntry(longName.substr(0, 99), "int z;\n", '0');
+		AddEntry("link.cpp", "", '2');
+		AddEntry("empty.h", "", '0');
+		archive.append(1024, '\0');
+
+		std::ofstream tar(tarName.c_str(), std::ios::out | std::ios::binary);
+		tar.write(archive.data(), archive.size());
+
+		gzFile gzip(gzopen(gzipName.c_str(), "wb"));
+		gzwrite(gzip, archive.data(), static_cast<unsigned int>(archive.size()));
+		gzclose(gzip);
+	};
+
+	virtual void TearDown()
+	{
+		std::remove(tarName.c_str());
+		std::remove(gzipName.c_str());
+	};
+
+	std::string tarName, gzipName, longName, source;
+	std::string archive;
+
+	void AddEntry(const std::string &name, const std::string &contents, const char &type);
+	void ExpectEntries(const std::string &fileName);
+};
+
+void ArchiveReaderTest::AddEntry(const std::string &name, const std::string &contents,
+	const char &type)
+{
+	char header[512] = {};
+	strncpy(header, name.c_str(), 100);
+	sprintf(header + 100, "%07o", 0644);
+	sprintf(header + 124, "%011o", static_cast<unsigned int>(contents.size()));
+	header[156] = type;
+	memcpy(header + 257, "ustar", 6);
+	memcpy(header + 263, "00", 2);
+
+	memset(header + 148, ' ', 8);
+	unsigned int checksum(0), i;
+	for (i = 0; i < sizeof(header); i++)
+		checksum += static_cast<unsigned char>(header[i]);
+	sprintf(header + 148, "%06o", checksum);
+
+	archive.append(header, sizeof(header));
+	archive.append(contents);
+	archive.append((512 - contents.size() % 512) % 512, '\0');
+}
+
+void ArchiveReaderTest::ExpectEntries(const std::string &fileName)
+{
+	ArchiveReader reader;
+	ASSERT_TRUE(reader.Open(fileName));
+
+	std::string name, contents;
+	unsigned long long size;
+	ASSERT_TRUE(reader.NextEntry(name, size));
+	EXPECT_EQ("dir/a.cpp", name);
+	ASSERT_EQ(source.size(), size);
+
+	// Read in small pieces to cross buffer boundaries
+	char buffer[7];
+	size_t count;
+	while ((count = reader.Read(buffer, sizeof(buffer))) > 0)
+		contents.append(buffer, count);
+	EXPECT_EQ(source, contents);
+
+	ASSERT_TRUE(reader.NextEntry(name, size));
+	EXPECT_EQ(longName, name);
+	EXPECT_EQ(7u, size);// Skipped without reading
+
+	ASSERT_TRUE(reader.NextEntry(name, size));
+	EXPECT_EQ("empty.h", name);
+	EXPECT_EQ(0u, size);
+
+	EXPECT_FALSE(reader.NextEntry(name, size));
+	EXPECT_FALSE(reader.HasFailed());
+}
+
+TEST_F(ArchiveReaderTest, ReadsTar)
+{
+	ExpectEntries(tarName);
+}
+
+TEST_F(ArchiveReaderTest, ReadsGzippedTar)
+{
+	ExpectEntries(gzipName);
+}
+
+TEST_F(ArchiveReaderTest, RejectsCorruptHeader)
+{
+	archive[148] = '7';
+	std::ofstream tar(tarName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	tar.write(archive.data(), archive.size());
+	tar.close();
+
+	ArchiveReader reader;
+	ASSERT_TRUE(reader.Open(tarName));
+	std::string name;
+	unsigned long long size;
+	EXPECT_FALSE(reader.NextEntry(name, size));
+	EXPECT_TRUE(reader.HasFailed());
+}
+
+TEST_F(ArchiveReaderTest, StreamedChunksMatchBuffer)
+{
+	std::vector<std::string> comments(1, "//");
+	std::vector<std::pair<std::string, std::string> > blockComments(1,
+		std::make_pair(std::string("/*"), std::string("*/")));
+	std::vector<std::string> continuation(1, "\\");
+
+	LineCounter buffered(comments, blockComments, continuation);
+	buffered.ProcessBuffer(source.data(), source.size());
+
+	size_t chunkSize, i;
+	for (chunkSize = 1; chunkSize <= source.size(); chunkSize++)
+	{
+		LineCounter streamed(comments, blockComments, continuation);
+		streamed.BeginStream();
+		for (i = 0; i < source.size(); i += chunkSize)
+			streamed.ProcessChunk(source.data() + i, std::min(chunkSize, source.size() - i));
+		streamed.EndStream();
+
+		EXPECT_EQ(buffered.GetStatistics().blankLines, streamed.GetStatistics().blankLines);
+		EXPECT_EQ(buffered.GetStatistics().commentLines, streamed.GetStatistics().commentLines);
+		EXPECT_EQ(buffered.GetStatistics().codeLines, streamed.GetStatistics().codeLines);
+		EXPECT_EQ(1u, streamed.GetStatistics().fileCount);
+	}
+}
+
+TEST_F(ArchiveReaderTest, StoppedStreamCountsOnlyCompleteLines)
+{
+	std::vector<std::string> comments(1, "//");
+	std::vector<std::pair<std::string, std::string> > blockComments(1,
+		std::make_pair(std::string("/*"), std::string("*/")));
+	std::vector<std::string> continuation(1, "\\");
+
+	// Three complete lines and the start of a fourth
+	const size_t parsedBytes(20);
+	LineCounter streamed(comments, blockComments, continuation);
+	streamed.BeginStream();
+	streamed.ProcessChunk(source.data(), parsedBytes);
+	streamed.StopStream(parsedBytes);
+
+	EXPECT_TRUE(streamed.WasStopped());
+	EXPECT_EQ(parsedBytes, streamed.GetParsedBytes());
+	EXPECT_EQ(1u, streamed.GetStatistics().blankLines);
+	EXPECT_EQ(1u, streamed.GetStatistics().commentLines);
+	EXPECT_EQ(1u, streamed.GetStatistics().codeLines);
+	EXPECT_EQ(0u, streamed.GetStatistics().fileCount);
+
+	// The next file starts over
+	streamed.BeginStream();
+	streamed.ProcessChunk(source.data(), source.size());
+	streamed.EndStream();
+	EXPECT_FALSE(streamed.WasStopped());
+	EXPECT_EQ(1u, streamed.GetStatistics().fileCount);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,147 @@
+// File:  boundedQueueTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for the queue between pipeline stages.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "boundedQueue.h"
+
+// Long enough for a thread which isn't blocked to have run
+static const std::chrono::milliseconds settleTime(100);
+
+TEST(BoundedQueueTest, FirstInFirstOut)
+{
+	BoundedQueue<int> queue(10);
+	queue.Push(1);
+	queue.Push(2);
+	queue.Push(3);
+	queue.Close();
+
+	int item;
+	ASSERT_TRUE(queue.Pop(item));
+	EXPECT_EQ(1, item);
+	ASSERT_TRUE(queue.Pop(item));
+	EXPECT_EQ(2, item);
+	ASSERT_TRUE(queue.Pop(item));
+	EXPECT_EQ(3, item);
+	EXPECT_FALSE(queue.Pop(item));
+}
+
+TEST(BoundedQueueTest, BlocksAtWeightLimit)
+{
+	BoundedQueue<int> queue(10);
+	queue.Push(1, 6);
+	queue.Push(2, 4);
+
+	std::atomic<bool> pushed(false);
+	std::thread producer([&queue, &pushed]() { queue.Push(3, 5); pushed = true; });
+	std::this_thread::sleep_for(settleTime);
+	EXPECT_FALSE(pushed);
+
+	int item;
+	ASSERT_TRUE(queue.Pop(item));
+	EXPECT_EQ(1, item);
+	producer.join();
+	EXPECT_TRUE(pushed);
+
+	ASSERT_TRUE(queue.Pop(item));
+	EXPECT_EQ(2, item);
+	ASSERT_TRUE(queue.Pop(item));
+	EXPECT_EQ(3, item);
+}
+
+TEST(BoundedQueueTest, WaitsForRoomForHeavyItem)
+{
+	BoundedQueue<int> queue(10);
+	queue.Push(1, 4);
+	queue.Push(2, 4);
+
+	std::atomic<bool> pushed(false);
+	std::thread producer([&queue, &pushed]() { queue.Push(3, 8); pushed = true; });
+
+	// Removing one item doesn't make enough room
+	int item;
+	ASSERT_TRUE(queue.Pop(item));
+	std::this_thread::sleep_for(settleTime);
+	EXPECT_FALSE(pushed);
+
+	ASSERT_TRUE(queue.Pop(item));
+	producer.join();
+	EXPECT_TRUE(pushed);
+}
+
+TEST(BoundedQueueTest, AcceptsOversizedItemWhenEmpty)
+{
+	BoundedQueue<int> queue(10);
+	queue.Push(1, 100);
+
+	int item;
+	ASSERT_TRUE(queue.Pop(item));
+	EXPECT_EQ(1, item);
+}
+
+TEST(BoundedQueueTest, CloseWakesWaitingConsumers)
+{
+	BoundedQueue<int> queue(10);
+	std::atomic<unsigned int> finished(0);
+	std::vector<std::thread> consumers;
+	unsigned int i;
+	for (i = 0; i < 4; i++)
+	{
+		consumers.push_back(std::thread([&queue, &finished]()
+		{
+			int item;
+			while (queue.Pop(item))
+				;
+			finished++;
+		}));
+	}
+
+	queue.Push(1);
+	std::this_thread::sleep_for(settleTime);
+	EXPECT_EQ(0U, finished);
+
+	queue.Close();
+	for (i = 0; i < consumers.size(); i++)
+		consumers[i].join();
+	EXPECT_EQ(consumers.size(), finished);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
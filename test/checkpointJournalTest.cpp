@@ -0,0 +1,270 @@
+// File:  checkpointJournalTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for the checkpoint journal used to resume interrupted runs.
+
+// Standard C++ headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "checkpointJournal.h"
+
+class CheckpointJournalTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		fileName = "checkpointJournalTest.tmp";
+		std::remove(fileName.c_str());
+	};
+
+	virtual void TearDown()
+	{
+		std::remove(fileName.c_str());
+	};
+
+	std::string fileName;
+
+	static FileEntry MakeEntry(const std::string &path, const unsigned long long &size = 0)
+	{
+		FileEntry entry;
+		entry.path = path;
+		entry.size = size;
+		entry.device = 0;
+		entry.inode = 0;
+		return entry;
+	};
+
+	static LineCounter::Statistics MakeStatistics(const unsigned long long &blank,
+		const unsigned long long &comment, const unsigned long long &code)
+	{
+		LineCounter::Statistics statistics;
+		statistics.blankLines = blank;
+		statistics.commentLines = comment;
+		statistics.codeLines = code;
+		statistics.fileCount = 1;
+		return statistics;
+	};
+
+	std::vector<std::string> ReadLines(void) const
+	{
+		std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+		std::vector<std::string> lines;
+		std::string line;
+		while (std::getline(file, line))
+			lines.push_back(line);
+		return lines;
+	};
+
+	// Searches "root/" (containing b.cpp) and "root/a/" (containing x.cpp and
+	// y.cpp), and counts all but y.cpp
+	void RunPartialSearch(CheckpointJournal &journal)
+	{
+		journal.OnDirectoryEntered("root/");
+		journal.OnDirectoryEntered("root/a/");
+		EXPECT_TRUE(journal.OnFileFound("root/a/x.cpp"));
+		EXPECT_TRUE(journal.OnFileFound("root/a/y.cpp"));
+		journal.OnDirectorySearched("root/a/");
+		EXPECT_TRUE(journal.OnFileFound("root/b.cpp"));
+		journal.OnDirectorySearched("root/");
+
+		journal.OnFileResult(MakeEntry("root/a/x.cpp"), MakeStatistics(1, 2, 3));
+		journal.OnFileResult(MakeEntry("root/b.cpp"), MakeStatistics(4, 5, 6));
+	};
+};
+
+class ResultCollector : public FileResultHandler
+{
+public:
+	virtual void OnFileResult(const FileEntry &entry,
+		const LineCounter::Statistics &statistics)
+	{
+		paths.push_back(entry.path);
+		codeLines.push_back(statistics.codeLines);
+	};
+
+	std::vector<std::string> paths;
+	std::vector<unsigned long long> codeLines;
+};
+
+TEST_F(CheckpointJournalTest, RecordsDirectoriesAfterTheirFiles)
+{
+	{
+		CheckpointJournal journal;
+		ASSERT_TRUE(journal.Open(fileName, false));
+		RunPartialSearch(journal);
+		journal.OnFileResult(MakeEntry("root/a/y.cpp"), MakeStatistics(0, 0, 7));
+		EXPECT_TRUE(journal.Close());
+	}
+
+	const std::vector<std::string> lines(ReadLines());
+	ASSERT_EQ(6U, lines.size());
+	EXPECT_EQ("LineCounter checkpoint 2", lines[0]);
+	EXPECT_EQ("F 1 1 2 3 0 0 root/a/x.cpp", lines[1]);
+	EXPECT_EQ("F 1 4 5 6 0 0 root/b.cpp", lines[2]);
+	EXPECT_EQ("F 1 0 0 7 0 0 root/a/y.cpp", lines[3]);
+	EXPECT_EQ("D root/a/", lines[4]);
+	EXPECT_EQ("D root/", lines[5]);
+}
+
+TEST_F(CheckpointJournalTest, ResumesCompletedWork)
+{
+	{
+		CheckpointJournal journal;
+		ASSERT_TRUE(journal.Open(fileName, false));
+		RunPartialSearch(journal);
+		journal.OnDirectoryEntered("other/");
+		EXPECT_TRUE(journal.OnFileFound("other/z.cpp"));
+		journal.OnDirectorySearched("other/");
+		journal.OnFileSkipped(MakeEntry("other/z.cpp", 100), ContentClassifier::ContentGenerated);
+		EXPECT_TRUE(journal.Close());
+	}
+
+	CheckpointJournal journal;
+	ResultCollector collector;
+	ASSERT_TRUE(journal.Open(fileName, true, &collector));
+
+	EXPECT_TRUE(journal.IsDirectoryComplete("other/"));
+	EXPECT_FALSE(journal.IsDirectoryComplete("root/"));
+	EXPECT_FALSE(journal.IsDirectoryComplete("root/a/"));
+	EXPECT_EQ(1U, journal.GetResumedDirectoryCount());
+
+	journal.OnDirectoryEntered("root/");
+	journal.OnDirectoryEntered("root/a/");
+	EXPECT_FALSE(journal.OnFileFound("root/a/x.cpp"));
+	EXPECT_TRUE(journal.OnFileFound("root/a/y.cpp"));
+	journal.OnDirectorySearched("root/a/");
+	EXPECT_FALSE(journal.OnFileFound("root/b.cpp"));
+	journal.OnDirectorySearched("root/");
+	journal.OnFileResult(MakeEntry("root/a/y.cpp"), MakeStatistics(0, 0, 7));
+	EXPECT_TRUE(journal.Close());
+
+	const LineCounter::Statistics &resumed(journal.GetResumedStatistics());
+	EXPECT_EQ(2U, resumed.fileCount);
+	EXPECT_EQ(5U, resumed.blankLines);
+	EXPECT_EQ(7U, resumed.commentLines);
+	EXPECT_EQ(9U, resumed.codeLines);
+	EXPECT_EQ(1U, journal.GetResumedSkipCount(ContentClassifier::ContentGenerated));
+	EXPECT_EQ(100U, journal.GetResumedSkipBytes(ContentClassifier::ContentGenerated));
+
+	ASSERT_EQ(2U, collector.paths.size());
+	EXPECT_EQ("root/a/x.cpp", collector.paths[0]);
+	EXPECT_EQ(3U, collector.codeLines[0]);
+
+	const std::vector<std::string> lines(ReadLines());
+	ASSERT_EQ(8U, lines.size());
+	EXPECT_EQ("S 2 100 0 0 other/z.cpp", lines[3]);
+	EXPECT_EQ("D other/", lines[4]);
+	EXPECT_EQ("F 1 0 0 7 0 0 root/a/y.cpp", lines[5]);
+	EXPECT_EQ("D root/a/", lines[6]);
+	EXPECT_EQ("D root/", lines[7]);
+}
+
+TEST_F(CheckpointJournalTest, DiscardsIncompleteRecord)
+{
+	{
+		std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+		file << "LineCounter checkpoint 2\nF 1 1 1 1 0 0 a.cpp\nF 1 2";
+	}
+
+	{
+		CheckpointJournal journal;
+		ASSERT_TRUE(journal.Open(fileName, true));
+		EXPECT_EQ(1U, journal.GetResumedStatistics().fileCount);
+		EXPECT_FALSE(journal.OnFileFound("a.cpp"));
+		EXPECT_TRUE(journal.OnFileFound("b.cpp"));
+		journal.OnFileResult(MakeEntry("b.cpp"), MakeStatistics(2, 2, 2));
+		EXPECT_TRUE(journal.Close());
+	}
+
+	const std::vector<std::string> lines(ReadLines());
+	ASSERT_EQ(3U, lines.size());
+	EXPECT_EQ("F 1 2 2 2 0 0 b.cpp", lines[2]);
+}
+
+TEST_F(CheckpointJournalTest, RestoresIdsOfCompletedFiles)
+{
+	{
+		CheckpointJournal journal;
+		ASSERT_TRUE(journal.Open(fileName, false));
+		FileEntry counted(MakeEntry("root/a/x.cpp", 10)), skipped(MakeEntry("root/b.cpp", 20));
+		counted.device = 5;
+		counted.inode = 7;
+		skipped.device = 5;
+		skipped.inode = 8;
+		journal.OnDirectoryEntered("root/");
+		EXPECT_TRUE(journal.OnFileFound(counted.path));
+		EXPECT_TRUE(journal.OnFileFound(skipped.path));
+		journal.OnDirectorySearched("root/");
+		journal.OnFileResult(counted, MakeStatistics(1, 2, 3));
+		journal.OnFileSkipped(skipped, ContentClassifier::ContentBinary);
+		EXPECT_TRUE(journal.Close());
+	}
+
+	const std::vector<std::string> lines(ReadLines());
+	ASSERT_EQ(4U, lines.size());
+	EXPECT_EQ("F 1 1 2 3 5 7 root/a/x.cpp", lines[1]);
+	EXPECT_EQ("S 1 20 5 8 root/b.cpp", lines[2]);
+
+	// Including the files in completed directories
+	CheckpointJournal journal;
+	ASSERT_TRUE(journal.Open(fileName, true));
+	EXPECT_EQ(1ULL, journal.GetResumedDirectoryCount());
+	FileIdSet ids;
+	journal.AddCompletedFileIds(ids);
+	EXPECT_FALSE(ids.Insert(5, 7));
+	EXPECT_FALSE(ids.Insert(5, 8));
+	EXPECT_TRUE(ids.Insert(5, 9));
+}
+
+TEST_F(CheckpointJournalTest, RejectsInvalidJournal)
+{
+	{
+		std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+		file << "LineCounter checkpoint 2\nF 1 x 1 1 0 0 a.cpp\n";
+	}
+
+	CheckpointJournal journal;
+	EXPECT_FALSE(journal.Open(fileName, true));
+
+	// A missing journal just means starting from the beginning
+	std::remove(fileName.c_str());
+	CheckpointJournal newJournal;
+	EXPECT_TRUE(newJournal.Open(fileName, true));
+	EXPECT_EQ(0U, newJournal.GetResumedStatistics().fileCount);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,223 @@
+// File:  chunkedParserTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for chunked (parallel) parser class.
+
+// Standard C++ headers
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+#include <chrono>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "chunkedParser.h"
+#include "lineCounter.h"
+#include "deadline.h"
+
+class ChunkedParserTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		comments.push_back("//");
+		comments.push_back("#");
+		blockComments.push_back(std::make_pair(std::string("/*"), std::string("*/")));
+		blockComments.push_back(std::make_pair(std::string("<!--"), std::string("-->")));
+		lineContinuation.push_back("\\");
+		fileName = "chunkedParserTest.tmp";
+	};
+
+	virtual void TearDown() { std::remove(fileName.c_str()); };
+
+	std::vector<std::string> comments;
+	std::vector<std::pair<std::string, std::string> > blockComments;
+	std::vector<std::string> lineContinuation;
+	std::string fileName;
+
+	void WriteRandomFile(const unsigned int &lineCount, const unsigned int &seed);
+	void ExpectSerialResults(const unsigned int &threadCount, ThreadBudget *budget = NULL);
+
+	static const std::string codeLine;
+	void WriteCodeFile(const unsigned int &lineCount);
+	static void ExpireDeadline(Deadline &deadline);
+};
+
+const std::string ChunkedParserTest::codeLine("code();\n");
+
+void ChunkedParserTest::WriteRandomFile(const unsigned int &lineCount, const unsigned int &seed)
+{
+	const char* fragments[] = { "code();", " ", "\t", "/*", "*/", "<!--", "-->",
+		"//", "#", "\\", "x", "" };
+	const unsigned int fragmentCount(sizeof(fragments) / sizeof(fragments[0]));
+
+	srand(seed);
+	std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+	unsigned int i, j;
+	for (i = 0; i < lineCount; i++)
+	{
+		const unsigned int length(rand() % 6);
+		for (j = 0; j < length; j++)
+			file << fragments[rand() % fragmentCount];
+		file << '\n';
+	}
+
+	file << "no newline at the end";
+}
+
+void ChunkedParserTest::WriteCodeFile(const unsigned int &lineCount)
+{
+	std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+	unsigned int i;
+	for (i = 0; i < lineCount; i++)
+		file << codeLine;
+}
+
+void ChunkedParserTest::ExpireDeadline(Deadline &deadline)
+{
+	deadline.Set(1);
+	while (!deadline.HasPassed())
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+void ChunkedParserTest::ExpectSerialResults(const unsigned int &threadCount, ThreadBudget *budget)
+{
+	LineCounter serial(comments, blockComments, lineContinuation);
+	ASSERT_TRUE(serial.ProcessFile(fileName));
+
+	std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+	const unsigned long long fileSize(file.tellg());
+
+	SourceParser prototype(comments, blockComments, lineContinuation);
+	ChunkedParser chunked(prototype, threadCount, budget);
+	LineCounter::Statistics statistics = {};
+	unsigned long long parsedBytes;
+	ASSERT_TRUE(chunked.ProcessFile(fileName, fileSize, statistics, parsedBytes));
+	EXPECT_EQ(fileSize, parsedBytes);
+
+	EXPECT_EQ(serial.GetStatistics().blankLines, statistics.blankLines);
+	EXPECT_EQ(serial.GetStatistics().commentLines, statistics.commentLines);
+	EXPECT_EQ(serial.GetStatistics().codeLines, statistics.codeLines);
+}
+
+TEST_F(ChunkedParserTest, MatchesSerialParsing)
+{
+	unsigned int seed, threads;
+	for (seed = 1; seed < 20; seed++)
+	{
+		WriteRandomFile(2000, seed);
+		for (threads = 1; threads <= 9; threads++)
+			ExpectSerialResults(threads);
+	}
+}
+
+TEST_F(ChunkedParserTest, HandlesMoreChunksThanLines)
+{
+	WriteRandomFile(3, 1);
+	ExpectSerialResults(64);
+}
+
+TEST_F(ChunkedParserTest, UsesOnlyAvailableThreads)
+{
+	WriteRandomFile(2000, 1);
+
+	// The calling thread is already counted against the budget
+	ThreadBudget budget(3);
+	budget.Acquire();
+	ExpectSerialResults(8, &budget);
+	EXPECT_EQ(2U, budget.TryAcquire(8));
+
+	// With no threads to spare, the whole file is parsed by the calling thread
+	ExpectSerialResults(8, &budget);
+	EXPECT_EQ(0U, budget.TryAcquire(1));
+
+	budget.Release(3);
+	EXPECT_EQ(3U, budget.TryAcquire(8));
+}
+
+TEST_F(ChunkedParserTest, StopsAtDeadline)
+{
+	const unsigned int lineCount(100000);
+	WriteCodeFile(lineCount);
+	Deadline deadline;
+	ExpireDeadline(deadline);
+
+	ChunkedParser chunked(SourceParser(comments, blockComments, lineContinuation), 4);
+	chunked.SetDeadline(&deadline);
+	LineCounter::Statistics statistics = {};
+	unsigned long long parsedBytes;
+	ASSERT_TRUE(chunked.ProcessFile(fileName, lineCount * codeLine.length(),
+		statistics, parsedBytes));
+
+	// Only the start of the first chunk is counted, since the state at its end
+	// (and so at the start of the next chunk) is unknown
+	const unsigned long long parsedLines(LineCounter::linesPerDeadlineCheck - 1);
+	EXPECT_EQ(parsedLines * codeLine.length(), parsedBytes);
+	EXPECT_EQ(parsedLines, statistics.codeLines);
+	EXPECT_EQ(0ULL, statistics.blankLines + statistics.commentLines);
+}
+
+TEST_F(ChunkedParserTest, LargeFileIsCutShortAtDeadline)
+{
+	const unsigned int lineCount(100000);
+	WriteCodeFile(lineCount);
+	Deadline deadline;
+	ExpireDeadline(deadline);
+
+	unsigned int threads;
+	for (threads = 1; threads <= 4; threads += 3)
+	{
+		LineCounter counter(comments, blockComments, lineContinuation);
+		counter.SetParallelParsing(threads, 0);
+		counter.SetDeadline(&deadline);
+		ASSERT_TRUE(counter.ProcessFile(fileName));
+
+		// The lines parsed so far are counted, but not the file
+		EXPECT_TRUE(counter.WasStopped());
+		EXPECT_EQ(0ULL, counter.GetStatistics().fileCount);
+		EXPECT_GT(counter.GetStatistics().codeLines, 0ULL);
+		EXPECT_LT(counter.GetStatistics().codeLines, lineCount);
+		EXPECT_EQ(counter.GetStatistics().codeLines * codeLine.length(), counter.GetParsedBytes());
+	}
+
+	// Without a deadline, the same counter finishes the file
+	LineCounter counter(comments, blockComments, lineContinuation);
+	Deadline unset;
+	counter.SetDeadline(&unset);
+	ASSERT_TRUE(counter.ProcessFile(fileName));
+	EXPECT_FALSE(counter.WasStopped());
+	EXPECT_EQ(1ULL, counter.GetStatistics().fileCount);
+	EXPECT_EQ(lineCount, counter.GetStatistics().codeLines);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
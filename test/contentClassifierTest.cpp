@@ -0,0 +1,178 @@
+// File:  contentClassifierTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for binary, generated and minified file detection.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <string>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "contentClassifier.h"
+
+using namespace ContentClassifier;
+
+// Source file saved in Latin-1 (the copyright sign and u with umlaut are
+// single bytes, which are not valid UTF-8)
+static const char latin1Source[] =
+	"// File:  gr\xfc\xdf" "e.cpp\n"
+	"// \xa9 2008 J\xfcrgen M\xfcller\n"
+	"\n"
+	"#include <iostream>\n"
+	"\n"
+	"int main()\n"
+	"{\n"
+	"\tstd::cout << \"Gr\xfc\xdf Gott, \xa9 J\xfcrgen\" << std::endl;// \xe0 bient\xf4t\n"
+	"\treturn 0;\n"
+	"}\n";
+
+static ContentType ClassifyString(const std::string &s, const bool &complete = true)
+{
+	return Classify(s.data(), s.length(), complete);
+}
+
+TEST(ContentClassifierTest, AcceptsSource)
+{
+	EXPECT_EQ(ContentSource, ClassifyString(""));
+	EXPECT_EQ(ContentSource, ClassifyString("int main()\n{\n\treturn 0;\n}\n"));
+	EXPECT_EQ(ContentSource, ClassifyString("// caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80\n"));
+}
+
+TEST(ContentClassifierTest, DetectsBinary)
+{
+	EXPECT_EQ(ContentBinary, ClassifyString(std::string("abc\0def", 7)));
+
+	// Many control characters, with or without invalid UTF-8
+	EXPECT_EQ(ContentBinary, ClassifyString("\x01\x02\x03\x04" "abcdefgh\x7f\x1b\x05\x06"));
+	EXPECT_EQ(ContentBinary, ClassifyString(std::string(200, 'a') + "\x01\x02\x03\xff\xfe"));
+
+	// UTF-16 text contains NUL bytes, but is recognized by its byte order mark
+	EXPECT_EQ(ContentSource, ClassifyString(std::string("\xff\xfei\0n\0t\0\n\0", 10)));
+	EXPECT_EQ(ContentSource, ClassifyString(std::string("\xfe\xff\0i\0n\0t\0\n", 10)));
+}
+
+TEST(ContentClassifierTest, AcceptsLegacyEncodings)
+{
+	EXPECT_FALSE(IsValidUtf8(latin1Source, sizeof(latin1Source) - 1, true));
+	EXPECT_EQ(ContentSource, ClassifyString(latin1Source));
+	EXPECT_EQ(ContentSource, ClassifyString("latin-1 caf\xe9\n"));
+	EXPECT_EQ(ContentSource, ClassifyString("// CP1252 \x93quotes\x94 \x80 \x85\f\n"));
+}
+
+TEST(ContentClassifierTest, CountsControlCharacters)
+{
+	EXPECT_EQ(0U, CountControlCharacters("\t\n\v\f\r text \xe9", 12));
+	EXPECT_EQ(3U, CountControlCharacters("\x01" "a\x1b\x7f", 4));
+}
+
+TEST(ContentClassifierTest, ValidatesUtf8)
+{
+	EXPECT_TRUE(IsValidUtf8("plain ascii text, longer than eight bytes", 41, true));
+
+	// Invalid bytes at each position of the blocks checked at once
+	std::string ascii(40, 'a');
+	unsigned int i;
+	for (i = 0; i < ascii.length(); i++)
+	{
+		std::string text(ascii);
+		text[i] = '\x80';
+		EXPECT_FALSE(IsValidUtf8(text.data(), text.length(), true)) << i;
+		text[i] = '\x7f';
+		EXPECT_TRUE(IsValidUtf8(text.data(), text.length(), true)) << i;
+	}
+	EXPECT_TRUE(IsValidUtf8("\xed\x9f\xbf", 3, true));// U+D7FF
+	EXPECT_TRUE(IsValidUtf8("\xf4\x8f\xbf\xbf", 4, true));// U+10FFFF
+
+	EXPECT_FALSE(IsValidUtf8("\xc0\xaf", 2, true));// Overlong
+	EXPECT_FALSE(IsValidUtf8("\xe0\x80\xaf", 3, true));// Overlong
+	EXPECT_FALSE(IsValidUtf8("\xed\xa0\x80", 3, true));// Surrogate
+	EXPECT_FALSE(IsValidUtf8("\xf4\x90\x80\x80", 4, true));// Beyond U+10FFFF
+	EXPECT_FALSE(IsValidUtf8("\x80", 1, true));// Unexpected continuation
+
+	// Sequences cut off by the end of a partial read are allowed
+	EXPECT_FALSE(IsValidUtf8("abc\xe2\x82", 5, true));
+	EXPECT_TRUE(IsValidUtf8("abc\xe2\x82", 5, false));
+}
+
+TEST(ContentClassifierTest, DetectsGenerated)
+{
+	EXPECT_EQ(ContentGenerated, ClassifyString("// Code generated by protoc.  DO NOT EDIT.\n"));
+	EXPECT_EQ(ContentGenerated, ClassifyString("/* @generated */\nint x;\n"));
+	EXPECT_EQ(ContentGenerated, ClassifyString("\n#!/bin/sh\n# Autogenerated by configure\n"));
+	EXPECT_EQ(ContentGenerated, ClassifyString("/*\n * Copyright\n *\n * DO NOT EDIT\n */\n"));
+	EXPECT_EQ(ContentSource, ClassifyString("const char *marker = \"do not edit\";\n"));
+
+	// Markers are only expected near the top of the file
+	EXPECT_EQ(ContentSource, ClassifyString(std::string(2000, '\n') + "// do not edit\n"));
+}
+
+TEST(ContentClassifierTest, IgnoresMarkersAfterCode)
+{
+	// Hand-written files which mention the markers in code or in comments
+	// after the first code are counted
+	EXPECT_EQ(ContentSource, ClassifyString("// Parser\n#include <string>\n"
+		"// The output is autogenerated; do not edit it\nint x;\n"));
+	EXPECT_EQ(ContentSource, ClassifyString("int x;/* @generated */\n"));
+	EXPECT_EQ(ContentSource, ClassifyString("#define WARNING Do not edit\n"));
+	EXPECT_EQ(ContentSource, ClassifyString("/* Header */ int autogenerated = 0;\n"));
+
+	const std::string file("// Header\n\n# Note\nint x;// do not edit\n");
+	EXPECT_EQ("// header\n\n# note\n", GetLeadingComments(file.data(), file.length()));
+}
+
+TEST(ContentClassifierTest, DetectsMinified)
+{
+	std::string line;
+	while (line.length() < 3000)
+		line.append("var a=function(b){return b+1};");
+	EXPECT_EQ(ContentMinified, ClassifyString(line + "\n"));
+
+	std::string lines;
+	while (lines.length() < 3000)
+		lines.append("var a = function(b) { return b + 1; };\n");
+	EXPECT_EQ(ContentSource, ClassifyString(lines));
+}
+
+TEST(ContentClassifierTest, CountsSkippedFiles)
+{
+	SkipCounter counter;
+	counter.Add(ContentBinary, 100);
+	counter.Add(ContentBinary, 50);
+	counter.Add(ContentMinified, 7);
+	EXPECT_EQ(2u, counter.GetFileCount(ContentBinary));
+	EXPECT_EQ(150u, counter.GetBytes(ContentBinary));
+	EXPECT_EQ(0u, counter.GetFileCount(ContentGenerated));
+	EXPECT_EQ(7u, counter.GetBytes(ContentMinified));
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
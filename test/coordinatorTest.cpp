@@ -0,0 +1,152 @@
+// File:  coordinatorTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for coordinator class and partial results, using threads
+//        in this process to stand in for worker processes.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "coordinator.h"
+#include "connection.h"
+#include "partialResults.h"
+
+// Counts each shard as one file with (shard + 1) lines of code.  If failAfter
+// is non-zero, disconnects after receiving that many shards, without
+// returning the result for the last one.
+static void FakeWorker(const unsigned short port, const unsigned int failAfter)
+{
+	Connection connection;
+	if (!connection.Connect("127.0.0.1", port))
+		return;
+
+	unsigned int received(0);
+	std::string line;
+	while (connection.WriteLine("NEXT") && connection.ReadLine(line) && line != "DONE")
+	{
+		std::istringstream request(line);
+		std::string keyword;
+		unsigned int shard;
+		request >> keyword >> shard;
+
+		if (++received == failAfter)
+			return;
+
+		LineCounter::Statistics statistics;
+		PartialResults::Clear(statistics);
+		statistics.fileCount = 1;
+		statistics.codeLines = shard + 1;
+
+		std::ostringstream result;
+		result << "RESULT " << shard << " " << PartialResults::Format(statistics);
+		connection.WriteLine(result.str());
+	}
+}
+
+TEST(PartialResultsTest, FormatParseRoundTrip)
+{
+	LineCounter::Statistics in, out;
+	in.fileCount = 4;
+	in.blankLines = 3;
+	in.commentLines = 2;
+	in.codeLines = 1;
+	ASSERT_TRUE(PartialResults::Parse(PartialResults::Format(in), out));
+	EXPECT_EQ(in.fileCount, out.fileCount);
+	EXPECT_EQ(in.blankLines, out.blankLines);
+	EXPECT_EQ(in.commentLines, out.commentLines);
+	EXPECT_EQ(in.codeLines, out.codeLines);
+
+	EXPECT_FALSE(PartialResults::Parse("files 1 blank 2", out));
+}
+
+TEST(CoordinatorTest, MergesResultsFromSeveralWorkers)
+{
+	const unsigned int shardCount(10);
+	Coordinator coordinator(shardCount, false);
+	ASSERT_TRUE(coordinator.Listen(0));
+
+	std::vector<std::thread> workers;
+	unsigned int i;
+	for (i = 0; i < 3; i++)
+		workers.push_back(std::thread(FakeWorker, coordinator.GetPort(), 0));
+
+	LineCounter::Statistics statistics;
+	ASSERT_TRUE(coordinator.Run(statistics));
+	for (i = 0; i < workers.size(); i++)
+		workers[i].join();
+
+	EXPECT_EQ(shardCount, statistics.fileCount);
+	EXPECT_EQ(shardCount * (shardCount + 1) / 2, statistics.codeLines);
+}
+
+TEST(CoordinatorTest, ReassignsShardsFromFailedWorkers)
+{
+	const unsigned int shardCount(6);
+	Coordinator coordinator(shardCount, true);
+	ASSERT_TRUE(coordinator.Listen(0));
+
+	LineCounter::Statistics statistics;
+	bool ok(false);
+	std::thread running([&coordinator, &statistics, &ok]() { ok = coordinator.Run(statistics); });
+
+	// The second worker only starts once the first has failed
+	std::thread failing(FakeWorker, coordinator.GetPort(), 2);
+	failing.join();
+	std::thread working(FakeWorker, coordinator.GetPort(), 0);
+
+	running.join();
+	working.join();
+	ASSERT_TRUE(ok);
+
+	EXPECT_EQ(shardCount, statistics.fileCount);
+	EXPECT_EQ(shardCount * (shardCount + 1) / 2, statistics.codeLines);
+}
+
+TEST(ListenerTest, ListensOnRequestedInterface)
+{
+	Listener loopback;
+	ASSERT_TRUE(loopback.Listen(0));
+
+	Connection client, server;
+	ASSERT_TRUE(client.Connect("127.0.0.1", loopback.GetPort()));
+	EXPECT_TRUE(loopback.Accept(server, 1000));
+
+	Listener invalid;
+	EXPECT_FALSE(invalid.Listen(0, "not an address"));
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,214 @@
+// File:  diffCounterTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for unified diff line counting class.
+
+// Standard C++ headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "diffCounter.h"
+
+class DiffCounterTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		comments.push_back("//");
+		blockComments.push_back(std::make_pair(std::string("/*"), std::string("*/")));
+		lineContinuation.push_back("\\");
+		fileName = "diffCounterTest.c";
+	};
+
+	virtual void TearDown() { std::remove(fileName.c_str()); };
+
+	std::vector<std::string> comments;
+	std::vector<std::pair<std::string, std::string> > blockComments;
+	std::vector<std::string> lineContinuation;
+	std::string fileName;
+
+	void WriteFile(const std::string &contents) const
+	{
+		std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+		file << contents;
+	};
+
+	static void ExpectCounts(const LineCounter::Statistics &statistics,
+		const unsigned long long &code, const unsigned long long &comment,
+		const unsigned long long &blank)
+	{
+		EXPECT_EQ(code, statistics.codeLines);
+		EXPECT_EQ(comment, statistics.commentLines);
+		EXPECT_EQ(blank, statistics.blankLines);
+	};
+};
+
+TEST_F(DiffCounterTest, CountsNewAndDeletedFiles)
+{
+	std::istringstream diff(
+		"diff --git a/new.c b/new.c\n"
+		"new file mode 100644\n"
+		"index 0000000..1111111\n"
+		"--- /dev/null\n"
+		"+++ b/new.c\n"
+		"@@ -0,0 +1,4 @@\n"
+		"+/* header\n"
+		"+*/\n"
+		"+\n"
+		"+int x;\n"
+		"diff --git a/old.c b/old.c\n"
+		"deleted file mode 100644\n"
+		"--- a/old.c\n"
+		"+++ /dev/null\n"
+		"@@ -1,2 +0,0 @@\n"
+		"-// old\n"
+		"-int y;\n"
+		"\\ No newline at end of file\n");
+
+	DiffCounter counter(diff, std::string(), comments, blockComments, lineContinuation);
+	std::string path;
+	DiffCounter::Delta delta;
+
+	ASSERT_TRUE(counter.NextFile(path));
+	EXPECT_EQ("new.c", path);
+	counter.CountFile(delta);
+	ExpectCounts(delta.added, 1, 2, 1);
+	ExpectCounts(delta.removed, 0, 0, 0);
+	EXPECT_TRUE(delta.exact);
+
+	ASSERT_TRUE(counter.NextFile(path));
+	EXPECT_EQ("old.c", path);
+	counter.CountFile(delta);
+	ExpectCounts(delta.added, 0, 0, 0);
+	ExpectCounts(delta.removed, 1, 1, 0);
+	EXPECT_TRUE(delta.exact);
+
+	EXPECT_FALSE(counter.NextFile(path));
+	EXPECT_FALSE(counter.HasFailed());
+}
+
+TEST_F(DiffCounterTest, FindsStateFromChangedFile)
+{
+	WriteFile("/*\n a\n B\n c\n*/\nint x;\n");
+	const std::string diff(
+		"--- a/" + fileName + "\n"
+		"+++ b/" + fileName + "\n"
+		"@@ -3 +3 @@\n"
+		"- b\n"
+		"+ B\n");
+
+	// The hunk is within a block comment, which is only known from the file
+	std::istringstream withFile(diff);
+	DiffCounter counter(withFile, ".", comments, blockComments, lineContinuation);
+	std::string path;
+	DiffCounter::Delta delta;
+	ASSERT_TRUE(counter.NextFile(path));
+	counter.CountFile(delta);
+	ExpectCounts(delta.added, 0, 1, 0);
+	ExpectCounts(delta.removed, 0, 1, 0);
+	EXPECT_TRUE(delta.exact);
+
+	std::istringstream withoutFile(diff);
+	DiffCounter estimate(withoutFile, std::string(), comments, blockComments, lineContinuation);
+	ASSERT_TRUE(estimate.NextFile(path));
+	estimate.CountFile(delta);
+	ExpectCounts(delta.added, 1, 0, 0);
+	ExpectCounts(delta.removed, 1, 0, 0);
+	EXPECT_FALSE(delta.exact);
+
+	// A file which doesn't match the diff isn't used
+	WriteFile("/*\n a\n b\n c\n*/\nint x;\n");
+	std::istringstream staleFile(diff);
+	DiffCounter stale(staleFile, ".", comments, blockComments, lineContinuation);
+	ASSERT_TRUE(stale.NextFile(path));
+	stale.CountFile(delta);
+	EXPECT_FALSE(delta.exact);
+}
+
+TEST_F(DiffCounterTest, CountsReclassifiedLines)
+{
+	WriteFile("int a;\n/*\nint b;\n\nint c;\n*/\nint d;\n");
+	std::istringstream diff(
+		"--- a/" + fileName + "\n"
+		"+++ b/" + fileName + "\n"
+		"@@ -1,2 +1,3 @@\n"
+		" int a;\n"
+		"+/*\n"
+		" int b;\n"
+		"@@ -4,2 +5,3 @@\n"
+		" int c;\n"
+		"+*/\n"
+		" int d;\n");
+
+	// Old file:  4 code, 1 blank; new file:  2 code, 4 comment, 1 blank
+	DiffCounter counter(diff, ".", comments, blockComments, lineContinuation);
+	std::string path;
+	DiffCounter::Delta delta;
+	ASSERT_TRUE(counter.NextFile(path));
+	counter.CountFile(delta);
+	ExpectCounts(delta.added, 0, 4, 0);
+	ExpectCounts(delta.removed, 2, 0, 0);
+	EXPECT_TRUE(delta.exact);
+	EXPECT_FALSE(counter.NextFile(path));
+	EXPECT_FALSE(counter.HasFailed());
+}
+
+TEST_F(DiffCounterTest, SkipsFilesAndDetectsMalformedHunks)
+{
+	std::istringstream diff(
+		"--- a/skipped.c\n"
+		"+++ b/skipped.c\n"
+		"@@ -1,2 +1 @@\n"
+		"--- not a header\n"
+		" int x;\n"
+		"--- a/broken.c\n"
+		"+++ b/broken.c\n"
+		"@@ -1,4 +1,4 @@\n"
+		" int x;\n"
+		"--- a/next.c\n"
+		"+++ b/next.c\n");
+
+	DiffCounter counter(diff, std::string(), comments, blockComments, lineContinuation);
+	std::string path;
+	ASSERT_TRUE(counter.NextFile(path));
+	EXPECT_EQ("skipped.c", path);
+	ASSERT_TRUE(counter.NextFile(path));
+	EXPECT_EQ("broken.c", path);
+	EXPECT_FALSE(counter.NextFile(path));
+	EXPECT_TRUE(counter.HasFailed());
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
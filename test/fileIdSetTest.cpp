@@ -0,0 +1,81 @@
+// File:  fileIdSetTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for concurrent (device, inode) set class.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "fileIdSet.h"
+
+TEST(FileIdSetTest, InsertsEachPairOnce)
+{
+	FileIdSet set;
+	EXPECT_TRUE(set.Insert(1, 100));
+	EXPECT_FALSE(set.Insert(1, 100));
+	EXPECT_TRUE(set.Insert(2, 100));
+	EXPECT_TRUE(set.Insert(1, 101));
+}
+
+TEST(FileIdSetTest, ConcurrentInsertsSucceedOnce)
+{
+	FileIdSet set;
+	const unsigned int threadCount(8), idCount(20000);
+	std::atomic<unsigned int> inserted(0);
+
+	std::vector<std::thread> threads;
+	unsigned int i;
+	for (i = 0; i < threadCount; i++)
+	{
+		threads.push_back(std::thread([&set, &inserted, idCount]()
+		{
+			unsigned int j;
+			for (j = 0; j < idCount; j++)
+			{
+				if (set.Insert(j % 3, j))
+					inserted++;
+			}
+		}));
+	}
+
+	for (i = 0; i < threadCount; i++)
+		threads[i].join();
+
+	EXPECT_EQ(idCount, inserted.load());
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,103 @@
+// File:  fileListReaderTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for reading lists of file paths.
+
+// Standard C++ headers
+#include <string>
+#include <sstream>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "fileListReader.h"
+
+static std::vector<std::string> ReadAll(const std::string &list, const bool &nulDelimited)
+{
+	std::istringstream input(list);
+	FileListReader reader(input, nulDelimited);
+	std::vector<std::string> paths;
+	std::string path;
+	while (reader.Next(path))
+		paths.push_back(path);
+	return paths;
+}
+
+TEST(FileListReaderTest, Empty)
+{
+	EXPECT_TRUE(ReadAll("", false).empty());
+	EXPECT_TRUE(ReadAll("", true).empty());
+	EXPECT_TRUE(ReadAll("\n\n", false).empty());
+	EXPECT_TRUE(ReadAll(std::string("\0\0", 2), true).empty());
+}
+
+TEST(FileListReaderTest, NewlineDelimited)
+{
+	const std::vector<std::string> paths(ReadAll("a.cpp\nsrc/b.h\r\n\nc d.cpp", false));
+	ASSERT_EQ(3U, paths.size());
+	EXPECT_EQ("a.cpp", paths[0]);
+	EXPECT_EQ("src/b.h", paths[1]);
+	EXPECT_EQ("c d.cpp", paths[2]);
+}
+
+TEST(FileListReaderTest, NulDelimited)
+{
+	const char list[] = "a.cpp\0new\nline.h\r\0\0b.cpp\0";
+	const std::vector<std::string> paths(ReadAll(std::string(list, sizeof(list) - 1), true));
+	ASSERT_EQ(3U, paths.size());
+	EXPECT_EQ("a.cpp", paths[0]);
+	EXPECT_EQ("new\nline.h\r", paths[1]);
+	EXPECT_EQ("b.cpp", paths[2]);
+}
+
+TEST(FileListReaderTest, NewlineInFirstNulDelimitedPath)
+{
+	// The first delimiter in the list doesn't decide the format
+	const char list[] = "new\nline.h\0a.cpp\0";
+	const std::vector<std::string> paths(ReadAll(std::string(list, sizeof(list) - 1), true));
+	ASSERT_EQ(2U, paths.size());
+	EXPECT_EQ("new\nline.h", paths[0]);
+	EXPECT_EQ("a.cpp", paths[1]);
+}
+
+TEST(FileListReaderTest, StreamsPaths)
+{
+	// Paths are returned as soon as they're complete
+	std::stringstream input;
+	FileListReader reader(input, false);
+	std::string path;
+	input << "a.cpp\nb";
+	ASSERT_TRUE(reader.Next(path));
+	EXPECT_EQ("a.cpp", path);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,198 @@
+// File:  fileProcessorTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for the pool of threads which parse files.
+
+// Standard C++ headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <iterator>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "fileProcessor.h"
+#include "fileQueue.h"
+#include "boundedQueue.h"
+
+class RecordingHandler : public FileResultHandler
+{
+public:
+	virtual void OnFileResult(const FileEntry &entry,
+		const LineCounter::Statistics &/*statistics*/)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		entries.push_back(entry);
+	};
+
+	std::vector<FileEntry> entries;// In the order they were parsed
+
+private:
+	std::mutex mutex;
+};
+
+class FileProcessorTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		comments.push_back("//");
+		blockComments.push_back(std::make_pair(std::string("/*"), std::string("*/")));
+		lineContinuation.push_back("\\");
+
+		// Mixed sizes, in no particular order
+		unsigned int i;
+		for (i = 0; i < 40; i++)
+			WriteFile(i, (i * 37) % 50 + 1);
+	};
+
+	virtual void TearDown()
+	{
+		unsigned int i;
+		for (i = 0; i < files.size(); i++)
+			std::remove(files[i].path.c_str());
+	};
+
+	std::vector<std::string> comments;
+	std::vector<std::pair<std::string, std::string> > blockComments;
+	std::vector<std::string> lineContinuation;
+
+	std::vector<FileEntry> files;
+
+	void WriteFile(const unsigned int &index, const unsigned int &lineCount);
+	LineCounter::Statistics Run(const unsigned int &threadCount,
+		const bool &buffered, RecordingHandler &handler);
+};
+
+void FileProcessorTest::WriteFile(const unsigned int &index, const unsigned int &lineCount)
+{
+	std::ostringstream name;
+	name << "fileProcessorTest" << index << ".tmp";
+
+	std::string contents;
+	unsigned int i;
+	for (i = 0; i < lineCount; i++)
+		contents.append(i % 4 == 0 ? "// comment\n" : (i % 4 == 1 ? "\n" : "code();\n"));
+
+	std::ofstream file(name.str().c_str(), std::ios::out | std::ios::binary);
+	file << contents;
+
+	FileEntry entry;
+	entry.path = name.str();
+	entry.size = contents.length();
+	entry.device = 0;
+	entry.inode = 0;
+	files.push_back(entry);
+}
+
+// Hands the files out from a FileQueue, as the read stage does, to a pool
+// of parsing threads
+LineCounter::Statistics FileProcessorTest::Run(const unsigned int &threadCount,
+	const bool &buffered, RecordingHandler &handler)
+{
+	FileQueue fileQueue;
+	unsigned int i;
+	for (i = 0; i < files.size(); i++)
+		fileQueue.Push(files[i]);
+	fileQueue.Close();
+
+	BoundedQueue<FileBuffer> bufferQueue(files.size());
+	FileBuffer file;
+	while (fileQueue.Pop(file.entry))
+	{
+		file.buffered = buffered;
+		file.contents.clear();
+		if (buffered)
+		{
+			std::ifstream input(file.entry.path.c_str(), std::ios::in | std::ios::binary);
+			file.contents.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+		}
+
+		bufferQueue.Push(file);
+		fileQueue.Release(file.entry);
+	}
+	bufferQueue.Close();
+
+	FileProcessor processor(bufferQueue, comments, blockComments, lineContinuation);
+	processor.SetFileResultHandler(&handler);
+	processor.Start(threadCount);
+	processor.Wait();
+	return processor.GetStatistics();
+}
+
+TEST_F(FileProcessorTest, LargestFilesAreParsedFirst)
+{
+	RecordingHandler handler;
+	const LineCounter::Statistics statistics(Run(1, false, handler));
+
+	ASSERT_EQ(files.size(), handler.entries.size());
+	EXPECT_EQ(files.size(), statistics.fileCount);
+
+	unsigned int i;
+	for (i = 1; i < handler.entries.size(); i++)
+		EXPECT_GE(handler.entries[i - 1].size, handler.entries[i].size) << i;
+}
+
+TEST_F(FileProcessorTest, EachFileIsParsedOnce)
+{
+	LineCounter serial(comments, blockComments, lineContinuation);
+	unsigned int i;
+	for (i = 0; i < files.size(); i++)
+		ASSERT_TRUE(serial.ProcessFile(files[i].path));
+
+	const unsigned int threadCounts[] = { 1, 4, 16 };
+	unsigned int j;
+	for (j = 0; j < sizeof(threadCounts) / sizeof(threadCounts[0]); j++)
+	{
+		RecordingHandler handler;
+		const LineCounter::Statistics statistics(Run(threadCounts[j], j % 2 == 0, handler));
+
+		std::map<std::string, unsigned int> timesParsed;
+		for (i = 0; i < handler.entries.size(); i++)
+			timesParsed[handler.entries[i].path]++;
+
+		ASSERT_EQ(files.size(), timesParsed.size());
+		for (i = 0; i < files.size(); i++)
+			EXPECT_EQ(1U, timesParsed[files[i].path]) << files[i].path;
+
+		EXPECT_EQ(serial.GetStatistics().fileCount, statistics.fileCount);
+		EXPECT_EQ(serial.GetStatistics().blankLines, statistics.blankLines);
+		EXPECT_EQ(serial.GetStatistics().commentLines, statistics.commentLines);
+		EXPECT_EQ(serial.GetStatistics().codeLines, statistics.codeLines);
+	}
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
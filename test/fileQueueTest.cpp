@@ -0,0 +1,121 @@
+// File:  fileQueueTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for per-device file queue class.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <thread>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "fileQueue.h"
+
+class FileQueueTest : public ::testing::Test
+{
+protected:
+	FileQueue queue;
+
+	void Push(const char *path, const unsigned long long &size,
+		const unsigned long long &device)
+	{
+		FileEntry entry;
+		entry.path = path;
+		entry.size = size;
+		entry.device = device;
+		queue.Push(entry);
+	};
+};
+
+TEST_F(FileQueueTest, LargestFirst)
+{
+	Push("small", 1, 0);
+	Push("large", 100, 0);
+	Push("medium", 10, 0);
+	queue.Close();
+
+	FileEntry entry;
+	ASSERT_TRUE(queue.Pop(entry));
+	EXPECT_EQ("large", entry.path);
+	ASSERT_TRUE(queue.Pop(entry));
+	EXPECT_EQ("medium", entry.path);
+	ASSERT_TRUE(queue.Pop(entry));
+	EXPECT_EQ("small", entry.path);
+	EXPECT_FALSE(queue.Pop(entry));
+	EXPECT_TRUE(queue.IsFinished());
+}
+
+TEST_F(FileQueueTest, BusyDeviceIsSkipped)
+{
+	queue.SetDeviceLimit(1, 1);
+	Push("slow1", 100, 1);
+	Push("slow2", 90, 1);
+	Push("fast1", 10, 2);
+	Push("fast2", 5, 2);
+
+	FileEntry slow, entry;
+	ASSERT_TRUE(queue.Pop(slow));
+	EXPECT_EQ("slow1", slow.path);
+
+	// Device 1 is at its limit, so smaller files from device 2 come first
+	ASSERT_TRUE(queue.Pop(entry, false));
+	EXPECT_EQ("fast1", entry.path);
+	ASSERT_TRUE(queue.Pop(entry, false));
+	EXPECT_EQ("fast2", entry.path);
+	EXPECT_FALSE(queue.Pop(entry, false));
+	EXPECT_FALSE(queue.IsFinished());
+
+	queue.Release(slow);
+	ASSERT_TRUE(queue.Pop(entry, false));
+	EXPECT_EQ("slow2", entry.path);
+}
+
+TEST_F(FileQueueTest, ReleaseWakesWaitingReader)
+{
+	queue.SetDeviceLimit(1, 1);
+	Push("first", 2, 1);
+	Push("second", 1, 1);
+	queue.Close();
+
+	FileEntry first, second;
+	ASSERT_TRUE(queue.Pop(first));
+
+	bool popped(false);
+	std::thread reader([this, &second, &popped]() { popped = queue.Pop(second); });
+	queue.Release(first);
+	reader.join();
+
+	EXPECT_TRUE(popped);
+	EXPECT_EQ("second", second.path);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,187 @@
+// File:  incrementalCounterTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for incremental line counting class.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "incrementalCounter.h"
+#include "lineCounter.h"
+
+class IncrementalCounterTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		comments.push_back("//");
+		comments.push_back("#");
+		blockComments.push_back(std::make_pair(std::string("/*"), std::string("*/")));
+		blockComments.push_back(std::make_pair(std::string("<!--"), std::string("-->")));
+		lineContinuation.push_back("\\");
+	};
+
+	std::vector<std::string> comments;
+	std::vector<std::pair<std::string, std::string> > blockComments;
+	std::vector<std::string> lineContinuation;
+
+	std::vector<std::string> RandomLines(const unsigned int &count, std::mt19937 &generator) const;
+	void ExpectFullCount(const IncrementalCounter &counter, const std::vector<std::string> &lines) const;
+	bool Replace(IncrementalCounter &counter, std::vector<std::string> &lines, const size_t &firstLine,
+		const size_t &removedCount, const std::vector<std::string> &newLines) const;
+};
+
+std::vector<std::string> IncrementalCounterTest::RandomLines(const unsigned int &count,
+	std::mt19937 &generator) const
+{
+	static const char* const pieces[] = { "int x;", "  ", "// comment", "# comment",
+		"/*", "*/", "<!--", "-->", "\\", "a = b; /* c */", "\t", "code();" };
+	const unsigned int pieceCount(sizeof(pieces) / sizeof(pieces[0]));
+
+	std::vector<std::string> lines(count);
+	unsigned int i, j;
+	for (i = 0; i < count; i++)
+	{
+		const unsigned int lineLength(generator() % 4);
+		for (j = 0; j < lineLength; j++)
+			lines[i].append(pieces[generator() % pieceCount]);
+	}
+
+	return lines;
+}
+
+void IncrementalCounterTest::ExpectFullCount(const IncrementalCounter &counter,
+	const std::vector<std::string> &lines) const
+{
+	std::string text;
+	unsigned int i;
+	for (i = 0; i < lines.size(); i++)
+		text.append(lines[i] + "\n");
+
+	LineCounter lineCounter(comments, blockComments, lineContinuation);
+	lineCounter.ProcessBuffer(text.data(), text.length());
+	const LineCounter::Statistics expected(lineCounter.GetStatistics());
+	const LineCounter::Statistics actual(counter.GetStatistics());
+
+	ASSERT_EQ(lines.size(), counter.GetLineCount());
+	EXPECT_EQ(expected.blankLines, actual.blankLines);
+	EXPECT_EQ(expected.commentLines, actual.commentLines);
+	EXPECT_EQ(expected.codeLines, actual.codeLines);
+}
+
+// Applies the edit to both the counter and the list of lines, and checks
+// the result against counting the whole file
+bool IncrementalCounterTest::Replace(IncrementalCounter &counter, std::vector<std::string> &lines,
+	const size_t &firstLine, const size_t &removedCount, const std::vector<std::string> &newLines) const
+{
+	if (!counter.ReplaceLines(firstLine, removedCount, newLines))
+		return false;
+
+	lines.erase(lines.begin() + firstLine, lines.begin() + firstLine + removedCount);
+	lines.insert(lines.begin() + firstLine, newLines.begin(), newLines.end());
+	ExpectFullCount(counter, lines);
+	return true;
+}
+
+TEST_F(IncrementalCounterTest, RandomEditsMatchFullCount)
+{
+	std::mt19937 generator(42);
+	const unsigned int intervals[] = { 1, 3, 64 };
+	unsigned int i, j;
+	for (i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++)
+	{
+		IncrementalCounter counter(comments, blockComments, lineContinuation, intervals[i]);
+		std::vector<std::string> lines(RandomLines(300, generator));
+		std::string text;
+		for (j = 0; j < lines.size(); j++)
+			text.append(lines[j] + "\n");
+		counter.SetText(text.data(), text.length());
+		ExpectFullCount(counter, lines);
+
+		for (j = 0; j < 500; j++)
+		{
+			const size_t first(generator() % (lines.size() + 1));
+			const size_t removed(generator() % (std::min<size_t>(lines.size() - first, 5) + 1));
+			const std::vector<std::string> newLines(RandomLines(generator() % 6, generator));
+
+			ASSERT_TRUE(Replace(counter, lines, first, removed, newLines));
+		}
+	}
+}
+
+TEST_F(IncrementalCounterTest, EditsAreLocal)
+{
+	const unsigned int interval(64);
+	IncrementalCounter counter(comments, blockComments, lineContinuation, interval);
+
+	std::vector<std::string> lines;
+	std::string text;
+	unsigned int i;
+	for (i = 0; i < 50000; i++)
+	{
+		lines.push_back(i % 3 == 0 ? "// comment" : "int x;");
+		text.append(lines.back() + "\n");
+	}
+
+	counter.SetText(text.data(), text.length());
+	EXPECT_EQ(50000U, counter.GetParsedLineCount());
+
+	// Parsing starts at most one interval before the edit and stops at most
+	// one interval after it
+	std::vector<std::string> newLines(2, "code();");
+	ASSERT_TRUE(Replace(counter, lines, 25000, 1, newLines));
+	EXPECT_LE(counter.GetParsedLineCount(), 2 * interval + newLines.size());
+
+	ASSERT_TRUE(Replace(counter, lines, 100, 10, std::vector<std::string>()));
+	EXPECT_LE(counter.GetParsedLineCount(), 2 * interval);
+
+	ASSERT_TRUE(Replace(counter, lines, lines.size(), 0, newLines));
+	EXPECT_LE(counter.GetParsedLineCount(), interval + newLines.size());
+
+	// Opening a block comment changes every following line, until it is closed
+	ASSERT_TRUE(Replace(counter, lines, 1000, 0, std::vector<std::string>(1, "/*")));
+	EXPECT_EQ(SourceParser::PositionBlockComment, counter.GetLineType(lines.size() - 1));
+	ASSERT_TRUE(Replace(counter, lines, 2000, 0, std::vector<std::string>(1, "*/")));
+	EXPECT_LE(counter.GetParsedLineCount(), lines.size() - 2000 + interval);
+	EXPECT_EQ(SourceParser::PositionCode, counter.GetLineType(2001));
+
+	EXPECT_FALSE(counter.ReplaceLines(lines.size() + 1, 0, newLines));
+	EXPECT_FALSE(counter.ReplaceLines(lines.size() - 1, 2, newLines));
+	ExpectFullCount(counter, lines);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
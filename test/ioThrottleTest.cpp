@@ -0,0 +1,103 @@
+// File:  ioThrottleTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for the read rate limits.
+
+// Standard C++ headers
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "ioThrottle.h"
+
+// Returns the time taken to acquire the specified reads [sec]
+static double TimeReads(IoThrottle &throttle, const unsigned int &count,
+	const unsigned long long &bytes)
+{
+	const std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		throttle.Acquire(bytes);
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+TEST(IoThrottleTest, Unlimited)
+{
+	IoThrottle throttle(0, 0);
+	EXPECT_FALSE(throttle.IsEnabled());
+	EXPECT_LT(TimeReads(throttle, 1000, 1ULL << 40), 0.1);
+}
+
+TEST(IoThrottleTest, LimitsBytes)
+{
+	// The first second's worth is available immediately
+	IoThrottle throttle(1000, 0);
+	EXPECT_TRUE(throttle.IsEnabled());
+	EXPECT_LT(TimeReads(throttle, 4, 250), 0.1);
+
+	const double elapsed(TimeReads(throttle, 2, 250));
+	EXPECT_GT(elapsed, 0.4);
+	EXPECT_LT(elapsed, 0.9);
+}
+
+TEST(IoThrottleTest, LimitsOperations)
+{
+	IoThrottle throttle(0, 20);
+	EXPECT_LT(TimeReads(throttle, 20, 1), 0.1);
+
+	const double elapsed(TimeReads(throttle, 10, 1));
+	EXPECT_GT(elapsed, 0.4);
+	EXPECT_LT(elapsed, 0.9);
+}
+
+TEST(IoThrottleTest, SharedBetweenThreads)
+{
+	IoThrottle throttle(0, 40);
+	TimeReads(throttle, 40, 1);
+
+	const std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+	std::vector<std::thread> threads;
+	unsigned int i;
+	for (i = 0; i < 4; i++)
+		threads.push_back(std::thread([&throttle]() { TimeReads(throttle, 5, 1); }));
+	for (i = 0; i < threads.size(); i++)
+		threads[i].join();
+
+	const double elapsed(std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - start).count());
+	EXPECT_GT(elapsed, 0.4);
+	EXPECT_LT(elapsed, 0.9);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,146 @@
+// File:  lineCounterConfigFileTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for the line counter configuration, in particular the
+//        directories which are dropped because another one covers them.
+
+#ifndef WIN32
+// *nix headers
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Standard C++ headers
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "lineCounterConfigFile.h"
+
+#ifndef WIN32
+class LineCounterConfigFileTest : public ::testing::Test
+{
+protected:
+	const std::string directory = "lineCounterConfigFileTest/";
+	const std::string configName = "lineCounterConfigFileTest.ini";
+	std::vector<std::string> directoryNames;
+
+	virtual void SetUp();
+	virtual void TearDown();
+
+	// Returns the directories left after reading a configuration which
+	// lists the top directory and the specified one inside it
+	std::vector<std::string> ReadDirectories(const std::string &nested,
+		const std::string &options);
+};
+
+void LineCounterConfigFileTest::SetUp()
+{
+	directoryNames.push_back(directory);
+	directoryNames.push_back(directory + "a/");
+	directoryNames.push_back(directory + "a/b/");
+	directoryNames.push_back(directory + ".hidden/");
+	directoryNames.push_back(directory + ".hidden/c/");
+	directoryNames.push_back(directory + "ignored/");
+	directoryNames.push_back(directory + "ignored/d/");
+
+	unsigned int i;
+	for (i = 0; i < directoryNames.size(); i++)
+		mkdir(directoryNames[i].c_str(), 0755);
+
+	std::ofstream gitIgnore((directory + ".gitignore").c_str());
+	gitIgnore << "ignored/\n";
+}
+
+void LineCounterConfigFileTest::TearDown()
+{
+	remove(configName.c_str());
+	remove((directory + ".gitignore").c_str());
+
+	unsigned int i;
+	for (i = 0; i < directoryNames.size(); i++)
+		rmdir(directoryNames[directoryNames.size() - i - 1].c_str());
+}
+
+std::vector<std::string> LineCounterConfigFileTest::ReadDirectories(
+	const std::string &nested, const std::string &options)
+{
+	{
+		std::ofstream config(configName.c_str());
+		config << "EXTENSION cpp\n"
+			<< "COMMENT //\n"
+			<< "DIRECTORY " << directory << '\n'
+			<< "DIRECTORY " << directory << nested << '\n'
+			<< options;
+	}
+
+	LineCounterConfigFile configFile;
+	EXPECT_TRUE(configFile.ReadConfiguration(configName));
+	return configFile.GetInformation().directoryList;
+}
+
+TEST_F(LineCounterConfigFileTest, DropsDirectoryReachedBySearch)
+{
+	const std::vector<std::string> directories(ReadDirectories("a/b", "RECURSIVE_SEARCH\n"));
+	ASSERT_EQ(1U, directories.size());
+	EXPECT_EQ(directory, directories[0]);
+}
+
+TEST_F(LineCounterConfigFileTest, KeepsDirectoryWithoutRecursion)
+{
+	EXPECT_EQ(2U, ReadDirectories("a/b", "").size());
+}
+
+TEST_F(LineCounterConfigFileTest, KeepsExcludedDirectory)
+{
+	EXPECT_EQ(2U, ReadDirectories("a/b", "RECURSIVE_SEARCH\nEXCLUDE a\n").size());
+	EXPECT_EQ(2U, ReadDirectories("a/b", "RECURSIVE_SEARCH\nEXCLUDE b/\n").size());
+	EXPECT_EQ(1U, ReadDirectories("a/b", "RECURSIVE_SEARCH\nEXCLUDE b/*.cpp\n").size());
+}
+
+TEST_F(LineCounterConfigFileTest, KeepsHiddenDirectory)
+{
+	EXPECT_EQ(2U, ReadDirectories(".hidden/c", "RECURSIVE_SEARCH\n").size());
+}
+
+TEST_F(LineCounterConfigFileTest, KeepsGitIgnoredDirectory)
+{
+	EXPECT_EQ(2U, ReadDirectories("ignored/d", "RECURSIVE_SEARCH\nGITIGNORE\n").size());
+	EXPECT_EQ(1U, ReadDirectories("ignored/d", "RECURSIVE_SEARCH\n").size());
+}
+#endif
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,214 @@
+// File:  lineCounterLibraryTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for the C++ and C interfaces to the line counting library.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "lineCounterLibrary.h"
+#include "lineCounterC.h"
+
+using namespace LineCounterLibrary;
+
+static const std::string source("// comment\nint x;\n\n/* block\n   comment */\nint y;\n  \n");
+
+static void ExpectCounts(const unsigned long long &blank, const unsigned long long &comment,
+	const unsigned long long &code, const Counts &counts)
+{
+	EXPECT_EQ(blank, counts.blankLines);
+	EXPECT_EQ(comment, counts.commentLines);
+	EXPECT_EQ(code, counts.codeLines);
+}
+
+TEST(LineCounterLibraryTest, CountsBuffers)
+{
+	Profile profile;
+	ASSERT_TRUE(Profile::ForLanguage("cpp", profile));
+	ExpectCounts(2, 3, 2, CountBuffer(profile, source.data(), source.length()));
+	ExpectCounts(0, 0, 0, CountBuffer(profile, NULL, 0));
+
+	ASSERT_TRUE(Profile::ForLanguage("python", profile));
+	ExpectCounts(2, 0, 5, CountBuffer(profile, source.data(), source.length()));
+
+	EXPECT_FALSE(Profile::ForLanguage("cobol", profile));
+
+	std::vector<std::string> comments(1, "--");
+	const Profile custom(comments, std::vector<std::pair<std::string, std::string> >(),
+		std::vector<std::string>());
+	const std::string sql("-- query\nselect 1;\n");
+	ExpectCounts(0, 1, 1, CountBuffer(custom, sql.data(), sql.length()));
+}
+
+TEST(LineCounterLibraryTest, StreamsMatchBuffers)
+{
+	Profile profile;
+	ASSERT_TRUE(Profile::ForLanguage("c", profile));
+
+	Stream stream(profile);
+	size_t chunkSize, position;
+	for (chunkSize = 1; chunkSize <= source.length(); chunkSize++)
+	{
+		for (position = 0; position < source.length(); position += chunkSize)
+			stream.Write(source.data() + position, std::min(chunkSize, source.length() - position));
+
+		// Each call to Finish returns the counts of one file only
+		ExpectCounts(2, 3, 2, stream.Finish());
+	}
+
+	ExpectCounts(0, 0, 0, stream.Finish());
+}
+
+TEST(LineCounterLibraryTest, SharesProfilesBetweenThreads)
+{
+	Profile profile;
+	ASSERT_TRUE(Profile::ForLanguage("java", profile));
+
+	std::string file;
+	unsigned int i;
+	for (i = 0; i < 200; i++)
+		file.append(source);
+
+	const unsigned int threadCount(8);
+	std::vector<Counts> results(threadCount);
+	std::vector<std::thread> threads;
+	for (i = 0; i < threadCount; i++)
+	{
+		threads.push_back(std::thread([&profile, &file, &results, i]()
+		{
+			unsigned int j;
+			for (j = 0; j < 50; j++)
+			{
+				if (j % 2 == 0)
+					results[i] = CountBuffer(profile, file.data(), file.length());
+				else
+				{
+					Stream stream(profile);
+					stream.Write(file.data(), file.length() / 2);
+					stream.Write(file.data() + file.length() / 2, file.length() - file.length() / 2);
+					results[i] = stream.Finish();
+				}
+			}
+		}));
+	}
+
+	for (i = 0; i < threadCount; i++)
+	{
+		threads[i].join();
+		ExpectCounts(400, 600, 400, results[i]);
+	}
+}
+
+TEST(LineCounterLibraryTest, EditsDocuments)
+{
+	Profile profile;
+	ASSERT_TRUE(Profile::ForLanguage("cpp", profile));
+
+	Document document(profile);
+	document.SetText(source.data(), source.length());
+	EXPECT_EQ(7U, document.GetLineCount());
+	ExpectCounts(2, 3, 2, document.GetCounts());
+
+	// Replace "int x;" and the blank line with a block comment opening
+	ASSERT_TRUE(document.ReplaceLines(1, 2, std::vector<std::string>(1, "/* new")));
+	ExpectCounts(1, 4, 1, document.GetCounts());
+	EXPECT_FALSE(document.ReplaceLines(7, 0, std::vector<std::string>()));
+
+	LineCounterProfile *cProfile(LineCounterCreateLanguageProfile("cpp"));
+	ASSERT_TRUE(cProfile != NULL);
+	LineCounterDocument *cDocument(LineCounterCreateDocument(cProfile));
+	ASSERT_TRUE(cDocument != NULL);
+	LineCounterDestroyProfile(cProfile);
+
+	ASSERT_EQ(0, LineCounterSetDocumentText(cDocument, source.data(), source.length()));
+	const char *newLines[] = { "/* new" };
+	const size_t newLineLengths[] = { 6 };
+	ASSERT_EQ(0, LineCounterReplaceDocumentLines(cDocument, 1, 2, newLines, newLineLengths, 1));
+	EXPECT_NE(0, LineCounterReplaceDocumentLines(cDocument, 7, 0, NULL, NULL, 0));
+	EXPECT_NE(0, LineCounterReplaceDocumentLines(cDocument, 0, 0, NULL, NULL, 1));
+
+	LineCounterCounts counts;
+	ASSERT_EQ(0, LineCounterGetDocumentCounts(cDocument, &counts));
+	EXPECT_EQ(1U, counts.blankLines);
+	EXPECT_EQ(4U, counts.commentLines);
+	EXPECT_EQ(1U, counts.codeLines);
+	LineCounterDestroyDocument(cDocument);
+}
+
+TEST(LineCounterLibraryTest, CInterface)
+{
+	EXPECT_EQ(static_cast<unsigned int>(LINE_COUNTER_API_VERSION), LineCounterGetApiVersion());
+	EXPECT_TRUE(LineCounterCreateLanguageProfile("cobol") == NULL);
+	EXPECT_TRUE(LineCounterCreateLanguageProfile(NULL) == NULL);
+
+	const char *comments[] = { "//" };
+	const char *blockStarts[] = { "/*" };
+	const char *blockEnds[] = { "*/" };
+	LineCounterProfile *profile(LineCounterCreateProfile(comments, 1, blockStarts, blockEnds, 1, NULL, 0));
+	ASSERT_TRUE(profile != NULL);
+
+	LineCounterCounts counts;
+	ASSERT_EQ(0, LineCounterCountBuffer(profile, source.data(), source.length(), &counts));
+	EXPECT_EQ(2U, counts.blankLines);
+	EXPECT_EQ(3U, counts.commentLines);
+	EXPECT_EQ(2U, counts.codeLines);
+
+	EXPECT_NE(0, LineCounterCountBuffer(NULL, source.data(), source.length(), &counts));
+	EXPECT_NE(0, LineCounterCountBuffer(profile, NULL, 1, &counts));
+	EXPECT_NE(0, LineCounterCountBuffer(profile, source.data(), source.length(), NULL));
+
+	// Streams don't depend on the profile after they are created
+	LineCounterStream *stream(LineCounterCreateStream(profile));
+	ASSERT_TRUE(stream != NULL);
+	LineCounterDestroyProfile(profile);
+
+	ASSERT_EQ(0, LineCounterWriteStream(stream, source.data(), 5));
+	ASSERT_EQ(0, LineCounterWriteStream(stream, source.data() + 5, source.length() - 5));
+	ASSERT_EQ(0, LineCounterFinishStream(stream, &counts));
+	EXPECT_EQ(2U, counts.blankLines);
+	EXPECT_EQ(3U, counts.commentLines);
+	EXPECT_EQ(2U, counts.codeLines);
+
+	EXPECT_NE(0, LineCounterWriteStream(NULL, source.data(), 1));
+	EXPECT_NE(0, LineCounterFinishStream(stream, NULL));
+	LineCounterDestroyStream(stream);
+
+	LineCounterDestroyProfile(NULL);
+	LineCounterDestroyStream(NULL);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
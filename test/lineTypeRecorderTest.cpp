@@ -0,0 +1,151 @@
+// File:  lineTypeRecorderTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for per-line classification output.
+
+// Standard C++ headers
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "lineTypeRecorder.h"
+#include "lineCounter.h"
+
+class LineTypeRecorderTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		comments.push_back("//");
+		blockComments.push_back(std::make_pair(std::string("/*"), std::string("*/")));
+		lineContinuation.push_back("\\");
+		fileName = "lineTypeRecorderTest.tmp";
+	};
+
+	virtual void TearDown() { std::remove(fileName.c_str()); };
+
+	std::vector<std::string> comments;
+	std::vector<std::pair<std::string, std::string> > blockComments;
+	std::vector<std::string> lineContinuation;
+	std::string fileName;
+
+	static std::string ReadFile(const std::string &fileName)
+	{
+		std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+		std::ostringstream ss;
+		ss << file.rdbuf();
+		return ss.str();
+	};
+};
+
+static const std::string source("// a\n// b\nint x;\n\n\n/* c\n d */\nint y;\nint z; // e\n");
+
+TEST_F(LineTypeRecorderTest, RecordsRunsWhileCounting)
+{
+	LineCounter counter(comments, blockComments, lineContinuation);
+	LineTypeRecorder recorder;
+	counter.SetLineTypeRecorder(&recorder);
+	counter.ProcessBuffer(source.data(), source.length());
+
+	const std::vector<LineTypeRecorder::Run> &runs(recorder.GetRuns());
+	ASSERT_EQ(5U, runs.size());
+	EXPECT_EQ(LineTypeRecorder::LineComment, runs[0].type);
+	EXPECT_EQ(2U, runs[0].length);
+	EXPECT_EQ(LineTypeRecorder::LineCode, runs[1].type);
+	EXPECT_EQ(1U, runs[1].length);
+	EXPECT_EQ(LineTypeRecorder::LineBlank, runs[2].type);
+	EXPECT_EQ(2U, runs[2].length);
+	EXPECT_EQ(LineTypeRecorder::LineComment, runs[3].type);
+	EXPECT_EQ(2U, runs[3].length);
+	EXPECT_EQ(LineTypeRecorder::LineCode, runs[4].type);
+	EXPECT_EQ(2U, runs[4].length);
+
+	// Each file starts a new set of runs, however it is read
+	std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+	file << source;
+	file.close();
+	ASSERT_TRUE(counter.ProcessFile(fileName));
+	EXPECT_EQ(5U, recorder.GetRuns().size());
+
+	counter.BeginStream();
+	size_t i;
+	for (i = 0; i < source.length(); i++)
+		counter.ProcessChunk(source.data() + i, 1);
+	counter.EndStream();
+	ASSERT_EQ(5U, recorder.GetRuns().size());
+	EXPECT_EQ(2U, recorder.GetRuns()[4].length);
+}
+
+TEST_F(LineTypeRecorderTest, FormatsJson)
+{
+	LineTypeRecorder recorder;
+	recorder.Add(SourceParser::PositionBlockComment);
+	recorder.Add(SourceParser::PositionContinuingComment);
+	recorder.Add(SourceParser::PositionWhitespace);
+	recorder.Add(SourceParser::PositionCode);
+
+	std::string output;
+	LineTypeWriter::AppendJson("dir\\\"q\"\t.c", recorder, output);
+	EXPECT_EQ("{\"file\":\"dir\\\\\\\"q\\\"\\u0009.c\",\"runs\":[[\"comment\",2],[\"blank\",1],[\"code\",1]]}\n", output);
+
+	recorder.Clear();
+	output.clear();
+	LineTypeWriter::AppendJson("empty.c", recorder, output);
+	EXPECT_EQ("{\"file\":\"empty.c\",\"runs\":[]}\n", output);
+}
+
+TEST_F(LineTypeRecorderTest, FormatsBinary)
+{
+	LineTypeRecorder recorder;
+	unsigned int i;
+	for (i = 0; i < 40; i++)
+		recorder.Add(SourceParser::PositionCode);
+	recorder.Add(SourceParser::PositionWhitespace);
+
+	std::string output;
+	LineTypeWriter::AppendBinary("a.c", recorder, output);
+
+	// 40 * 4 + LineCode = 160 needs two bytes; 1 * 4 + LineBlank = 6
+	EXPECT_EQ(std::string("\x03" "a.c" "\x02" "\xa0\x01" "\x06", 8), output);
+
+	LineTypeWriter writer;
+	ASSERT_TRUE(writer.Open(fileName, LineTypeWriter::FormatBinary));
+	writer.Write("a.c", recorder);
+	ASSERT_TRUE(writer.Close());
+	EXPECT_EQ(std::string("LCLT\x01", 5) + output, ReadFile(fileName));
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,145 @@
+// File:  pathFilterTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for glob-based path filter class.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cstring>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "pathFilter.h"
+
+class PathFilterTest : public ::testing::Test
+{
+protected:
+	PathFilter filter;
+
+	bool IsExcluded(const char *path, const bool &isDirectory = false) const
+	{
+		return filter.IsExcluded(path, path + strlen(path), isDirectory);
+	};
+};
+
+TEST_F(PathFilterTest, NamesMatchAtAnyDepth)
+{
+	filter.AddPattern("node_modules");
+	EXPECT_TRUE(IsExcluded("node_modules", true));
+	EXPECT_TRUE(IsExcluded("web/client/node_modules", true));
+	EXPECT_FALSE(IsExcluded("web/node_modules_old", true));
+}
+
+TEST_F(PathFilterTest, TrailingSlashMatchesOnlyDirectories)
+{
+	filter.AddPattern("build/");
+	EXPECT_TRUE(IsExcluded("src/build", true));
+	EXPECT_FALSE(IsExcluded("src/build", false));
+}
+
+TEST_F(PathFilterTest, SlashAnchorsToBase)
+{
+	filter.AddPattern("/third_party");
+	filter.AddPattern("docs/generated");
+	EXPECT_TRUE(IsExcluded("third_party", true));
+	EXPECT_FALSE(IsExcluded("src/third_party", true));
+	EXPECT_TRUE(IsExcluded("docs/generated", true));
+	EXPECT_FALSE(IsExcluded("src/docs/generated", true));
+}
+
+TEST_F(PathFilterTest, Wildcards)
+{
+	filter.AddPattern("*.pb.cc");
+	filter.AddPattern("test?.cpp");
+	filter.AddPattern("[abc]_*.h");
+	filter.AddPattern("gen/*.cpp");
+	EXPECT_TRUE(IsExcluded("proto/message.pb.cc"));
+	EXPECT_FALSE(IsExcluded("proto/message.cc"));
+	EXPECT_TRUE(IsExcluded("test1.cpp"));
+	EXPECT_FALSE(IsExcluded("test10.cpp"));
+	EXPECT_TRUE(IsExcluded("b_file.h"));
+	EXPECT_FALSE(IsExcluded("d_file.h"));
+	EXPECT_TRUE(IsExcluded("gen/file.cpp"));
+	EXPECT_FALSE(IsExcluded("gen/sub/file.cpp"));
+}
+
+TEST_F(PathFilterTest, NegatedCharacterClass)
+{
+	filter.AddPattern("file[!0-9].c");
+	EXPECT_TRUE(IsExcluded("fileA.c"));
+	EXPECT_FALSE(IsExcluded("file5.c"));
+}
+
+TEST_F(PathFilterTest, DoubleStar)
+{
+	filter.AddPattern("**/logs");
+	filter.AddPattern("a/**/b");
+	filter.AddPattern("out/**");
+	EXPECT_TRUE(IsExcluded("logs", true));
+	EXPECT_TRUE(IsExcluded("x/y/logs", true));
+	EXPECT_TRUE(IsExcluded("a/b", true));
+	EXPECT_TRUE(IsExcluded("a/x/y/b", true));
+	EXPECT_FALSE(IsExcluded("a/xb", true));
+	EXPECT_TRUE(IsExcluded("out/anything/here.cpp"));
+	EXPECT_FALSE(IsExcluded("out", true));
+}
+
+TEST_F(PathFilterTest, LastMatchWins)
+{
+	filter.AddPattern("*.cpp");
+	filter.AddPattern("!keep.cpp");
+	EXPECT_TRUE(IsExcluded("drop.cpp"));
+	EXPECT_FALSE(IsExcluded("src/keep.cpp"));
+}
+
+TEST_F(PathFilterTest, GitIgnoreContents)
+{
+	filter.AddPatterns("# comment\r\n\r\n*.o\r\n\\#literal\r\ntrailing   \r\n", "sub/");
+	EXPECT_EQ(3U, filter.GetPatternCount());
+	EXPECT_TRUE(IsExcluded("sub/x/file.o"));
+	EXPECT_FALSE(IsExcluded("other/file.o"));
+	EXPECT_TRUE(IsExcluded("sub/#literal"));
+	EXPECT_TRUE(IsExcluded("sub/trailing"));
+}
+
+TEST_F(PathFilterTest, RemovePatternsRestoresEarlierState)
+{
+	filter.AddPattern("a");
+	const size_t count(filter.GetPatternCount());
+	filter.AddPatterns("b\nc\n", "");
+	EXPECT_TRUE(IsExcluded("c"));
+	filter.RemovePatterns(count);
+	EXPECT_FALSE(IsExcluded("c"));
+	EXPECT_TRUE(IsExcluded("a"));
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,125 @@
+// File:  pathTableTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for compact path storage class.
+
+// Standard C++ headers
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "pathTable.h"
+
+TEST(PathTableTest, ReturnsPaths)
+{
+	PathTable table;
+	const std::string longName(100000, 'x');
+	const char* const paths[] = { "/home/user/src/a.cpp", "/home/user/src/b.cpp",
+		"relative.h", "/home/user/include/a.h", "", "dir//double/slash.c", "trailing/" };
+	const unsigned int pathCount(sizeof(paths) / sizeof(paths[0]));
+
+	unsigned int i;
+	for (i = 0; i < pathCount; i++)
+		EXPECT_EQ(i, table.Add(paths[i]));
+	EXPECT_EQ(pathCount, table.Add("/home/" + longName + "/a.c"));
+	EXPECT_EQ(pathCount + 1, table.Add("/home/user/src/c.cpp"));
+
+	for (i = 0; i < pathCount; i++)
+		EXPECT_EQ(paths[i], table.GetPath(i));
+	EXPECT_EQ("/home/" + longName + "/a.c", table.GetPath(pathCount));
+	EXPECT_EQ("/home/user/src/c.cpp", table.GetPath(pathCount + 1));
+	EXPECT_EQ(pathCount + 2, table.GetFileCount());
+	EXPECT_GT(table.GetMemoryUsage(), longName.length());
+}
+
+TEST(PathTableTest, SortsLikeStrings)
+{
+	// Names which sort differently than their directories (characters before '/')
+	static const char* const pieces[] = { "a", "b", "a.c", "a-b", "a b", "ab", "a/", "/", "B", "\xe2\x82\xac" };
+	const unsigned int pieceCount(sizeof(pieces) / sizeof(pieces[0]));
+
+	std::mt19937 generator(42);
+	std::vector<std::string> paths;
+	PathTable table;
+	unsigned int i, j;
+	for (i = 0; i < 5000; i++)
+	{
+		std::string path;
+		const unsigned int length(1 + generator() % 6);
+		for (j = 0; j < length; j++)
+			path.append(pieces[generator() % pieceCount]);
+		paths.push_back(path);
+		table.Add(path);
+	}
+
+	std::vector<std::string> expected(paths);
+	std::sort(expected.begin(), expected.end());
+	expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+	const std::vector<unsigned int> ids(table.GetSortedIds());
+	ASSERT_EQ(expected.size(), ids.size());
+	for (i = 0; i < ids.size(); i++)
+	{
+		EXPECT_EQ(expected[i], table.GetPath(ids[i]));
+		EXPECT_EQ(expected[i], paths[ids[i]]);
+	}
+}
+
+TEST(PathTableTest, KeepsFirstOfDuplicates)
+{
+	// Enough entries that the sort doesn't fall back on insertion sort
+	std::mt19937 generator(7);
+	std::vector<unsigned int> firstIds(10, 0);
+	std::vector<bool> added(10, false);
+	PathTable table;
+	unsigned int i;
+	for (i = 0; i < 2000; i++)
+	{
+		const unsigned int name(generator() % 10);
+		const unsigned int id(table.Add("dir/file" + std::to_string(name)));
+		if (!added[name])
+		{
+			firstIds[name] = id;
+			added[name] = true;
+		}
+	}
+
+	const std::vector<unsigned int> ids(table.GetSortedIds());
+	ASSERT_EQ(10U, ids.size());
+	for (i = 0; i < ids.size(); i++)
+		EXPECT_EQ(firstIds[i], ids[i]);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,189 @@
+// File:  pipelineTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for the pipelined search, read and parse stages.
+
+#ifndef WIN32
+// *nix headers
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Standard C++ headers
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "pipeline.h"
+
+#ifndef WIN32
+class PipelineTest : public ::testing::Test
+{
+protected:
+	const std::string directory = "pipelineTest/";
+	std::vector<std::string> fileNames;
+	std::vector<std::string> countedFileNames;// With matching extensions
+	std::vector<std::string> directoryNames;
+
+	virtual void SetUp();
+	virtual void TearDown();
+
+	void MakeFile(const std::string &name, const unsigned int &lineCount,
+		const bool &counted);
+	LineCounterInformation MakeInformation(void) const;
+};
+
+void PipelineTest::SetUp()
+{
+	directoryNames.push_back(directory);
+	directoryNames.push_back(directory + "a/");
+	directoryNames.push_back(directory + "a/b/");
+	directoryNames.push_back(directory + "c/");
+
+	unsigned int i;
+	for (i = 0; i < directoryNames.size(); i++)
+		mkdir(directoryNames[i].c_str(), 0755);
+
+	for (i = 0; i < 30; i++)
+	{
+		std::ostringstream name;
+		name << directoryNames[i % directoryNames.size()].substr(directory.length())
+			<< "file" << i << (i % 3 == 0 ? ".h" : ".cpp");
+		MakeFile(name.str(), (i * 53) % 200, true);
+	}
+
+	MakeFile("notes.txt", 10, false);
+
+	// Larger than the read-ahead limit, so it is parsed from disk (in chunks)
+	MakeFile("c/large.cpp", 150000, true);
+}
+
+void PipelineTest::TearDown()
+{
+	unsigned int i;
+	for (i = 0; i < fileNames.size(); i++)
+		remove(fileNames[i].c_str());
+	for (i = 0; i < directoryNames.size(); i++)
+		rmdir(directoryNames[directoryNames.size() - i - 1].c_str());
+}
+
+void PipelineTest::MakeFile(const std::string &name, const unsigned int &lineCount,
+	const bool &counted)
+{
+	fileNames.push_back(directory + name);
+	if (counted)
+		countedFileNames.push_back(fileNames.back());
+
+	const char *lines[] = { "int a;", "// comment", "", "/* block", " comment */ int b;",
+		"\tcall(); \\", "\tcontinued();" };
+	const unsigned int lineTypeCount(sizeof(lines) / sizeof(lines[0]));
+	std::ofstream file(fileNames.back().c_str(), std::ios::out | std::ios::binary);
+	unsigned int i;
+	for (i = 0; i < lineCount; i++)
+		file << lines[(i * 7 + lineCount) % lineTypeCount] << '\n';
+}
+
+LineCounterInformation PipelineTest::MakeInformation(void) const
+{
+	LineCounterInformation info;
+	info.directoryList.push_back(directory);
+	info.extensionList.push_back("cpp");
+	info.extensionList.push_back("h");
+	info.commentList.push_back("//");
+	info.blockCommentList.push_back(std::make_pair(std::string("/*"), std::string("*/")));
+	info.continuationList.push_back("\\");
+
+	info.recurseIntoSubDirectories = true;
+	info.useGitIgnore = false;
+	info.skipNonSource = false;
+
+	info.threadCount = 4;
+	info.readThreadCount = 2;
+	info.traversalThreadCount = 1;
+	info.readAheadSize = 1;
+	info.parallelParseMinimumSize = 1;
+	info.overlapPrescan = false;
+
+	info.solidStateDeviceDepth = 0;
+	info.rotationalDeviceDepth = 0;
+	info.networkDeviceDepth = 0;
+
+	info.useIoUring = false;
+	info.ioUringDepth = 32;
+
+	info.ioBandwidthLimit = 0;
+	info.ioOperationLimit = 0;
+	info.idleIoPriority = false;
+	info.preservePageCache = false;
+	return info;
+}
+
+TEST_F(PipelineTest, MatchesSerialCount)
+{
+	const LineCounterInformation serialInfo(MakeInformation());
+	LineCounter serial(serialInfo.commentList, serialInfo.blockCommentList,
+		serialInfo.continuationList);
+	unsigned int i;
+	for (i = 0; i < countedFileNames.size(); i++)
+		ASSERT_TRUE(serial.ProcessFile(countedFileNames[i]));
+	const LineCounter::Statistics expected(serial.GetStatistics());
+
+	// Searching overlapped with reading and parsing or not, with several
+	// threads in each stage or one
+	for (i = 0; i < 4; i++)
+	{
+		LineCounterInformation info(MakeInformation());
+		info.overlapPrescan = i % 2 == 1;
+		if (i >= 2)
+		{
+			info.threadCount = 1;
+			info.readThreadCount = 1;
+		}
+		else
+			info.traversalThreadCount = 2;
+
+		Pipeline pipeline(info);
+		const LineCounter::Statistics statistics(pipeline.Run());
+		EXPECT_EQ(expected.fileCount, statistics.fileCount) << i;
+		EXPECT_EQ(expected.blankLines, statistics.blankLines) << i;
+		EXPECT_EQ(expected.commentLines, statistics.commentLines) << i;
+		EXPECT_EQ(expected.codeLines, statistics.codeLines) << i;
+	}
+}
+#endif
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
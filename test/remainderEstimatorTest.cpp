@@ -0,0 +1,207 @@
+// File:  remainderEstimatorTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for the estimates of lines in files not counted before the
+//        deadline.
+
+// Standard C++ headers
+#include <string>
+#include <thread>
+#include <chrono>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "remainderEstimator.h"
+#include "deadline.h"
+
+static FileEntry MakeEntry(const std::string &path, const unsigned long long &size)
+{
+	FileEntry entry;
+	entry.path = path;
+	entry.size = size;
+	entry.device = 0;
+	entry.inode = 0;
+	return entry;
+}
+
+static LineCounter::Statistics MakeStatistics(const unsigned long long &blank,
+	const unsigned long long &comment, const unsigned long long &code)
+{
+	LineCounter::Statistics statistics;
+	statistics.blankLines = blank;
+	statistics.commentLines = comment;
+	statistics.codeLines = code;
+	statistics.fileCount = 1;
+	return statistics;
+}
+
+// Counts the calls passed on by the estimator
+class UnfinishedCounter : public FileResultHandler
+{
+public:
+	UnfinishedCounter() : results(0), unfinished(0) {};
+
+	virtual void OnFileResult(const FileEntry &/*entry*/,
+		const LineCounter::Statistics &/*statistics*/) { results++; };
+	virtual void OnFileUnfinished(const FileEntry &/*entry*/) { unfinished++; };
+
+	unsigned int results;
+	unsigned int unfinished;
+};
+
+TEST(RemainderEstimatorTest, NothingUnfinished)
+{
+	RemainderEstimator estimator;
+	estimator.OnFileResult(MakeEntry("a/b.cpp", 1000), MakeStatistics(10, 20, 30));
+
+	RemainderEstimator::Estimate estimate;
+	EXPECT_TRUE(estimator.GetEstimate(estimate));
+	EXPECT_EQ(0ULL, estimate.statistics.fileCount);
+	EXPECT_EQ(0ULL, estimate.bytes);
+	EXPECT_EQ(0ULL, estimate.statistics.codeLines);
+}
+
+TEST(RemainderEstimatorTest, ScalesByExtension)
+{
+	RemainderEstimator estimator;
+	estimator.OnFileResult(MakeEntry("a/b.cpp", 1000), MakeStatistics(10, 20, 30));
+	estimator.OnFileResult(MakeEntry("a/c.H", 100), MakeStatistics(1, 4, 0));
+	estimator.OnFileUnfinished(MakeEntry("a/d.CPP", 500));
+	estimator.OnFileUnfinished(MakeEntry("e/f.h", 50));
+
+	RemainderEstimator::Estimate estimate;
+	ASSERT_TRUE(estimator.GetEstimate(estimate));
+	EXPECT_EQ(2ULL, estimate.statistics.fileCount);
+	EXPECT_EQ(550ULL, estimate.bytes);
+	EXPECT_EQ(5ULL + 1ULL, estimate.statistics.blankLines);
+	EXPECT_EQ(10ULL + 2ULL, estimate.statistics.commentLines);
+	EXPECT_EQ(15ULL, estimate.statistics.codeLines);
+}
+
+TEST(RemainderEstimatorTest, ScalesBySize)
+{
+	// Only the small file is used for the small unfinished file
+	RemainderEstimator estimator;
+	estimator.OnFileResult(MakeEntry("a.cpp", 100000), MakeStatistics(0, 0, 100));
+	estimator.OnFileResult(MakeEntry("b.cpp", 1000), MakeStatistics(0, 0, 50));
+	estimator.OnFileUnfinished(MakeEntry("c.cpp", 1010));
+
+	RemainderEstimator::Estimate estimate;
+	ASSERT_TRUE(estimator.GetEstimate(estimate));
+	EXPECT_EQ(51ULL, estimate.statistics.codeLines);
+}
+
+TEST(RemainderEstimatorTest, FallsBackOnAllFiles)
+{
+	RemainderEstimator estimator;
+	estimator.OnFileResult(MakeEntry("a.cpp", 1000), MakeStatistics(0, 0, 40));
+	estimator.OnFileResult(MakeEntry("b.h", 1000), MakeStatistics(0, 0, 20));
+	estimator.OnFileUnfinished(MakeEntry("c.cc", 200));
+	estimator.OnFileUnfinished(MakeEntry("Makefile", 100));
+
+	RemainderEstimator::Estimate estimate;
+	ASSERT_TRUE(estimator.GetEstimate(estimate));
+	EXPECT_EQ(9ULL, estimate.statistics.codeLines);
+}
+
+TEST(RemainderEstimatorTest, SkippedFilesHaveNoLines)
+{
+	RemainderEstimator estimator;
+	estimator.OnFileResult(MakeEntry("a.js", 1000), MakeStatistics(0, 0, 100));
+	estimator.OnFileSkipped(MakeEntry("a.min.js", 1000), ContentClassifier::ContentMinified);
+	estimator.OnFileUnfinished(MakeEntry("b.js", 100));
+
+	RemainderEstimator::Estimate estimate;
+	ASSERT_TRUE(estimator.GetEstimate(estimate));
+	EXPECT_EQ(5ULL, estimate.statistics.codeLines);
+}
+
+TEST(RemainderEstimatorTest, NothingCounted)
+{
+	RemainderEstimator estimator;
+	estimator.OnFileUnfinished(MakeEntry("a.cpp", 100));
+
+	RemainderEstimator::Estimate estimate;
+	EXPECT_FALSE(estimator.GetEstimate(estimate));
+	EXPECT_EQ(1ULL, estimate.statistics.fileCount);
+	EXPECT_EQ(100ULL, estimate.bytes);
+	EXPECT_EQ(0ULL, estimate.statistics.codeLines);
+}
+
+TEST(RemainderEstimatorTest, EstimatesRestOfFileCutShort)
+{
+	UnfinishedCounter counter;
+	RemainderEstimator estimator;
+	estimator.SetFileResultHandler(&counter);
+
+	// The only file was cut short after a quarter of it had been counted
+	LineCounter::Statistics parsed(MakeStatistics(10, 20, 30));
+	parsed.fileCount = 0;
+	estimator.OnFileCutShort(MakeEntry("big.cpp", 4000), parsed, 1000);
+	EXPECT_EQ(0U, counter.results);
+	EXPECT_EQ(1U, counter.unfinished);
+
+	RemainderEstimator::Estimate estimate;
+	ASSERT_TRUE(estimator.GetEstimate(estimate));
+	EXPECT_EQ(1ULL, estimate.statistics.fileCount);
+	EXPECT_EQ(3000ULL, estimate.bytes);
+	EXPECT_EQ(30ULL, estimate.statistics.blankLines);
+	EXPECT_EQ(60ULL, estimate.statistics.commentLines);
+	EXPECT_EQ(90ULL, estimate.statistics.codeLines);
+}
+
+TEST(RemainderEstimatorTest, PassesResultsOn)
+{
+	UnfinishedCounter counter;
+	RemainderEstimator estimator;
+	estimator.SetFileResultHandler(&counter);
+	estimator.OnFileResult(MakeEntry("a.cpp", 100), MakeStatistics(1, 1, 1));
+	estimator.OnFileUnfinished(MakeEntry("b.cpp", 100));
+	estimator.OnFileUnfinished(MakeEntry("c.cpp", 100));
+	EXPECT_EQ(1U, counter.results);
+	EXPECT_EQ(2U, counter.unfinished);
+}
+
+TEST(DeadlineTest, Passes)
+{
+	Deadline deadline;
+	EXPECT_FALSE(deadline.IsSet());
+	EXPECT_FALSE(deadline.HasPassed());
+
+	deadline.Set(50);
+	EXPECT_TRUE(deadline.IsSet());
+	EXPECT_FALSE(deadline.HasPassed());
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	EXPECT_TRUE(deadline.HasPassed());
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,207 @@
+// File:  resultDiffTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for per-file results and comparison of results.
+
+// Standard C++ headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "resultDiff.h"
+#include "fileResults.h"
+
+class ResultDiffTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		beforeFileName = "resultDiffTestBefore.tmp";
+		afterFileName = "resultDiffTestAfter.tmp";
+	};
+
+	virtual void TearDown()
+	{
+		std::remove(beforeFileName.c_str());
+		std::remove(afterFileName.c_str());
+	};
+
+	std::string beforeFileName;
+	std::string afterFileName;
+
+	static void AddResult(FileResultWriter &writer, const std::string &path,
+		const unsigned long long &blank, const unsigned long long &comment,
+		const unsigned long long &code)
+	{
+		FileEntry entry;
+		entry.path = path;
+		entry.size = 0;
+		entry.device = 0;
+		entry.inode = 0;
+
+		LineCounter::Statistics statistics;
+		statistics.blankLines = blank;
+		statistics.commentLines = comment;
+		statistics.codeLines = code;
+		statistics.fileCount = 1;
+		writer.OnFileResult(entry, statistics);
+	};
+
+	static void ExpectChange(const ResultDiff::Change &change, const std::string &name,
+		const long long &blank, const long long &comment, const long long &code)
+	{
+		EXPECT_EQ(name, change.name);
+		EXPECT_EQ(blank, change.blankLines);
+		EXPECT_EQ(comment, change.commentLines);
+		EXPECT_EQ(code, change.codeLines);
+	};
+};
+
+TEST_F(ResultDiffTest, WritesSortedResults)
+{
+	FileResultWriter writer;
+	AddResult(writer, "src/b.cpp", 1, 2, 3);
+	AddResult(writer, "src/a b.cpp", 4, 5, 6);
+	AddResult(writer, "src/b.cpp", 1, 2, 3);
+	ASSERT_TRUE(writer.Write(beforeFileName));
+
+	FileResultReader reader;
+	ASSERT_TRUE(reader.Open(beforeFileName));
+
+	std::string path;
+	LineCounter::Statistics statistics;
+	ASSERT_TRUE(reader.Next(path, statistics));
+	EXPECT_EQ("src/a b.cpp", path);
+	EXPECT_EQ(4U, statistics.blankLines);
+	EXPECT_EQ(5U, statistics.commentLines);
+	EXPECT_EQ(6U, statistics.codeLines);
+	ASSERT_TRUE(reader.Next(path, statistics));
+	EXPECT_EQ("src/b.cpp", path);
+	EXPECT_FALSE(reader.Next(path, statistics));
+	EXPECT_FALSE(reader.HasFailed());
+}
+
+TEST_F(ResultDiffTest, RejectsUnsortedResults)
+{
+	std::ofstream file(beforeFileName.c_str());
+	file << "LineCounter file results 1\n0 0 1 b.c\n0 0 1 a.c\n";
+	file.close();
+
+	FileResultReader reader;
+	ASSERT_TRUE(reader.Open(beforeFileName));
+
+	std::string path;
+	LineCounter::Statistics statistics;
+	EXPECT_TRUE(reader.Next(path, statistics));
+	EXPECT_FALSE(reader.Next(path, statistics));
+	EXPECT_TRUE(reader.HasFailed());
+
+	FileResultReader notResults;
+	EXPECT_FALSE(notResults.Open("resultDiffTestMissing.tmp"));
+}
+
+TEST_F(ResultDiffTest, TotalsChanges)
+{
+	FileResultWriter before;
+	AddResult(before, "lib/util.c", 1, 1, 10);
+	AddResult(before, "src/core/a.cpp", 5, 5, 100);
+	AddResult(before, "src/core/old.h", 2, 0, 20);
+	AddResult(before, "src/main.cpp", 0, 0, 7);
+	ASSERT_TRUE(before.Write(beforeFileName));
+
+	FileResultWriter after;
+	AddResult(after, "lib/util.c", 1, 1, 10);
+	AddResult(after, "src/core/a.cpp", 6, 5, 150);
+	AddResult(after, "src/gui/new.h", 1, 3, 8);
+	AddResult(after, "src/main.cpp", 0, 1, 5);
+	AddResult(after, "README", 3, 0, 0);
+	ASSERT_TRUE(after.Write(afterFileName));
+
+	FileResultReader beforeReader, afterReader;
+	ASSERT_TRUE(beforeReader.Open(beforeFileName));
+	ASSERT_TRUE(afterReader.Open(afterFileName));
+
+	ResultDiff diff(3);
+	ASSERT_TRUE(diff.Compare(beforeReader, afterReader));
+
+	EXPECT_EQ(2U, diff.GetAddedFileCount());
+	EXPECT_EQ(1U, diff.GetRemovedFileCount());
+	EXPECT_EQ(2U, diff.GetChangedFileCount());
+	ExpectChange(diff.GetTotal(), "total", 3, 4, 36);
+
+	ASSERT_EQ(3U, diff.GetFiles().size());
+	ExpectChange(diff.GetFiles()[0], "src/core/a.cpp", 1, 0, 50);
+	EXPECT_EQ(ResultDiff::StatusChanged, diff.GetFiles()[0].status);
+	ExpectChange(diff.GetFiles()[1], "src/core/old.h", -2, 0, -20);
+	EXPECT_EQ(ResultDiff::StatusRemoved, diff.GetFiles()[1].status);
+	ExpectChange(diff.GetFiles()[2], "src/gui/new.h", 1, 3, 8);
+	EXPECT_EQ(ResultDiff::StatusAdded, diff.GetFiles()[2].status);
+
+	// Directory totals include subdirectories; lib/ is unchanged
+	ASSERT_EQ(3U, diff.GetDirectories().size());
+	ExpectChange(diff.GetDirectories()[0], "./", 3, 4, 36);
+	ExpectChange(diff.GetDirectories()[1], "src/", 0, 4, 36);
+	ExpectChange(diff.GetDirectories()[2], "src/core/", -1, 0, 30);
+
+	ASSERT_EQ(4U, diff.GetExtensions().size());
+	ExpectChange(diff.GetExtensions()[0], "cpp", 1, 1, 48);
+	ExpectChange(diff.GetExtensions()[1], "h", -1, 3, -12);
+	ExpectChange(diff.GetExtensions()[2], "(none)", 3, 0, 0);
+	ExpectChange(diff.GetExtensions()[3], "c", 0, 0, 0);
+}
+
+TEST_F(ResultDiffTest, SkipsDirectoriesWithOneSubdirectory)
+{
+	FileResultWriter before;
+	AddResult(before, "/home/user/project/a.c", 0, 0, 1);
+	AddResult(before, "/home/user/project/lib/b.c", 0, 0, 1);
+	ASSERT_TRUE(before.Write(beforeFileName));
+
+	FileResultWriter after;
+	AddResult(after, "/home/user/project/a.c", 0, 0, 2);
+	AddResult(after, "/home/user/project/lib/b.c", 0, 0, 3);
+	ASSERT_TRUE(after.Write(afterFileName));
+
+	FileResultReader beforeReader, afterReader;
+	ASSERT_TRUE(beforeReader.Open(beforeFileName));
+	ASSERT_TRUE(afterReader.Open(afterFileName));
+
+	ResultDiff diff(10);
+	ASSERT_TRUE(diff.Compare(beforeReader, afterReader));
+	ASSERT_EQ(2U, diff.GetDirectories().size());
+	ExpectChange(diff.GetDirectories()[0], "/home/user/project/", 0, 0, 3);
+	ExpectChange(diff.GetDirectories()[1], "/home/user/project/lib/", 0, 0, 2);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,217 @@
+// File:  samplerTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for stratified sampling estimates.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "sampler.h"
+
+// Synthetic file with line counts roughly proportional to its size
+static LineCounter::Statistics MakeResult(const FileEntry &entry, const unsigned int &seed)
+{
+	LineCounter::Statistics statistics;
+	statistics.fileCount = 1;
+	statistics.blankLines = entry.size / 200 + seed % 7;
+	statistics.commentLines = entry.size / 100 + seed % 13;
+	statistics.codeLines = entry.size / 30 + seed % 29;
+	return statistics;
+}
+
+static std::vector<FileEntry> MakeFiles(const unsigned int &count)
+{
+	std::vector<FileEntry> files;
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		std::ostringstream ss;
+		ss << "dir/file" << i << (i % 3 == 0 ? ".h" : ".cpp");
+
+		FileEntry entry;
+		entry.path = ss.str();
+		entry.size = 1000 + (i * 7919) % 50000;
+		entry.device = 0;
+		entry.inode = 0;
+		files.push_back(entry);
+	}
+
+	return files;
+}
+
+// Files skipped by RunSampler() (if skipEvery is not zero)
+static bool SkipFile(const unsigned int &index, const unsigned int &skipEvery)
+{
+	return skipEvery > 0 && index % skipEvery == 0;
+}
+
+// Parses the samples (using the synthetic results) until the sampler is done
+static Sampler::Estimate RunSampler(Sampler &sampler, const std::vector<FileEntry> &files,
+	unsigned long long &parsedCount, const unsigned int &skipEvery = 0)
+{
+	parsedCount = 0;
+	std::vector<FileEntry> sample;
+	while (sampler.NextSample(sample))
+	{
+		unsigned int i, j;
+		for (i = 0; i < sample.size(); i++)
+		{
+			for (j = 0; j < files.size(); j++)
+			{
+				if (files[j].path != sample[i].path)
+					continue;
+
+				if (SkipFile(j, skipEvery))
+					sampler.OnFileSkipped(sample[i], ContentClassifier::ContentGenerated);
+				else
+					sampler.OnFileResult(sample[i], MakeResult(files[j], j));
+			}
+		}
+		parsedCount += sample.size();
+	}
+
+	return sampler.GetEstimate();
+}
+
+TEST(SamplerTest, SmallStrataAreExact)
+{
+	const std::vector<FileEntry> files(MakeFiles(6));
+	Sampler sampler(files, 0.01);
+	unsigned long long parsedCount;
+	const Sampler::Estimate estimate(RunSampler(sampler, files, parsedCount));
+
+	LineCounter::Statistics truth = {};
+	unsigned int i;
+	for (i = 0; i < files.size(); i++)
+	{
+		const LineCounter::Statistics s(MakeResult(files[i], i));
+		truth.blankLines += s.blankLines;
+		truth.commentLines += s.commentLines;
+		truth.codeLines += s.codeLines;
+	}
+
+	EXPECT_EQ(files.size(), parsedCount);
+	EXPECT_EQ(files.size(), estimate.statistics.fileCount);
+	EXPECT_EQ(truth.blankLines, estimate.statistics.blankLines);
+	EXPECT_EQ(truth.commentLines, estimate.statistics.commentLines);
+	EXPECT_EQ(truth.codeLines, estimate.statistics.codeLines);
+	EXPECT_EQ(0u, estimate.margin.codeLines);
+}
+
+TEST(SamplerTest, EstimateMeetsErrorBound)
+{
+	const std::vector<FileEntry> files(MakeFiles(20000));
+	const double maxError(0.01);
+	Sampler sampler(files, maxError);
+	unsigned long long parsedCount;
+	const Sampler::Estimate estimate(RunSampler(sampler, files, parsedCount));
+
+	LineCounter::Statistics truth = {};
+	unsigned int i;
+	for (i = 0; i < files.size(); i++)
+	{
+		const LineCounter::Statistics s(MakeResult(files[i], i));
+		truth.blankLines += s.blankLines;
+		truth.commentLines += s.commentLines;
+		truth.codeLines += s.codeLines;
+	}
+
+	const double totalLines(static_cast<double>(truth.blankLines
+		+ truth.commentLines + truth.codeLines));
+
+	EXPECT_LT(parsedCount, files.size() / 4);
+	EXPECT_EQ(parsedCount, estimate.sampledFileCount);
+	EXPECT_EQ(files.size(), estimate.statistics.fileCount);
+	EXPECT_LE(estimate.margin.codeLines, maxError * totalLines * 1.1);
+	EXPECT_NEAR(static_cast<double>(truth.codeLines),
+		static_cast<double>(estimate.statistics.codeLines), maxError * totalLines);
+	EXPECT_NEAR(static_cast<double>(truth.commentLines),
+		static_cast<double>(estimate.statistics.commentLines), maxError * totalLines);
+	EXPECT_NEAR(static_cast<double>(truth.blankLines),
+		static_cast<double>(estimate.statistics.blankLines), maxError * totalLines);
+}
+
+TEST(SamplerTest, SkippedFilesAreLeftOut)
+{
+	const unsigned int skipEvery(4);
+	const std::vector<FileEntry> smallFiles(MakeFiles(6)), largeFiles(MakeFiles(20000));
+	const double maxError(0.01);
+	unsigned int k;
+	for (k = 0; k < 2; k++)
+	{
+		const std::vector<FileEntry> &files(k == 0 ? smallFiles : largeFiles);
+		Sampler sampler(files, maxError);
+		unsigned long long parsedCount;
+		const Sampler::Estimate estimate(RunSampler(sampler, files, parsedCount, skipEvery));
+
+		LineCounter::Statistics truth = {};
+		unsigned int i;
+		for (i = 0; i < files.size(); i++)
+		{
+			if (SkipFile(i, skipEvery))
+				continue;
+
+			const LineCounter::Statistics s(MakeResult(files[i], i));
+			truth.fileCount++;
+			truth.blankLines += s.blankLines;
+			truth.commentLines += s.commentLines;
+			truth.codeLines += s.codeLines;
+		}
+
+		if (k == 0)
+		{
+			// Every file was sampled, so the estimate is exact
+			EXPECT_EQ(truth.fileCount, estimate.statistics.fileCount);
+			EXPECT_EQ(truth.codeLines, estimate.statistics.codeLines);
+			EXPECT_EQ(truth.commentLines, estimate.statistics.commentLines);
+			EXPECT_EQ(truth.blankLines, estimate.statistics.blankLines);
+			EXPECT_EQ(0u, estimate.margin.codeLines);
+		}
+		else
+		{
+			const double totalLines(static_cast<double>(truth.blankLines
+				+ truth.commentLines + truth.codeLines));
+			EXPECT_NEAR(static_cast<double>(truth.fileCount),
+				static_cast<double>(estimate.statistics.fileCount), 0.02 * files.size());
+			EXPECT_NEAR(static_cast<double>(truth.codeLines),
+				static_cast<double>(estimate.statistics.codeLines), maxError * totalLines);
+			EXPECT_NEAR(static_cast<double>(truth.commentLines),
+				static_cast<double>(estimate.statistics.commentLines), maxError * totalLines);
+		}
+	}
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
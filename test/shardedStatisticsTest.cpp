@@ -0,0 +1,116 @@
+// File:  shardedStatisticsTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for per-thread statistics shards.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "shardedStatistics.h"
+
+TEST(ShardedStatisticsTest, SumsShards)
+{
+	ShardedStatistics statistics(3);
+	LineCounter::Statistics s = {};
+	EXPECT_EQ(0u, statistics.Snapshot().fileCount);
+
+	s.fileCount = 1;
+	s.codeLines = 5000000000ULL;// Larger than 32 bits
+	statistics.Publish(0, s);
+	s.fileCount = 2;
+	s.blankLines = 7;
+	statistics.Publish(2, s);
+
+	const LineCounter::Statistics total(statistics.Snapshot());
+	EXPECT_EQ(3u, total.fileCount);
+	EXPECT_EQ(7u, total.blankLines);
+	EXPECT_EQ(0u, total.commentLines);
+	EXPECT_EQ(10000000000ULL, total.codeLines);
+}
+
+TEST(ShardedStatisticsTest, ReadersSeeConsistentShards)
+{
+	const unsigned int threadCount(4), updateCount(200000);
+	ShardedStatistics statistics(threadCount);
+	std::atomic<bool> done(false);
+
+	// Writers keep every count a fixed multiple of fileCount, so any torn
+	// read shows up as a broken ratio
+	std::vector<std::thread> threads;
+	unsigned int i;
+	for (i = 0; i < threadCount; i++)
+	{
+		threads.push_back(std::thread([&statistics, i, updateCount]()
+		{
+			LineCounter::Statistics s = {};
+			unsigned int j;
+			for (j = 1; j <= updateCount; j++)
+			{
+				s.fileCount = j;
+				s.blankLines = 2ULL * j;
+				s.commentLines = 3ULL * j;
+				s.codeLines = 4ULL * j;
+				statistics.Publish(i, s);
+			}
+		}));
+	}
+
+	unsigned int inconsistent(0);
+	std::thread reader([&statistics, &done, &inconsistent]()
+	{
+		unsigned long long lastFileCount(0);
+		while (!done)
+		{
+			const LineCounter::Statistics s(statistics.Snapshot());
+			if (s.blankLines != 2 * s.fileCount || s.commentLines != 3 * s.fileCount
+				|| s.codeLines != 4 * s.fileCount || s.fileCount < lastFileCount)
+				inconsistent++;
+			lastFileCount = s.fileCount;
+		}
+	});
+
+	for (i = 0; i < threadCount; i++)
+		threads[i].join();
+	done = true;
+	reader.join();
+
+	EXPECT_EQ(0u, inconsistent);
+	EXPECT_EQ(static_cast<unsigned long long>(threadCount) * updateCount,
+		statistics.Snapshot().fileCount);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
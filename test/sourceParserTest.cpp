@@ -3,6 +3,9 @@
 // Auth:  K. Loux
 // Desc:  Tests for source parser class.
 
+// Standard C++ headers
+#include <ctime>
+
 // Google Test headers
 #include <gtest/gtest.h>
 
@@ -126,6 +129,18 @@ TEST_F(SourceParserCppStyleTest, IgnoresCommentedBlockCommentStart)
 		"do.Something();//This is just /* a single line comment, too"));
 }
 
+TEST_F(SourceParserCppStyleTest, SingleLineCommentHidesBlockCommentStart)
+{
+	EXPECT_EQ(SourceParser::PositionCode, sp->ParseLine(
+		"do.Something();//This is not /* the start of a block comment"));
+	EXPECT_EQ(SourceParser::PositionCode, sp->ParseLine(
+		"so.ThisIsStillCode();"));
+	EXPECT_EQ(SourceParser::PositionComment, sp->ParseLine(
+		"//Neither is /* this"));
+	EXPECT_EQ(SourceParser::PositionCode, sp->ParseLine(
+		"so.ThisIsStillCode();"));
+}
+
 TEST_F(SourceParserCppStyleTest, FindsNormalCode)
 {
 	EXPECT_EQ(SourceParser::PositionCode, sp->ParseLine(
@@ -208,6 +223,33 @@ TEST_F(SourceParserCppStyleTest, HandlesCommentContinuation)
 		"backToRegularCode();"));
 }
 
+TEST_F(SourceParserCppStyleTest, LongLinesParseInLinearTime)
+{
+	// Several megabytes with hundreds of thousands of inline comments
+	std::string line;
+	unsigned int i;
+	for (i = 0; i < 400000; i++)
+		line.append("a = b;/* c */");
+
+	std::string openLine(line);
+	openLine.append("/* left open");
+
+	std::string commentLine;
+	for (i = 0; i < 400000; i++)
+		commentLine.append("/* c *//**/");
+
+	const clock_t start(clock());
+	EXPECT_EQ(SourceParser::PositionCode, sp->ParseLine(line));
+	EXPECT_EQ(SourceParser::PositionCode, sp->ParseLine(openLine));
+	EXPECT_EQ(SourceParser::PositionComment, sp->ParseLine("still inside the block comment */"));
+	EXPECT_EQ(SourceParser::PositionComment, sp->ParseLine(commentLine));
+	EXPECT_EQ(SourceParser::PositionCode, sp->ParseLine(line + "// trailing \\"));
+	EXPECT_EQ(SourceParser::PositionComment, sp->ParseLine(line));
+
+	const double elapsed(double(clock() - start) / CLOCKS_PER_SEC);
+	EXPECT_LT(elapsed, 2.0);
+}
+
 class SourceParserMultiCommentTokenTest : public ::testing::Test
 {
 protected:
@@ -0,0 +1,254 @@
+// File:  textDecoderTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for encoding detection and UTF-16 conversion.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "textDecoder.h"
+#include "lineCounter.h"
+
+// Converts ASCII or UTF-16 code units to bytes in the specified order
+static std::string ToUtf16(const std::vector<unsigned int> &units, const bool &littleEndian)
+{
+	std::string s;
+	unsigned int i;
+	for (i = 0; i < units.size(); i++)
+	{
+		const char low(static_cast<char>(units[i] & 0xff));
+		const char high(static_cast<char>(units[i] >> 8));
+		s.push_back(littleEndian ? low : high);
+		s.push_back(littleEndian ? high : low);
+	}
+
+	return s;
+}
+
+static std::string ToUtf16(const std::string &ascii, const bool &littleEndian)
+{
+	std::vector<unsigned int> units(ascii.begin(), ascii.end());
+	return ToUtf16(units, littleEndian);
+}
+
+static std::string Decode(const std::string &data, const TextDecoder::Encoding &encoding)
+{
+	TextDecoder decoder(encoding);
+	std::string output;
+	decoder.Decode(data.data(), data.length(), output);
+	decoder.Finish(output);
+	return output;
+}
+
+TEST(TextDecoderTest, DetectsEncoding)
+{
+	size_t bomLength;
+	EXPECT_EQ(TextDecoder::EncodingUtf8, TextDecoder::DetectEncoding("int x;", 6, bomLength));
+	EXPECT_EQ(0U, bomLength);
+	EXPECT_EQ(TextDecoder::EncodingUtf8, TextDecoder::DetectEncoding("\xef\xbb\xbfint", 6, bomLength));
+	EXPECT_EQ(3U, bomLength);
+	EXPECT_EQ(TextDecoder::EncodingUtf16LittleEndian, TextDecoder::DetectEncoding("\xff\xfei\0", 4, bomLength));
+	EXPECT_EQ(2U, bomLength);
+	EXPECT_EQ(TextDecoder::EncodingUtf16BigEndian, TextDecoder::DetectEncoding("\xfe\xff\0i", 4, bomLength));
+	EXPECT_EQ(2U, bomLength);
+	EXPECT_EQ(TextDecoder::EncodingUtf8, TextDecoder::DetectEncoding("\xff", 1, bomLength));
+	EXPECT_EQ(0U, bomLength);
+}
+
+TEST(TextDecoderTest, DecodesBothByteOrders)
+{
+	std::vector<unsigned int> units;
+	units.push_back('a');
+	units.push_back(0xe9);// U+00E9
+	units.push_back(0x20ac);// U+20AC
+	units.push_back(0xd83d);// U+1F600 as a surrogate pair
+	units.push_back(0xde00);
+	units.push_back('\n');
+	const std::string expected("a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\n");
+
+	EXPECT_EQ(expected, Decode(ToUtf16(units, true), TextDecoder::EncodingUtf16LittleEndian));
+	EXPECT_EQ(expected, Decode(ToUtf16(units, false), TextDecoder::EncodingUtf16BigEndian));
+	EXPECT_EQ(expected, Decode(expected, TextDecoder::EncodingUtf8));
+}
+
+TEST(TextDecoderTest, ReplacesInvalidInput)
+{
+	const std::string replacement("\xef\xbf\xbd");
+
+	std::vector<unsigned int> units;
+	units.push_back(0xdc00);// Unpaired low surrogate
+	units.push_back('a');
+	units.push_back(0xd800);// High surrogate followed by a non-surrogate
+	units.push_back('b');
+	units.push_back(0xd800);// High surrogate at the end of the input
+	EXPECT_EQ(replacement + "a" + replacement + "b" + replacement,
+		Decode(ToUtf16(units, true), TextDecoder::EncodingUtf16LittleEndian));
+
+	// Odd number of bytes
+	EXPECT_EQ("a" + replacement, Decode(std::string("a\0b", 3), TextDecoder::EncodingUtf16LittleEndian));
+}
+
+TEST(TextDecoderTest, DecodesInPieces)
+{
+	std::vector<unsigned int> units;
+	unsigned int i;
+	for (i = 0; i < 50; i++)
+	{
+		units.push_back('a' + i % 26);
+		if (i % 7 == 0)
+		{
+			units.push_back(0xd83d);
+			units.push_back(0xde00);
+		}
+		else if (i % 5 == 0)
+			units.push_back(0x3000);
+	}
+
+	const std::string data(ToUtf16(units, false));
+	const std::string expected(Decode(data, TextDecoder::EncodingUtf16BigEndian));
+
+	// Pieces of every size split code units and surrogate pairs in every way
+	size_t pieceSize;
+	for (pieceSize = 1; pieceSize <= data.length(); pieceSize++)
+	{
+		TextDecoder decoder(TextDecoder::EncodingUtf16BigEndian);
+		std::string output;
+		size_t position;
+		for (position = 0; position < data.length(); position += pieceSize)
+			decoder.Decode(data.data() + position, std::min(pieceSize, data.length() - position), output);
+		decoder.Finish(output);
+		EXPECT_EQ(expected, output) << "piece size " << pieceSize;
+	}
+}
+
+TEST(TextDecoderTest, DecodesLongAsciiRuns)
+{
+	std::string ascii;
+	unsigned int i;
+	for (i = 0; i < 1000; i++)
+		ascii.push_back(static_cast<char>(' ' + i % 95));
+
+	// Non-ASCII characters at every alignment within the fast path's words
+	for (i = 0; i < 8; i++)
+	{
+		std::vector<unsigned int> units(ascii.begin(), ascii.end());
+		units[100 + i] = 0x00a0;
+		std::string expected(ascii.substr(0, 100 + i) + "\xc2\xa0" + ascii.substr(101 + i));
+		EXPECT_EQ(expected, Decode(ToUtf16(units, true), TextDecoder::EncodingUtf16LittleEndian));
+		EXPECT_EQ(expected, Decode(ToUtf16(units, false), TextDecoder::EncodingUtf16BigEndian));
+	}
+}
+
+class TextDecoderLineCounterTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		comments.push_back("//");
+		blockComments.push_back(std::make_pair(std::string("/*"), std::string("*/")));
+		lineContinuation.push_back("\\");
+	};
+
+	std::vector<std::string> comments;
+	std::vector<std::pair<std::string, std::string> > blockComments;
+	std::vector<std::string> lineContinuation;
+
+	LineCounter::Statistics CountBuffer(const std::string &data)
+	{
+		LineCounter counter(comments, blockComments, lineContinuation);
+		counter.ProcessBuffer(data.data(), data.length());
+		return counter.GetStatistics();
+	};
+
+	LineCounter::Statistics CountChunks(const std::string &data, const size_t &chunkSize)
+	{
+		LineCounter counter(comments, blockComments, lineContinuation);
+		counter.BeginStream();
+		size_t position;
+		for (position = 0; position < data.length(); position += chunkSize)
+			counter.ProcessChunk(data.data() + position, std::min(chunkSize, data.length() - position));
+		counter.EndStream();
+		return counter.GetStatistics();
+	};
+
+	static void ExpectEqual(const LineCounter::Statistics &expected, const LineCounter::Statistics &actual)
+	{
+		EXPECT_EQ(expected.blankLines, actual.blankLines);
+		EXPECT_EQ(expected.commentLines, actual.commentLines);
+		EXPECT_EQ(expected.codeLines, actual.codeLines);
+		EXPECT_EQ(expected.fileCount, actual.fileCount);
+	};
+};
+
+TEST_F(TextDecoderLineCounterTest, CountsUtf16LikeUtf8)
+{
+	const std::string source("// comment\nint x;\n\n/* block\n   comment */\nint y; \\\n  // continued\n\t\n");
+	const LineCounter::Statistics expected(CountBuffer(source));
+	EXPECT_EQ(2U, expected.blankLines);
+	EXPECT_EQ(4U, expected.commentLines);
+	EXPECT_EQ(2U, expected.codeLines);
+
+	ExpectEqual(expected, CountBuffer("\xef\xbb\xbf" + source));
+	ExpectEqual(expected, CountBuffer("\xff\xfe" + ToUtf16(source, true)));
+	ExpectEqual(expected, CountBuffer("\xfe\xff" + ToUtf16(source, false)));
+
+	const std::string utf16("\xff\xfe" + ToUtf16(source, true));
+	size_t chunkSize;
+	for (chunkSize = 1; chunkSize <= utf16.length(); chunkSize++)
+		ExpectEqual(expected, CountChunks(utf16, chunkSize));
+}
+
+TEST_F(TextDecoderLineCounterTest, UnicodeSpacesAreBlank)
+{
+	// No-break space, em space, ideographic space and a byte order mark
+	const LineCounter::Statistics statistics(CountBuffer(
+		"\xc2\xa0\n\xe2\x80\x83\t\n\xe3\x80\x80\n\xef\xbb\xbf\nint\xc2\xa0x;\n\xc2\xa0// comment\n"));
+	EXPECT_EQ(4U, statistics.blankLines);
+	EXPECT_EQ(1U, statistics.commentLines);
+	EXPECT_EQ(1U, statistics.codeLines);
+
+	std::vector<unsigned int> units;
+	units.push_back(0xfeff);
+	units.push_back(0x00a0);
+	units.push_back('\n');
+	units.push_back('x');
+	units.push_back('\n');
+	const LineCounter::Statistics utf16(CountBuffer(ToUtf16(units, true)));
+	EXPECT_EQ(1U, utf16.blankLines);
+	EXPECT_EQ(1U, utf16.codeLines);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
@@ -0,0 +1,292 @@
+// File:  traverserTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for traverser class.
+
+#ifndef WIN32
+// *nix headers
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Standard C++ headers
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "traverser.h"
+
+#ifndef WIN32
+class TraverserTest : public ::testing::Test
+{
+protected:
+	const std::string directory = "traverserTest/";
+	const std::string outside = "traverserTestOutside/";// Reached through links
+	const std::string journalName = "traverserTest.journal";
+	std::vector<std::string> fileNames;
+	std::vector<std::string> directoryNames;// Below directory
+
+	virtual void SetUp()
+	{
+		mkdir(directory.c_str(), 0755);
+		mkdir(outside.c_str(), 0755);
+		mkdir((outside + "directory/").c_str(), 0755);
+	};
+
+	virtual void TearDown()
+	{
+		unsigned int i;
+		for (i = 0; i < fileNames.size(); i++)
+			remove(fileNames[i].c_str());
+		for (i = 0; i < directoryNames.size(); i++)
+			rmdir(directoryNames[directoryNames.size() - i - 1].c_str());
+		rmdir(directory.c_str());
+		rmdir((outside + "directory/").c_str());
+		rmdir(outside.c_str());
+		remove(journalName.c_str());
+	};
+
+	std::string MakeDirectory(const std::string &name)
+	{
+		directoryNames.push_back(directory + name + "/");
+		mkdir(directoryNames.back().c_str(), 0755);
+		return directoryNames.back();
+	};
+
+	std::string MakeFile(const std::string &name)
+	{
+		fileNames.push_back(directory + name);
+		std::ofstream(fileNames.back().c_str()) << "int a;\n";
+		return fileNames.back();
+	};
+
+	// Returns the paths of the files queued, sorted
+	std::vector<std::string> FindFiles(const bool &recursive)
+	{
+		FileQueue queue;
+		FileIdSet visited;
+		Traverser traverser(std::vector<std::string>(1, "cpp"), queue, recursive,
+			PathFilter(), false, visited);
+		EXPECT_TRUE(traverser.Traverse(directory));
+		queue.Close();
+
+		std::vector<std::string> paths;
+		FileEntry entry;
+		while (queue.Pop(entry, false))
+		{
+			queue.Release(entry);
+			paths.push_back(entry.path);
+		}
+		std::sort(paths.begin(), paths.end());
+		return paths;
+	};
+
+	// Searches the directories in order, and returns the files queued
+	static std::vector<FileEntry> Search(const std::vector<std::string> &directories,
+		CheckpointJournal &journal, FileIdSet &visited)
+	{
+		FileQueue queue;
+		Traverser traverser(std::vector<std::string>(1, "cpp"), queue,
+			true, PathFilter(), false, visited);
+		traverser.SetCheckpointJournal(&journal);
+
+		unsigned int i;
+		for (i = 0; i < directories.size(); i++)
+			EXPECT_TRUE(traverser.Traverse(directories[i]));
+		queue.Close();
+
+		std::vector<FileEntry> files;
+		FileEntry entry;
+		while (queue.Pop(entry, false))
+		{
+			queue.Release(entry);
+			files.push_back(entry);
+		}
+		return files;
+	};
+
+	// Returns the number of files queued for the specified shard (or for
+	// the whole search, if count is zero)
+	unsigned int CountFiles(const unsigned int &index, const unsigned int &count)
+	{
+		FileQueue queue;
+		FileIdSet visited;
+		Traverser traverser(std::vector<std::string>(1, "cpp"), queue,
+			true, PathFilter(), false, visited);
+		if (count > 0)
+			traverser.SetShard(index, count, false);
+		EXPECT_TRUE(traverser.Traverse(directory));
+		queue.Close();
+
+		unsigned int files(0);
+		FileEntry entry;
+		while (queue.Pop(entry, false))
+		{
+			queue.Release(entry);
+			files++;
+		}
+		return files;
+	};
+};
+
+TEST_F(TraverserTest, SearchesSubdirectoriesWhenRecursive)
+{
+	MakeDirectory("a");
+	MakeDirectory("a/b");
+	std::vector<std::string> expected;
+	expected.push_back(MakeFile("a/b/bottom.cpp"));
+	expected.push_back(MakeFile("a/middle.CPP"));
+	expected.push_back(MakeFile("top.cpp"));
+	MakeFile("a/notes.txt");
+	MakeFile("a/b/cpp");
+
+	EXPECT_EQ(expected, FindFiles(true));
+	EXPECT_EQ(std::vector<std::string>(1, expected.back()), FindFiles(false));
+}
+
+// Hidden files and directories are skipped (as are "." and "..", or the
+// search would never end)
+TEST_F(TraverserTest, SkipsHiddenEntries)
+{
+	MakeDirectory(".hidden");
+	MakeFile(".hidden/inside.cpp");
+	MakeFile(".dotFile.cpp");
+	const std::string visible(MakeFile("visible.cpp"));
+
+	EXPECT_EQ(std::vector<std::string>(1, visible), FindFiles(true));
+}
+
+// Links are listed as DT_LNK, so they are checked with a stat, as entries
+// are on file systems which list everything as DT_UNKNOWN
+TEST_F(TraverserTest, FollowsLinks)
+{
+	fileNames.push_back(outside + "file.cpp");
+	std::ofstream(fileNames.back().c_str()) << "int a;\n";
+	fileNames.push_back(outside + "directory/inside.cpp");
+	std::ofstream(fileNames.back().c_str()) << "int a;\n";
+
+	std::vector<std::string> expected;
+	expected.push_back(directory + "alias.cpp");
+	ASSERT_EQ(0, symlink(("../" + outside + "file.cpp").c_str(), expected.back().c_str()));
+	fileNames.push_back(expected.back());
+
+	expected.push_back(directory + "linkedDirectory/inside.cpp");
+	fileNames.push_back(directory + "linkedDirectory");
+	ASSERT_EQ(0, symlink(("../" + outside + "directory").c_str(), fileNames.back().c_str()));
+
+	// Dangling links are skipped
+	fileNames.push_back(directory + "broken.cpp");
+	ASSERT_EQ(0, symlink("missing.cpp", fileNames.back().c_str()));
+
+	EXPECT_EQ(expected, FindFiles(true));
+}
+
+// Links are only recognized within a shard, so links to one file which fall
+// in different shards are counted once by each shard
+TEST_F(TraverserTest, CountsLinksOncePerShard)
+{
+	const std::string original(MakeFile("original.cpp"));
+
+	unsigned int i;
+	for (i = 0; i < 8; i++)
+	{
+		fileNames.push_back(directory + "link" + std::to_string(i) + ".cpp");
+		ASSERT_EQ(0, link(original.c_str(), fileNames.back().c_str()));
+	}
+
+	EXPECT_EQ(1U, CountFiles(0, 0));
+
+	const unsigned int shardCount(4);
+	unsigned int shardedTotal(0), shardsWithFiles(0);
+	for (i = 0; i < shardCount; i++)
+	{
+		const unsigned int files(CountFiles(i, shardCount));
+		EXPECT_LE(files, 1U);
+		shardedTotal += files;
+		if (files > 0)
+			shardsWithFiles++;
+	}
+
+	EXPECT_EQ(shardsWithFiles, shardedTotal);
+	EXPECT_GT(shardedTotal, 1U);
+}
+
+// A directory completed before the run was interrupted is skipped when the
+// run is resumed, but links to its files elsewhere must still be recognized
+TEST_F(TraverserTest, ResumingRecognizesLinksToCompletedFiles)
+{
+	std::vector<std::string> directories;
+	directories.push_back(MakeDirectory("done"));
+	directories.push_back(MakeDirectory("pending"));
+	const std::string original(MakeFile("done/original.cpp"));
+	const std::string unfinished(MakeFile("pending/unfinished.cpp"));
+	fileNames.push_back(directory + "pending/link.cpp");
+	ASSERT_EQ(0, link(original.c_str(), fileNames.back().c_str()));
+
+	{
+		CheckpointJournal journal;
+		ASSERT_TRUE(journal.Open(journalName, false));
+		FileIdSet visited;
+		const std::vector<FileEntry> files(Search(directories, journal, visited));
+		ASSERT_EQ(2U, files.size());
+
+		// Interrupted after counting only the original
+		unsigned int i;
+		for (i = 0; i < files.size(); i++)
+		{
+			if (files[i].path == original)
+			{
+				LineCounter::Statistics statistics = { 0, 0, 1, 1 };
+				journal.OnFileResult(files[i], statistics);
+			}
+		}
+		ASSERT_TRUE(journal.Close());
+	}
+
+	CheckpointJournal journal;
+	ASSERT_TRUE(journal.Open(journalName, true));
+	ASSERT_EQ(1ULL, journal.GetResumedDirectoryCount());
+	FileIdSet visited;
+	journal.AddCompletedFileIds(visited);
+	const std::vector<FileEntry> files(Search(directories, journal, visited));
+	ASSERT_EQ(1U, files.size());
+	EXPECT_EQ(unfinished, files[0].path);
+	EXPECT_TRUE(journal.Close());
+}
+#endif
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}
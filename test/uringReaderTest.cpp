@@ -0,0 +1,169 @@
+// File:  uringReaderTest.cpp
+// Date:  10/19/2026
+// Auth:  K. Loux
+// Desc:  Tests for reading files with io_uring (skipped where it isn't
+//        supported).
+
+// Standard C++ headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+
+// Google Test headers
+#include <gtest/gtest.h>
+
+// Local headers
+#include "uringReader.h"
+#include "fileReader.h"
+#include "deadline.h"
+
+class UringReaderTest : public ::testing::Test
+{
+protected:
+	std::vector<std::string> fileNames;
+
+	virtual void TearDown()
+	{
+		unsigned int i;
+		for (i = 0; i < fileNames.size(); i++)
+			remove(fileNames[i].c_str());
+	};
+
+	// Writes a file of the specified size and returns its entry
+	FileEntry MakeFile(const unsigned long long &size)
+	{
+		FileEntry entry;
+		entry.path = "uringReaderTest" + std::to_string(fileNames.size()) + ".txt";
+		entry.size = size;
+		entry.device = 0;
+		entry.inode = 0;
+		fileNames.push_back(entry.path);
+
+		std::ofstream file(entry.path.c_str(), std::ios::binary);
+		unsigned long long i;
+		for (i = 0; i < size; i++)
+			file.put(static_cast<char>('a' + (i * 7 + i / 4093) % 26));
+		return entry;
+	};
+
+	// Reads the entries and returns the results by path
+	std::map<std::string, FileBuffer> Read(const std::vector<FileEntry> &entries,
+		const unsigned long long &maxBufferedFileSize, const Deadline *deadline = NULL)
+	{
+		FileQueue input;
+		unsigned int i;
+		for (i = 0; i < entries.size(); i++)
+			input.Push(entries[i]);
+		input.Close();
+
+		BoundedQueue<FileBuffer> output(1ULL << 40);
+		UringReader reader(4);
+		reader.Run(input, output, maxBufferedFileSize, deadline);
+		output.Close();
+
+		std::map<std::string, FileBuffer> results;
+		FileBuffer file;
+		while (output.Pop(file))
+			results[file.entry.path] = file;
+		return results;
+	};
+};
+
+TEST_F(UringReaderTest, MatchesFileReader)
+{
+	if (!UringReader(4).IsOK())
+		GTEST_SKIP();
+
+	// Includes files larger than the reader's buffers and more files than slots
+	const unsigned long long sizes[] = { 0, 1, 4095, 65536, 1024 * 1024, 1024 * 1024 + 1, 3000000, 17, 100 };
+	std::vector<FileEntry> entries;
+	unsigned int i;
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+		entries.push_back(MakeFile(sizes[i]));
+
+	const std::map<std::string, FileBuffer> results(Read(entries, 1ULL << 30));
+	ASSERT_EQ(entries.size(), results.size());
+	for (i = 0; i < entries.size(); i++)
+	{
+		const std::map<std::string, FileBuffer>::const_iterator it(results.find(entries[i].path));
+		ASSERT_TRUE(it != results.end());
+		EXPECT_TRUE(it->second.buffered);
+
+		std::string expected;
+		ASSERT_TRUE(FileReader::Read(entries[i].path, entries[i].size, expected));
+		EXPECT_EQ(expected, it->second.contents) << entries[i].path;
+	}
+}
+
+TEST_F(UringReaderTest, PassesOnUnreadFiles)
+{
+	if (!UringReader(4).IsOK())
+		GTEST_SKIP();
+
+	// Missing files and files too large to buffer are passed on unread
+	std::vector<FileEntry> entries;
+	entries.push_back(MakeFile(10));
+	entries.push_back(MakeFile(1000));
+	FileEntry missing(entries[0]);
+	missing.path = "uringReaderTestMissing.txt";
+	entries.push_back(missing);
+
+	const std::map<std::string, FileBuffer> results(Read(entries, 100));
+	ASSERT_EQ(3U, results.size());
+	EXPECT_TRUE(results.at(entries[0].path).buffered);
+	EXPECT_FALSE(results.at(entries[1].path).buffered);
+	EXPECT_FALSE(results.at(missing.path).buffered);
+	EXPECT_TRUE(results.at(missing.path).contents.empty());
+}
+
+TEST_F(UringReaderTest, StopsReadingAfterDeadline)
+{
+	if (!UringReader(4).IsOK())
+		GTEST_SKIP();
+
+	std::vector<FileEntry> entries;
+	entries.push_back(MakeFile(10));
+	entries.push_back(MakeFile(20));
+
+	Deadline deadline;
+	deadline.Set(1);
+	while (!deadline.HasPassed())
+	{
+	}
+
+	const std::map<std::string, FileBuffer> results(Read(entries, 1ULL << 30, &deadline));
+	ASSERT_EQ(2U, results.size());
+	EXPECT_FALSE(results.at(entries[0].path).buffered);
+	EXPECT_FALSE(results.at(entries[1].path).buffered);
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int
+//		argv	= char*[]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, argv);
+#ifdef WIN32
+	int res = RUN_ALL_TESTS();
+	system("PAUSE");
+	return res;
+#else
+	return RUN_ALL_TESTS();
+#endif
+}